@@ -26,6 +26,7 @@ bool Configure::initConfig() {
     .keyJis = true,
     .develop = false,
     .autoKeyOff = 10,
+    .unlockTimeout = 300,
   };
   if (_debug) sp("config initialize");
   if (saveConfig(iniconf)) {
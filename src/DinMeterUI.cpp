@@ -8,6 +8,7 @@
 */
 #include "DinMeterUI.h"
 #include "icon.h"
+#include <esp_heap_caps.h>
 
 // コンストラクタ
 DinMeterUI::DinMeterUI() {
@@ -18,23 +19,305 @@ DinMeterUI::DinMeterUI() {
 void DinMeterUI::setDrawDisplay(LovyanGFX* display, unsigned short bgColor) {
   _dst = display;
   _bgColor = bgColor;
+  if (_dstMutex == nullptr) _dstMutex = xSemaphoreCreateRecursiveMutex();
 }
 
 // 上位Canvasの出力可能な状態になるまで待つ
-void DinMeterUI::lockCanvas(uint32_t timeout) {
-  if (_dstLock) {
-    uint32_t tm = millis();
-    while (tm > millis()-timeout) {
-      if (!_dstLock) break;
-      delay(5);
-    }
-  }
-  _dstLock = true;
+//   描画タスクの外から直接描く場合は、先にキューにある出力を終わらせる（後から描いた方が上になるように）
+//   同じタスクなら入れ子にできる。入れ子の内側では待たない（描画タスクがロックを取れず終わらないため）
+bool DinMeterUI::lockCanvas(uint32_t timeout) {
+  if (_dstMutex == nullptr) return true;
+  if (xSemaphoreGetMutexHolder(_dstMutex) != xTaskGetCurrentTaskHandle()) waitRender();
+  TickType_t ticks = (timeout == UINT32_MAX) ? portMAX_DELAY : pdMS_TO_TICKS(timeout);
+  if (xSemaphoreTakeRecursive(_dstMutex, ticks) == pdTRUE) return true;
+  if (_debug) spf("lockCanvas: timeout (%u ms)\n", timeout);
+  return false;
 }
 
 // 上位Canvasの出力ロックを解除する
 void DinMeterUI::unlockCanvas() {
-  _dstLock = false;
+  if (_dstMutex != nullptr) xSemaphoreGiveRecursive(_dstMutex);
+}
+
+// バックバッファに描く間、描画タスクのコピーと重ならないようにロックする（timeoutミリ秒で取れなければfalse）
+//   描画タスクはロックを持ったままバックバッファからコピーするので、ロックを取ればコピーが終わるまで待つだけで済む
+//   lockCanvas()と違ってキューの出力が全部終わるのは待たない（ループタスクが描画タスクの転送を待たずに次を描けるように）
+bool DinMeterUI::lockPanel(uint32_t timeout) {
+  if (_dstMutex == nullptr) return true;
+  TickType_t ticks = (timeout == UINT32_MAX) ? portMAX_DELAY : pdMS_TO_TICKS(timeout);
+  if (xSemaphoreTakeRecursive(_dstMutex, ticks) == pdTRUE) return true;
+  if (_debug) spf("lockPanel: timeout (%u ms)\n", timeout);
+  return false;
+}
+
+// バックバッファのロックを解除する
+void DinMeterUI::unlockPanel() {
+  if (_dstMutex != nullptr) xSemaphoreGiveRecursive(_dstMutex);
+}
+
+// 各パネルのバックバッファを確保する
+//   描画のたびにcreateSprite()するとヒープが断片化するので、起動時にまとめて確保して使い回す
+bool DinMeterUI::beginSprites() {
+  bool res = true;
+  for (int i=0; i<UI_PANEL_COUNT; i++) {
+    res &= (panelCanvas((UiPanel)i)->getBuffer() != nullptr);
+  }
+  heapSample();
+  if (_debug) spf("beginSprites: %s, free=%u largest=%u\n", (res ? "ok" : "failed"), _heap.minFree, _heap.lastLargest);
+  return res;
+}
+
+// パネルのバックバッファを取得する（未確保なら確保する）
+M5Canvas* DinMeterUI::panelCanvas(UiPanel panel) {
+  M5Canvas* canvas = &_panels[panel];
+  if (canvas->getBuffer() == nullptr) {
+    WHaddress wh = (panel == UI_PANEL_STATUS) ? swh : (panel == UI_PANEL_ROTARY) ? rwh : mwh;
+    canvas->setColorDepth(16);
+    if (canvas->createSprite(wh.w, wh.h) == nullptr) {
+      if (_debug) spf("panelCanvas: createSprite(%d x %d) failed\n", wh.w, wh.h);
+    }
+  }
+  // 前回の描画で変えた設定を戻す
+  canvas->clearClipRect();
+  canvas->clearScrollRect();
+  canvas->setTextScroll(false);
+  canvas->setTextDatum(TL_DATUM);
+  canvas->setTextColor(TFT_WHITE);
+  canvas->setFont(&fonts::Font0);
+  return canvas;
+}
+
+// パネルの画面上の位置
+XYaddress DinMeterUI::panelXY(UiPanel panel) {
+  return (panel == UI_PANEL_STATUS) ? sxy : (panel == UI_PANEL_ROTARY) ? rxy : mxy;
+}
+
+// バックバッファのy行目からh行分を画面に出力する（h<0はy行目から最後まで）
+//   描画タスクが動いていればキューに入れてすぐに戻る
+void DinMeterUI::pushPanel(UiPanel panel, int y, int h) {
+  M5Canvas* canvas = &_panels[panel];
+  if (canvas->getBuffer() == nullptr) return;
+  XYaddress xy = panelXY(panel);
+  int w = canvas->width();
+  if (h < 0) h = canvas->height() - y;
+  if (y < 0 || h <= 0 || y + h > canvas->height()) return;
+  _push.frameBytes += w * h * 2;
+  if (_renderTask != nullptr) {
+    queueRender(panel, 0, y, w, h);
+    return;
+  }
+  lockCanvas();
+  _dst->startWrite(); 
+  if (y == 0 && h == canvas->height()) {
+    canvas->pushSprite(_dst, xy.x, xy.y);
+  } else {  // 横幅いっぱいの帯はバッファ上で連続しているので、そのまま転送する
+    const lgfx::swap565_t* buff = (const lgfx::swap565_t*)canvas->getBuffer();
+    _dst->pushImage(xy.x, xy.y+y, w, h, buff + y * w);
+  }
+  _dst->endWrite();
+  unlockCanvas();
+  heapSample();
+}
+
+// バックバッファの矩形だけを画面に出力する
+//   出力先の描画範囲を矩形に限定してpushSprite()すると、範囲内の画素だけが転送される
+//   描画タスクが動いていればキューに入れてすぐに戻る
+void DinMeterUI::pushPanelRect(UiPanel panel, int x, int y, int w, int h) {
+  M5Canvas* canvas = &_panels[panel];
+  if (canvas->getBuffer() == nullptr || w <= 0 || h <= 0) return;
+  XYaddress xy = panelXY(panel);
+  _push.frameBytes += w * h * 2;
+  if (_renderTask != nullptr) {
+    queueRender(panel, x, y, w, h);
+    return;
+  }
+  lockCanvas();
+  _dst->startWrite(); 
+  int32_t cx, cy, cw, ch;
+  _dst->getClipRect(&cx, &cy, &cw, &ch);
+  _dst->setClipRect(xy.x+x, xy.y+y, w, h);
+  canvas->pushSprite(_dst, xy.x, xy.y);
+  _dst->setClipRect(cx, cy, cw, ch);
+  _dst->endWrite();
+  unlockCanvas();
+}
+
+// 描画タスクを起動する（以降の出力はキューに入れてすぐに戻る）
+//   ループタスクはSPIの転送を待たずに、エンコーダーやボタンの処理とTOTPの計算を続けられる
+bool DinMeterUI::beginRenderTask(int core) {
+  if (_renderTask != nullptr) return true;
+  size_t bufSize = mwh.w * dmaRows * 2;
+  for (int i=0; i<2; i++) {
+    _dmaBuffer[i] = (uint16_t*)heap_caps_malloc(bufSize, MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+  }
+  _renderQueue = xQueueCreate(UI_RENDER_QUEUE_LEN, sizeof(UiRenderCmd));
+  bool res = (_dmaBuffer[0] != nullptr && _dmaBuffer[1] != nullptr && _renderQueue != nullptr);
+  if (res) {
+    res = (xTaskCreatePinnedToCore(renderTask, "uiRender", 4096, this, 2, &_renderTask, core) == pdPASS);
+  }
+  if (!res) {   // 起動できなければ、今まで通りループタスクで出力する
+    for (int i=0; i<2; i++) {
+      heap_caps_free(_dmaBuffer[i]);
+      _dmaBuffer[i] = nullptr;
+    }
+    if (_renderQueue != nullptr) vQueueDelete(_renderQueue);
+    _renderQueue = nullptr;
+    _renderTask = nullptr;
+  }
+  if (_debug) spf("beginRenderTask: %s (core %d, DMA buffer %u bytes x2)\n", (res ? "ok" : "failed"), core, bufSize);
+  return res;
+}
+
+// 描画タスクがキューにある出力を終えるまで待つ
+void DinMeterUI::waitRender() {
+  if (_renderTask == nullptr || xTaskGetCurrentTaskHandle() == _renderTask) return;
+  while (_renderPending > 0) vTaskDelay(1);
+}
+
+// 描画タスクに出力コマンドを送る（キューが一杯なら空くまで待つ）
+void DinMeterUI::queueRender(UiPanel panel, int x, int y, int w, int h) {
+  UiRenderCmd cmd = { UI_RENDER_RECT, panel, (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h };
+  _renderPending++;
+  xQueueSend(_renderQueue, &cmd, portMAX_DELAY);
+}
+
+// バックバッファの矩形をDMAで画面に出力する（描画タスク）
+//   2本の転送用バッファを交互に使い、片方をDMAで転送している間にもう片方へ次の行をコピーする
+void DinMeterUI::renderRect(const UiRenderCmd& cmd) {
+  M5Canvas* canvas = &_panels[cmd.panel];
+  const uint16_t* src = (const uint16_t*)canvas->getBuffer();
+  if (src == nullptr) return;
+  XYaddress xy = panelXY(cmd.panel);
+  int pw = canvas->width();
+  int rows = (mwh.w * dmaRows) / cmd.w;   // 1回に転送する行数
+  _dst->setAddrWindow(xy.x+cmd.x, xy.y+cmd.y, cmd.w, cmd.h);
+  int flip = 0;
+  for (int y=0; y<cmd.h; y+=rows) {
+    int n = (cmd.h - y < rows) ? cmd.h - y : rows;
+    uint16_t* buf = _dmaBuffer[flip];
+    for (int r=0; r<n; r++) {
+      memcpy(buf + r * cmd.w, src + (cmd.y + y + r) * pw + cmd.x, cmd.w * 2);
+    }
+    _dst->waitDMA();  // もう片方のバッファの転送が終わるのを待つ
+    _dst->writePixelsDMA((const lgfx::swap565_t*)buf, cmd.w * n);
+    flip ^= 1;
+  }
+  _dst->waitDMA();
+}
+
+// 描画タスク（キューから出力コマンドを取り出して画面に出力する）
+void DinMeterUI::renderTask(void* arg) {
+  DinMeterUI* ui = static_cast<DinMeterUI*>(arg);
+  UiRenderCmd cmd;
+  while (true) {
+    if (xQueueReceive(ui->_renderQueue, &cmd, portMAX_DELAY) != pdTRUE) continue;
+    int done = 0;
+    ui->lockCanvas();
+    ui->_dst->startWrite();
+    do {  // 溜まっているコマンドはまとめて出力する
+      if (cmd.op == UI_RENDER_STATUS) {
+        ui->_statusPosted = false;   // 描き始めた後の変化は、もう一度通知してもらう
+        ui->renderStatusPanel(ui->_statusSrc);
+      }
+      ui->renderRect(cmd);
+      done++;
+    } while (xQueueReceive(ui->_renderQueue, &cmd, 0) == pdTRUE);
+    ui->_dst->endWrite();
+    ui->unlockCanvas();
+    ui->heapSample();   // 描画タスクで出力したときも、まとめて出力するたびに記録する
+    ui->_renderPending -= done;
+  }
+}
+
+// 空きヒープと最大の連続空き領域の最小値を記録する
+void DinMeterUI::heapSample() {
+  uint32_t freeSize = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  uint32_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  if (freeSize < _heap.minFree) _heap.minFree = freeSize;
+  if (largest < _heap.minLargest) _heap.minLargest = largest;
+  _heap.lastLargest = largest;
+  _heap.samples ++;
+}
+
+// ヒープの監視結果をシリアルに出力する
+void DinMeterUI::printHeapStats() {
+  spf("UI heap: free min=%u, largest block min=%u now=%u (%u samples)\n",
+    _heap.minFree, _heap.minLargest, _heap.lastLargest, _heap.samples);
+}
+
+// 画面への転送量の集計をリセットする
+void DinMeterUI::resetPushStats() {
+  _push = UiPushStats();
+}
+
+// 1フレームあたりの転送量を、全体を送った場合(fullBytes)と比べてシリアルに出力する
+void DinMeterUI::printPushStats(uint32_t fullBytes) {
+  uint32_t avg = (_push.frames > 0) ? _push.totalBytes / _push.frames : 0;
+  spf("UI push: %u frames, avg %u bytes/frame (full %u bytes/frame)\n", _push.frames, avg, fullBytes);
+}
+
+// 部品の登録を消して、以降の部品をこのパネルに置く
+void DinMeterUI::widgetsBegin(UiPanel panel) {
+  _widgetCount = 0;
+  _widgetPanel = panel;
+}
+
+// 部品を登録する（部品の番号を返す。登録できなければ-1）
+int DinMeterUI::widgetAdd(int x, int y, int w, int h, uint16_t bgColor) {
+  if (_widgetCount >= UI_WIDGET_MAX) return -1;
+  _widgets[_widgetCount] = { (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h, bgColor, 0, true, false };
+  return _widgetCount++;
+}
+
+// 状態が前回と違えば、背景を塗って描画範囲を部品に限定する（描き直すときtrue）
+//   trueを返したときはバックバッファをロックしているので、描き終わったらwidgetEnd()で解除する
+bool DinMeterUI::widgetBegin(int id, uint32_t state) {
+  if (id < 0 || id >= _widgetCount) return false;
+  UiWidget& wg = _widgets[id];
+  if (!wg.dirty && wg.state == state) return false;
+  wg.state = state;
+  wg.dirty = false;
+  wg.changed = true;
+  lockPanel();
+  M5Canvas* canvas = &_panels[_widgetPanel];
+  canvas->setClipRect(wg.x, wg.y, wg.w, wg.h);
+  canvas->fillRect(wg.x, wg.y, wg.w, wg.h, wg.bgColor);
+  return true;
+}
+
+// 描画範囲の限定とバックバッファのロックを解除する
+void DinMeterUI::widgetEnd(int id) {
+  _panels[_widgetPanel].clearClipRect();
+  unlockPanel();
+}
+
+// 全部品を描き直す（パネル全体を描き直したときなど）
+void DinMeterUI::widgetsInvalidate() {
+  for (int i=0; i<_widgetCount; i++) _widgets[i].dirty = true;
+}
+
+// 描き直した部品の矩形だけ画面に出力して、1フレームとして集計する
+void DinMeterUI::widgetsPush() {
+  for (int i=0; i<_widgetCount; i++) {
+    UiWidget& wg = _widgets[i];
+    if (!wg.changed) continue;
+    pushPanelRect(_widgetPanel, wg.x, wg.y, wg.w, wg.h);
+    wg.changed = false;
+  }
+  _push.lastFrameBytes = _push.frameBytes;
+  _push.totalBytes += _push.frameBytes;
+  _push.frameBytes = 0;
+  _push.frames ++;
+}
+
+// 状態のハッシュ（FNV-1a）
+uint32_t DinMeterUI::widgetHash(const void* data, size_t len, uint32_t hash) {
+  const uint8_t* p = (const uint8_t*)data;
+  for (size_t i=0; i<len; i++) {
+    hash ^= p[i];
+    hash *= 16777619UL;
+  }
+  return hash;
 }
 
 // ボタン押下判定
@@ -46,14 +329,106 @@ bool DinMeterUI::m5BtnAwasReleased() {
   return res;
 }
 
+// 画像データの情報（範囲外ならnullptr）
+const DinMeterUI::ImageInfo* DinMeterUI::imageInfo(uint8_t no) {
+  if (no >= sizeof(imgInfo) / sizeof(imgInfo[0])) return nullptr;
+  return &imgInfo[no];
+}
+
+// 圧縮した画像の1行を展開する（次の行の先頭を返す）
+//   ヘッダー1バイトの最上位ビットが1なら連続: 下位7ビット+1個の画素が、次の1バイトのパレット番号
+//   0なら非連続: 下位7ビット+1個のパレット番号が続く。swap=trueならスプライトのバッファと同じバイト順にする
+const uint8_t* DinMeterUI::decodeImageRow(const uint8_t* src, const uint16_t* palette, uint16_t* dst, int w, bool swap) {
+  int n = 0;
+  while (n < w) {
+    uint8_t hdr = *src++;
+    int cnt = (hdr & 0x7F) + 1;
+    if (hdr & 0x80) {
+      uint16_t color = palette[*src++];
+      if (swap) color = __builtin_bswap16(color);
+      for (int i=0; i<cnt && n<w; i++) dst[n++] = color;
+    } else {
+      for (int i=0; i<cnt; i++) {
+        uint16_t color = palette[*src++];
+        if (n < w) dst[n++] = swap ? __builtin_bswap16(color) : color;
+      }
+    }
+  }
+  return src;
+}
+
+// 画像を描く（圧縮した画像は1行ずつ展開する）
+void DinMeterUI::drawImage(LovyanGFX* dst, int x, int y, uint8_t no) {
+  const ImageInfo* img = imageInfo(no);
+  if (img == nullptr) return;
+  if (img->rle == nullptr) {
+    dst->pushImage(x,y, img->width, img->height, img->data);
+    return;
+  }
+  if (img->width > UI_IMAGE_MAX_WIDTH) return;
+  uint16_t line[UI_IMAGE_MAX_WIDTH];
+  const uint8_t* src = img->rle;
+  dst->startWrite();
+  for (int row=0; row<img->height; row++) {
+    src = decodeImageRow(src, img->palette, line, img->width, false);
+    dst->pushImage(x,y+row, img->width, 1, line);
+  }
+  dst->endWrite();
+}
+
+// 画像をバックバッファに描く（収まるときはバッファに直接展開する）
+//   描画範囲の内側に収まっていれば、展開した画素をスプライトのバッファの行に直接書く
+void DinMeterUI::drawImage(M5Canvas* canvas, int x, int y, uint8_t no) {
+  const ImageInfo* img = imageInfo(no);
+  uint16_t* buf = (uint16_t*)canvas->getBuffer();
+  if (img == nullptr) return;
+  int32_t cx, cy, cw, ch;
+  canvas->getClipRect(&cx, &cy, &cw, &ch);
+  if (img->rle == nullptr || buf == nullptr || canvas->getColorDepth() != 16
+      || x < cx || y < cy || x + img->width > cx + cw || y + img->height > cy + ch) {
+    drawImage((LovyanGFX*)canvas, x, y, no);
+    return;
+  }
+  int stride = canvas->width();
+  const uint8_t* src = img->rle;
+  for (int row=0; row<img->height; row++) {
+    src = decodeImageRow(src, img->palette, buf + (y + row) * stride + x, img->width, true);
+  }
+}
+
 // 左パネル（ステータス表示）を描画する
+//   描画タスクも同じバックバッファに描くので、描き終わるまでロックする
 void DinMeterUI::drawStatusPanel(StatusInfo* st) {
+  lockCanvas();
+  renderStatusPanel(st);
+  unlockCanvas();
+  pushPanel(UI_PANEL_STATUS);
+}
+
+// 左パネルの描き直しを描画タスクに頼む（Tickerから呼ぶ）
+//   Tickerのコールバックでは描かずに通知だけして、描画と出力は描画タスクにまとめる
+//   まだ描いていない通知があれば、その描き直しで最新の状態が描かれるので何もしない
+void DinMeterUI::postStatus(StatusInfo* st) {
+  if (st == nullptr) return;
+  _statusSrc = st;
+  if (_renderTask == nullptr) {   // 描画タスクがなければ、ロックを取ってその場で描く
+    drawStatusPanel(st);
+    return;
+  }
+  if (_statusPosted.exchange(true)) return;
+  UiRenderCmd cmd = { UI_RENDER_STATUS, UI_PANEL_STATUS, 0, 0, (int16_t)swh.w, (int16_t)swh.h };
+  _renderPending++;
+  if (xQueueSend(_renderQueue, &cmd, 0) != pdTRUE) {   // キューが一杯なら次の通知に任せる
+    _renderPending--;
+    _statusPosted = false;
+  }
+}
+
+// 左パネルをバックバッファに描く（ロックは呼び出し側で取る）
+void DinMeterUI::renderStatusPanel(StatusInfo* st) {
   uint8_t iconList[5];
   int x,y;
-  // canvasの作成
-  M5Canvas canvas(_dst);
-  canvas.setColorDepth(16);
-  canvas.createSprite(swh.w, swh.h);
+  M5Canvas& canvas = *panelCanvas(UI_PANEL_STATUS);
   canvas.fillRect(0,0, swh.w,swh.h, PCOL_STATUS);
   // 表示するアイコンの選択
   iconList[0] = (st->unlock) ? ICON_unlock_on : ICON_lock_off;
@@ -67,7 +442,7 @@ void DinMeterUI::drawStatusPanel(StatusInfo* st) {
     y = sxy.y + 3 + i*(24+2);
     if (iconList[i] != ICON_none) {
       int no = iconList[i];
-      canvas.pushImage(x,y, imgInfo[no].width, imgInfo[no].height, imgInfo[no].data);
+      drawImage(&canvas, x,y, no);
     } else {
       canvas.drawRect(x,y, 24,24, TFT_BLUE);      
     }
@@ -81,22 +456,15 @@ void DinMeterUI::drawStatusPanel(StatusInfo* st) {
   y += 4;
   auto color = (st->battery < 30) ? TFT_RED : TFT_GREEN;
   canvas.fillRect(x,y, 6,4, color);
-  // canvasの出力
-  lockCanvas();
-  _dst->startWrite(); 
-  canvas.pushSprite(sxy.x, sxy.y);
-  _dst->endWrite();
-  unlockCanvas();
 }
 
 // 右パネル（ロータリー表示）を描画する
 void DinMeterUI::drawRotaryPanel(MenuDef* menu) {
   int num, idx, x, y, no;
   num = menu->lists.size();
-  // canvasの作成
-  M5Canvas canvas(_dst);
-  canvas.setColorDepth(16);
-  canvas.createSprite(rwh.w, rwh.h);
+  // canvasの準備（描き終わるまでバックバッファをロックする）
+  lockPanel();
+  M5Canvas& canvas = *panelCanvas(UI_PANEL_ROTARY);
   canvas.fillSprite(PCOL_ROTARY);
   // アイコンを表示
   for (int i=0; i<num; i++) {
@@ -107,15 +475,12 @@ void DinMeterUI::drawRotaryPanel(MenuDef* menu) {
     }
     if (menu->lists[i].icon != ICON_none) {
       no = menu->lists[i].icon;
-      canvas.pushImage(x,y, imgInfo[no].width, imgInfo[no].height, imgInfo[no].data);
+      drawImage(&canvas, x,y, no);
     }
   }
   // canvasの出力
-  lockCanvas();
-  _dst->startWrite(); 
-  canvas.pushSprite(rxy.x, rxy.y);
-  _dst->endWrite();
-  unlockCanvas();
+  unlockPanel();
+  pushPanel(UI_PANEL_ROTARY);
 }
 
 // メインパネルを描画する　選択前の情報表示用
@@ -123,10 +488,9 @@ void DinMeterUI::drawMainPanel_preview(MenuDef* menu) {
   int x, y, w, h, y2, no;
   no = menu->select;
   if (no < 0 || no >= (int)menu->lists.size()) return;
-  // canvasの作成
-  M5Canvas canvas(_dst);
-  canvas.setColorDepth(16);
-  canvas.createSprite(mwh.w, mwh.h);
+  // canvasの準備（描き終わるまでバックバッファをロックする）
+  lockPanel();
+  M5Canvas& canvas = *panelCanvas(UI_PANEL_MAIN);
   canvas.fillSprite(PCOL_MAIN);
   // タイトル
   h = 22;
@@ -141,11 +505,8 @@ void DinMeterUI::drawMainPanel_preview(MenuDef* menu) {
   drawTextBox(&canvas, 40,mwh.h-h-12, 80,h, rgb565(0x888888), 
     40,2, TC_DATUM, BoldFont, TFT_BLACK, "決定");
   // canvasの出力
-  lockCanvas();
-  _dst->startWrite(); 
-  canvas.pushSprite(mxy.x, mxy.y);
-  _dst->endWrite();
-  unlockCanvas();
+  unlockPanel();
+  pushPanel(UI_PANEL_MAIN);
 }
 
 // メインパネルを描画する　縦スクロールの項目選択
@@ -153,10 +514,9 @@ void DinMeterUI::drawMainPanel_vselect(MenuDef* menu, int orig, int boxnum, Stri
   int x, y, w, h, y2;
   if (menu->select < 0 || menu->select >= (int)menu->lists.size()) menu->select = 0;
   const uint16_t infoSize = 15;
-  // canvasの作成
-  M5Canvas canvas(_dst);
-  canvas.setColorDepth(16);
-  canvas.createSprite(mwh.w, mwh.h);
+  // canvasの準備（描き終わるまでバックバッファをロックする）
+  lockPanel();
+  M5Canvas& canvas = *panelCanvas(UI_PANEL_MAIN);
   canvas.fillSprite(PCOL_MAIN);
   // タイトル
   if (menu->title.length() > 0) {
@@ -187,11 +547,8 @@ void DinMeterUI::drawMainPanel_vselect(MenuDef* menu, int orig, int boxnum, Stri
       4,2, TL_DATUM, BoldFont, TFT_WHITE, menu->lists[menu->idx+i].name);
   }
   // canvasの出力
-  lockCanvas();
-  _dst->startWrite(); 
-  canvas.pushSprite(mxy.x, mxy.y);
-  _dst->endWrite();
-  unlockCanvas();
+  unlockPanel();
+  pushPanel(UI_PANEL_MAIN);
 }
 
 // メインパネルを描画する　ダイアログ
@@ -199,10 +556,9 @@ void DinMeterUI::drawMainPanel_dialog(MenuDef* menu, int orig, String descriptio
   int x, y, w, h, y2;
   if (menu->select < 0 || menu->select >= (int)menu->lists.size()) menu->select = 0;
   const uint16_t infoSize = 15;
-  // canvasの作成
-  M5Canvas canvas(_dst);
-  canvas.setColorDepth(16);
-  canvas.createSprite(mwh.w, mwh.h);
+  // canvasの準備（描き終わるまでバックバッファをロックする）
+  lockPanel();
+  M5Canvas& canvas = *panelCanvas(UI_PANEL_MAIN);
   canvas.fillSprite(PCOL_MAIN);
   // 文字列の横幅を推定する
   const int spcb = 10;
@@ -242,11 +598,8 @@ void DinMeterUI::drawMainPanel_dialog(MenuDef* menu, int orig, String descriptio
     x += w + spcb;
   }
   // canvasの出力
-  lockCanvas();
-  _dst->startWrite(); 
-  canvas.pushSprite(mxy.x, mxy.y);
-  _dst->endWrite();
-  unlockCanvas();
+  unlockPanel();
+  pushPanel(UI_PANEL_MAIN);
 }
 
 // 32bit RGBから16bit RGB565に変換する
@@ -262,20 +615,25 @@ uint16_t DinMeterUI::rgb565(uint32_t rgb) {
 
 // 描画エリアを限定する
 void DinMeterUI::setStringArea(int x, int y, int w, int h, bool scr) {
+  lockCanvas();
   _dst->setClipRect(x, y, w, h);  //描画範囲
   _dst->setScrollRect(x, y, w, h);  //スクロール範囲
   _dst->setTextScroll(scr);
+  unlockCanvas();
 }
 
 // 描画エリアの限定を解除する
 void DinMeterUI::clearStringArea() {
+  lockCanvas();
   _dst->clearClipRect();
   _dst->clearScrollRect();
   _dst->setTextScroll(false);
+  unlockCanvas();
 }
 
 // ミニコンソール領域を作成する
 void DinMeterUI::setConsoleArea(int x, int y, int w, int h) {
+  lockCanvas();
   _dst->drawRect(x,y, w,h, rgb565(0x444444));
   _dst->fillRect(x+1,y+1, w-2,h-2, TFT_BLACK);
   //setStringArea(x+3,y+2, w-6,h-3, true);
@@ -284,39 +642,39 @@ void DinMeterUI::setConsoleArea(int x, int y, int w, int h) {
   _dst->setTextColor(TFT_WHITE);
   _dst->setTextDatum(TL_DATUM);
   _dst->setCursor(x+2, y+1);
+  unlockCanvas();
 }
 
 // ミニコンソール領域を解除する
 void DinMeterUI::clearConsoleArea() {
+  lockCanvas();
   _dst->clearScrollRect();
   _dst->setTextScroll(false);
+  unlockCanvas();
 }
 
 // テキストボックスを描画する
+//   子canvasは作らず、描画範囲をボックスに限定して親canvasに直接描く
 void DinMeterUI::drawTextBox(M5Canvas* _parent, int x, int y, int w, int h, uint16_t bgColor, 
 int fx, int fy, uint8_t textDatum, const lgfx::IFont *font, uint16_t textColor, String text, bool scr) {
-  // canvasの作成
-  M5Canvas box(_parent);
-  box.setColorDepth(16);
-  box.createSprite(w, h);
-  box.fillSprite(bgColor);
-  // ボックスとテキストを描画する
-  box.setTextColor(textColor);
+  _parent->setClipRect(x, y, w, h);  //描画範囲
+  _parent->fillRect(x, y, w, h, bgColor);
+  // テキストを描画する
+  _parent->setTextColor(textColor);
   if (textDatum == TL_DATUM) {
-    box.setScrollRect(fx, fy, w-fx*2, h-fy*2);  //テキストスクロール範囲
-    if (scr) box.setTextScroll(scr);
-    box.setFont(font);
-    box.setCursor(fx, fy);
-    box.print(text);
-    if (scr) box.setTextScroll(false);
-    box.clearScrollRect();
+    _parent->setScrollRect(x+fx, y+fy, w-fx*2, h-fy*2);  //テキストスクロール範囲
+    if (scr) _parent->setTextScroll(scr);
+    _parent->setFont(font);
+    _parent->setCursor(x+fx, y+fy);
+    _parent->print(text);
+    if (scr) _parent->setTextScroll(false);
+    _parent->clearScrollRect();
   } else {
-    box.setTextDatum(textDatum);
-    box.drawString(text, fx,fy, font);
-    box.setTextDatum(TL_DATUM);
+    _parent->setTextDatum(textDatum);
+    _parent->drawString(text, x+fx,y+fy, font);
+    _parent->setTextDatum(TL_DATUM);
   }
-  // canvasの出力
-  box.pushSprite(x, y);
+  _parent->clearClipRect();
 }
 
 // エンコーダーを回したらメニューの表示位置(.select)を変更する
@@ -457,13 +815,9 @@ void DinMeterUI::imageNotice(uint8_t no, String title, bool skipPress) {
   int desch = mxy.y -btny;
   selectDialog(texts, 0, title, "", desch, true);
   // 画像の表示
-  if (no != ICON_none) {
-    XYaddress pp;
-    pp.x = mxy.x + (mwh.w - imgInfo[no].width) / 2;
-    pp.y = mxy.y + (mwh.h - imgInfo[no].height - btny) / 2;
-    lockCanvas();
-    _dst->pushImage(pp.x,pp.y, imgInfo[no].width, imgInfo[no].height, imgInfo[no].data);
-    unlockCanvas();
+  const ImageInfo* img = imageInfo(no);
+  if (img != nullptr) {
+    imageNoticeUpdate(no);
     // ボタン押下
     while (!skipPress) {
       M5.update();
@@ -474,6 +828,21 @@ void DinMeterUI::imageNotice(uint8_t no, String title, bool skipPress) {
   return;
 }
 
+// 画像のダイアログボックスの画像だけを差し替える（imageNotice()で表示した後、同じ大きさの画像で点滅させる用）
+//   ダイアログは描き直さず、メインパネルのバックバッファの画像の範囲だけに展開して、その範囲だけ出力する
+void DinMeterUI::imageNoticeUpdate(uint8_t no) {
+  const int btny = 10 + 2;
+  const ImageInfo* img = imageInfo(no);
+  if (img == nullptr) return;
+  XYaddress pp;
+  pp.x = (mwh.w - img->width) / 2;
+  pp.y = (mwh.h - img->height - btny) / 2;
+  lockPanel();
+  drawImage(panelCanvas(UI_PANEL_MAIN), pp.x,pp.y, no);
+  unlockPanel();
+  pushPanelRect(UI_PANEL_MAIN, pp.x,pp.y, img->width, img->height);
+}
+
 
 
 
@@ -8,26 +8,54 @@
 */
 #pragma once
 #include <M5DinMeter.h>
+#include <atomic>
 #include "common.h"
 
-struct ItemDef {  // メニューアイテムの構造体
-  uint8_t type;
-  uint8_t icon;
-  String name;
-  bool (*function)();
-  String description;
+struct XYaddress { int x, y; };
+struct WHaddress { int w, h; };
+
+enum UiPanel : uint8_t {  // バックバッファ（起動時に確保して使い回す）
+  UI_PANEL_STATUS,  // 左パネル
+  UI_PANEL_ROTARY,  // 右パネル
+  UI_PANEL_MAIN,    // メインパネル
+  UI_PANEL_COUNT
+};
+
+#define UI_RENDER_QUEUE_LEN  16  // 描画タスクへの出力コマンドのキューの長さ
+enum UiRenderOp : uint8_t {  // 描画タスクへの出力コマンドの種類
+  UI_RENDER_RECT,    // バックバッファの矩形を画面に出力する
+  UI_RENDER_STATUS,  // 左パネルを描き直して画面に出力する（Tickerからの状態変化の通知）
 };
-struct MenuDef {  // メニューの構造体
-  String title;
-  int select;
-  int selected;
-  int idx;
-  int cur;
-  std::vector<ItemDef> lists;
+struct UiRenderCmd {  // 描画タスクへの出力コマンド
+  UiRenderOp op;
+  UiPanel panel;
+  int16_t x, y, w, h;   // パネル内の範囲
 };
 
-struct XYaddress { int x, y; };
-struct WHaddress { int w, h; };
+#define UI_IMAGE_MAX_WIDTH  240  // 1行ずつ展開して描ける画像の最大幅（画面の幅）
+
+#define UI_WIDGET_MAX  8  // 保持型の描画で登録できる部品の数
+struct UiWidget {  // 保持型の描画の部品（前回描いた状態を覚えておき、変化したときだけ描き直す）
+  int16_t x, y, w, h;   // パネル内の範囲
+  uint16_t bgColor;     // 描き直す前に塗る背景色
+  uint32_t state;       // 前回描いた状態（widgetHash()の値）
+  bool dirty;           // 状態に関係なく描き直す
+  bool changed;         // 描き直したので出力が必要
+};
+
+struct UiPushStats {  // 画面への転送量（SPIで送ったバイト数）
+  uint32_t frameBytes = 0;      // 今のフレームで送ったバイト数
+  uint32_t lastFrameBytes = 0;  // 前のフレームで送ったバイト数
+  uint32_t totalBytes = 0;      // 送ったバイト数の合計
+  uint32_t frames = 0;          // フレーム数
+};
+
+struct UiHeapStats {  // ヒープの監視（描画のたびに断片化が進んでいないかの確認用）
+  uint32_t minFree = UINT32_MAX;     // 空きヒープの最小値
+  uint32_t minLargest = UINT32_MAX;  // 最大の連続空き領域の最小値
+  uint32_t lastLargest = 0;          // 最後に調べた最大の連続空き領域
+  uint32_t samples = 0;              // 調べた回数
+};
 
 // struct TextBoxOption {  // テキストボックス描画オプション
 //   bool fillBg = true;
@@ -50,20 +78,35 @@ struct WHaddress { int w, h; };
 class DinMeterUI {
 public:
   struct ImageInfo {  // 画像データの構造体
-    const unsigned short* data;
+    const unsigned short* data;   // RGB565の画素（圧縮した画像はnullptr）
     const uint16_t width;
     const uint16_t height;
     const uint16_t size;
     const uint16_t posX;
     const uint16_t posY;
     const unsigned short transparent;
+    const uint8_t* rle = nullptr;       // パレット番号のランレングス圧縮（tools/icon_rle.pyの形式）
+    const uint16_t* palette = nullptr;  // 圧縮した画像のパレット
   };
 
   LovyanGFX* _dst = nullptr;    // 出力先のキャンバスまたはディスプレイ
-  bool _dstLock = false;        // 出力先のキャンバスのロック状態
+  SemaphoreHandle_t _dstMutex = nullptr;  // 出力先のキャンバスのロック（再帰ミューテックス）
   uint16_t _bgColor = 0x0001;   // 出力時の透明色（使ってない）
   int _lastEncPos = 0;          // ロータリーエンコーダーの最終位置
   bool _debug = true;           // シリアルデバッグ出力
+  M5Canvas _panels[UI_PANEL_COUNT];  // 各パネルのバックバッファ
+  UiHeapStats _heap;            // ヒープの監視
+  UiPushStats _push;            // 画面への転送量
+  UiWidget _widgets[UI_WIDGET_MAX];  // 保持型の描画の部品
+  uint8_t _widgetCount = 0;     // 登録した部品の数
+  UiPanel _widgetPanel = UI_PANEL_MAIN;  // 部品を置くパネル
+  QueueHandle_t _renderQueue = nullptr;  // 描画タスクへの出力コマンド
+  TaskHandle_t _renderTask = nullptr;    // 描画タスク（もう一方のコアで画面に出力する）
+  std::atomic<int> _renderPending{0};    // キューに入れて、まだ出力し終わっていないコマンドの数
+  StatusInfo* _statusSrc = nullptr;      // Tickerから通知された、左パネルに表示する状態
+  std::atomic<bool> _statusPosted{false}; // 左パネルの描き直しをキューに入れて、まだ描いていない
+  uint16_t* _dmaBuffer[2] = { nullptr, nullptr };  // DMA転送用のバッファ（転送中でない方に次の行をコピーする）
+  const int dmaRows = 16;       // DMA転送用のバッファ1本の行数（メインパネル幅で）
 
   // 各パネルの基準座標
   const WHaddress m5wh = { 240, 135 };    // M5 DinMeter
@@ -95,9 +138,35 @@ public:
   DinMeterUI();
   ~DinMeterUI() = default;
   void setDrawDisplay(LovyanGFX* dst, uint16_t bgColor);  // UIの出力先を設定する
-  void lockCanvas(uint32_t timeout=1000);   // 上位Canvasの出力可能な状態になるまで待つ
+  bool lockCanvas(uint32_t timeout=UINT32_MAX);   // 上位Canvasの出力可能な状態になるまで待つ（timeoutミリ秒で取れなければfalse）
   void unlockCanvas();   // 上位Canvasの出力ロックを解除する
+  bool lockPanel(uint32_t timeout=UINT32_MAX);   // バックバッファに描く間、描画タスクのコピーと重ならないようにロックする（キューの出力は待たない）
+  void unlockPanel();    // バックバッファのロックを解除する
   bool m5BtnAwasReleased();  // ボタン押下判定
+  bool beginSprites();       // 各パネルのバックバッファを確保する
+  M5Canvas* panelCanvas(UiPanel panel);   // パネルのバックバッファを取得する（未確保なら確保する）
+  XYaddress panelXY(UiPanel panel);   // パネルの画面上の位置
+  void pushPanel(UiPanel panel, int y=0, int h=-1);   // バックバッファのy行目からh行分を画面に出力する
+  void pushPanelRect(UiPanel panel, int x, int y, int w, int h);   // バックバッファの矩形だけを画面に出力する
+  bool beginRenderTask(int core=0);   // 描画タスクを起動する（以降の出力はキューに入れてすぐに戻る）
+  void waitRender();         // 描画タスクがキューにある出力を終えるまで待つ
+  void queueRender(UiPanel panel, int x, int y, int w, int h);   // 描画タスクに出力コマンドを送る
+  void renderRect(const UiRenderCmd& cmd);   // バックバッファの矩形をDMAで画面に出力する（描画タスク）
+  static void renderTask(void* arg);   // 描画タスク
+  void heapSample();         // 空きヒープと最大の連続空き領域の最小値を記録する
+  void printHeapStats();     // ヒープの監視結果をシリアルに出力する
+  void resetPushStats();     // 画面への転送量の集計をリセットする
+  void printPushStats(uint32_t fullBytes);   // 1フレームあたりの転送量を、全体を送った場合(fullBytes)と比べてシリアルに出力する
+
+  // 保持型の描画（部品ごとに状態を覚えておき、変化した部品だけ描き直して、その矩形だけ画面に出力する）
+  void widgetsBegin(UiPanel panel);   // 部品の登録を消して、以降の部品をこのパネルに置く
+  int widgetAdd(int x, int y, int w, int h, uint16_t bgColor=TFT_BLACK);   // 部品を登録する（部品の番号を返す）
+  bool widgetBegin(int id, uint32_t state);   // 状態が前回と違えば、背景を塗って描画範囲を部品に限定する（描き直すときtrue）
+  void widgetEnd(int id);     // 描画範囲の限定を解除する
+  void widgetsInvalidate();   // 全部品を描き直す（パネル全体を描き直したときなど）
+  void widgetsPush();         // 描き直した部品の矩形だけ画面に出力して、1フレームとして集計する
+  static uint32_t widgetHash(const void* data, size_t len, uint32_t hash=2166136261UL);  // 状態のハッシュ（FNV-1a）
+  static uint32_t widgetHash(const char* str, uint32_t hash=2166136261UL) { return widgetHash(str, strlen(str), hash); }
 
   // コールバック
   typedef void (*CallbackFunc)();
@@ -106,8 +175,16 @@ public:
   void setEncoderCallback(CallbackFunc func) { _callbackEnc = func; }  // ロータリーエンコーダーのコールバック
   void setButtonFunction(CallbackFunc func) { _callbackBtn = func; }  // ボタン押下のコールバック
 
+  // 画像
+  const ImageInfo* imageInfo(uint8_t no);   // 画像データの情報（範囲外ならnullptr）
+  static const uint8_t* decodeImageRow(const uint8_t* src, const uint16_t* palette, uint16_t* dst, int w, bool swap);  // 圧縮した画像の1行を展開する
+  void drawImage(LovyanGFX* dst, int x, int y, uint8_t no);   // 画像を描く（圧縮した画像は1行ずつ展開する）
+  void drawImage(M5Canvas* canvas, int x, int y, uint8_t no); // 画像をバックバッファに描く（収まるときはバッファに直接展開する）
+
   // 描画系
   void drawStatusPanel(StatusInfo* st);   // 左パネル（ステータス表示）を描画する
+  void postStatus(StatusInfo* st);        // 左パネルの描き直しを描画タスクに頼む（Tickerから呼ぶ）
+  void renderStatusPanel(StatusInfo* st); // 左パネルをバックバッファに描く（ロックは呼び出し側で取る）
   void drawRotaryPanel(MenuDef* menu);    // 右パネル（ロータリー表示）を描画する
   void drawMainPanel_preview(MenuDef* menu);    // メインパネルを描画する　選択前の情報表示用
   void drawMainPanel_vselect(MenuDef* menu, int orig, int boxnum, String description="", int desch=0);    // メインパネルを描画する　縦スクロールの項目選択
@@ -119,7 +196,7 @@ public:
   void clearStringArea();   // 描画エリアの限定を解除する
   void setConsoleArea(int x, int y, int w, int h);  // ミニコンソール領域を作成する
   void clearConsoleArea();  // ミニコンソール領域を解除する
-  void drawTextBox(M5Canvas* _parent, int x, int y, int w, int h, uint16_t bgColor, int fx, int fy, uint8_t textDatum, const lgfx::IFont *font, uint16_t textColor, String text, bool scr=false);   // テキストボックスを描画する
+  void drawTextBox(M5Canvas* _parent, int x, int y, int w, int h, uint16_t bgColor, int fx, int fy, uint8_t textDatum, const lgfx::IFont *font, uint16_t textColor, String text, bool scr=false);   // テキストボックスを親canvasに直接描画する
 
   // 操作系
   int encoderChanged(MenuDef* menu, bool looped, bool reverse=false);   // エンコーダーを回したらメニューの表示位置(.select)を変更する
@@ -128,4 +205,5 @@ public:
   int selectDialog(const std::vector<String>& texts, int orig, String title, String description="", int desch=0, bool skipPress=false);   // ダイアログ形式のメニューを選択する
   int selectNotice(String btntext, String title, String description, int desch, bool skipPress=false);    // 1ボタンだけのダイアログボックスを表示する
   void imageNotice(uint8_t no, String title, bool skipPress);   // 画像のダイアログボックスを表示する
+  void imageNoticeUpdate(uint8_t no);   // 画像のダイアログボックスの画像だけを差し替える（点滅用）
 };
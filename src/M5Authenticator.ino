@@ -83,7 +83,7 @@ MFRC522_I2C_Extend mfrc522(M5UNIT_RFID2_ADDR, -1, &Wire); // デバイスアド
 NfcEasyWriter nfc(mfrc522);  // nfcwriter オブジェクトのインスタンス化
 
 // TOTP関連
-#include <TOTP.h>
+#include "TotpGenerator.h"
 
 // Ticker関連
 #include <Ticker.h>
@@ -96,7 +96,7 @@ bool tickerUpdateUISkip = false;
 StatusInfo status;  // ステータス情報
 ConfigInfo conf;    // 設定情報
 AuthKey passwdNfc;  // NFCのパスワード
-String nextOtpFilename; // OTP追加後に表示するファイル名
+int nextOtpSlot = -1;   // OTP追加後に表示するOTPの位置
 int8_t pinSda, pinScl;  // GPIOポート SDA SCL
 uint32_t wctPastTime = 0;  // 無操作カウンター(ms)
 bool autoSleepEnable = true;  // 無操作自動スリープの有効化
@@ -106,8 +106,11 @@ String webAuthPasswd;  //
 // サブルーチン
 #include "function.h"
 #include "totputil.h"
+#include "otpvault.h"
 #include "utility.h"
+#include "keyshard.h"
 #include "webserver.h"
+#include "benchmark.h"
 
 
 // =================================================================================
@@ -132,6 +135,7 @@ void tickerBleConnectionMonitor() {
 // 無操作カウンター　更新
 void wctInterrupt() {
   wctPastTime = 0;
+  unlockSessionTouch();   // 解錠セッションの無操作タイマーも更新
 }
 
 // 無操作カウンター　定期処理  Ticker 1000ms
@@ -165,7 +169,7 @@ bool m5BtnAwasReleased() {
   return res;
 }
 
-// UIステータスの更新　変化があったときだけ描画更新  Ticker 500ms
+// UIステータスの更新　変化があったときだけ描画タスクに描き直しを通知する  Ticker 500ms
 void tickerRefreshStatusInfo() {
   if (tickerUpdateUISkip) return;
   static bool lastUnlock = status.unlock;
@@ -194,7 +198,7 @@ void tickerRefreshStatusInfo() {
   lastBattery = status.battery;
   // UI更新
   if (refresh) {
-    ui.drawStatusPanel(&status);  // UI左描画
+    ui.postStatus(&status);  // UI左描画（Tickerでは描かない）
   }
 }
 
@@ -236,6 +240,8 @@ void setup() {
   // UIの設定
   ui._debug = debug;
   ui.setDrawDisplay(&DinMeter.Display, 0x000001);   // 出力先、透過色(未使用)
+  ui.beginSprites();   // 各パネルのバックバッファを確保する（以降の描画ではヒープを確保しない）
+  ui.beginRenderTask(0);   // 画面への出力はCore0の描画タスクで行う（loop()はCore1）
   tickerUpdateUI.attach_ms(500, tickerRefreshStatusInfo);
   console("Now Loading...\n");
 
@@ -259,14 +265,21 @@ void setup() {
     delay(3000);
   }
 
-  // IV（AES暗号化の初期ベクトル）を生成してメモリ上に保存する　値は一意になる
-  if (getIV(status.iv, sizeof(status.iv), IV_PHRASE)) {
+  // OTPの保存ファイルを開いて索引を読み込む（旧形式のファイルがあれば移行する）
+  if (!vaultBegin()) {
+    console("**Error** OTP vault cannot open.\n");
+    beep(BEEP_ERROR);
+    delay(3000);
+  }
+
+  // IV（AES暗号化の初期ベクトル）と秘密鍵暗号化用の秘密鍵を生成してメモリ上に保存する　値は一意になる
+  if (deviceKeysBegin()) {
     if (debug) {
       spn("IV: ");
       printDump1Line(status.iv, sizeof(status.iv));
     }
   } else {
-    console("IV generate failed");
+    console("IV/B-Secret generate failed");
     delay(999999);
   }
 
@@ -279,6 +292,7 @@ void setup() {
     spn("M5Unit-RFID2 initialize...");
     nfc._debug = true;  // デバッグ出力有効
     nfc._dbgopt = NFCOPT_DUMP_AUTHFAIL_CONTINUE;  // デバッグ: DumpAll時認証エラー後も継続
+    mfrc522._busClock = I2C_CLOCK_RFID;  // QRとバスを共用するので、RFID2と通信するときだけクロックを上げる
     nfc.init();
     status.unitRFIDready = nfc.firmwareVersionCheck();
     sp(status.unitRFIDready ? "success" : "failed");
@@ -287,7 +301,9 @@ void setup() {
   // 初回設定が済んでいない場合はセットアップを開く
   if (!conf.loaded || conf.saveSecret == CONF_SECRET_NONE) {
     tickerUpdateUISkip = true;
+    ui.lockCanvas();
     ui._dst->fillScreen(TFT_BLACK);
+    ui.unlockCanvas();
     res = funcInitialSetup();
     String message = res ? "初期設定が正常に完了しました。" : "初期設定は失敗しました。";
     message = message + "再起動します。";
@@ -317,12 +333,9 @@ void setup() {
   tickerBleConn.attach_ms(250, tickerBleConnectionMonitor);
 
   // 秘密鍵をロードする（秘密鍵を本体に保存している場合）
-  deleteSecret(CONF_SECRET_MEMORY);
-  status.unlock = false;
+  lockSecret();
   if (conf.saveSecret == CONF_SECRET_FATFS) {
-    if (loadSecret(conf.saveSecret)) {
-      status.unlock = true;
-    } else {
+    if (!unlockSecret(conf.saveSecret)) {
       console("**Error** secret-key cannot load from FatFS.\n");
       beep(BEEP_ERROR);
       delay(3000);
@@ -398,12 +411,16 @@ MenuDef menuSet = {
     { Itype::subtitle, 0, "        キュリティ", nullptr, "" },
     { Itype::none, 0, "秘密鍵の移動", funcKeyMove, "秘密鍵をNFCまたは本体に移動します" },
     { Itype::none, 0, "NFCの秘密鍵を複製", funcKeyDuplicate, "予備用にNFCの秘密鍵を複製します" },
+    { Itype::none, 0, "NFCの秘密鍵を分割", funcKeySplit, "秘密鍵を分割して複数のNFCカードに保存します" },
+    { Itype::none, 0, "NFCカードの一括作成", funcKeyProvision, "かざしたNFCカードに続けて秘密鍵を書き込みます" },
+    { Itype::none, 0, "秘密鍵の自動消去", funcUnlockTimeout, "無操作時にNFCから読み込んだ秘密鍵を消去する秒数を設定します" },
     { Itype::none, 0, "NFCフォーマット", funcFormatNfc, "NFCカードの秘密鍵を初期化します" },
     { Itype::none, 0, "サイトのエクスポート", funcExportOtp, "サイトの二段階認証をデータを他のアプリにエクスポートします" },
     { Itype::subtitle, 0, "          開発者", nullptr, "" },
     { Itype::goRestart, 0, "本体フォーマット", funcFormatFatfs, "本体のFatFSや設定の初期化します" },
     { Itype::none, 0, "HEXダンプ", funcHexDump, "シリアルコンソールにファイルのHEXデータをダンプします" },
     { Itype::none, 0, "DEBUG BLE全ASCII送信", funcDevelopSendAscii, "BLEで全ASCIIコードを送信" },
+    { Itype::none, 0, "DEBUG ベンチマーク", funcDevelopBenchmark, "シリアルコンソールに処理速度を出力します" },
     { Itype::goRestart, 0, "SSL証明書再生成", funcRegenerateOreoreSSL, "SSL証明書を削除して再生成します" },
     { Itype::back, 0, "<< 戻る", nullptr, "" },
   },
@@ -418,6 +435,7 @@ void loop() {
   ui.drawStatusPanel(&status);  // UI左描画
   ui.drawRotaryPanel(&menuTop);   // UI右描画
   ui.drawMainPanel_preview(&menuTop);   // UI中央描画
+  if (debug) ui.printHeapStats();  // メニューを行き来しても最大の連続空き領域が減っていかないか確認する
 
   // 右メニュー（ロータリー）の表示とメニューの選択 ---------------------------------------------------
   while (menuTop.selected == -1) {
@@ -434,6 +452,7 @@ void loop() {
       if (debug) spf("Menu %d selected.\n", menuTop.selected);
       break;
     }
+    unlockSessionCheck();  // 無操作で解錠セッションがタイムアウトしたら秘密鍵を消去
     delay(5);
   }
   if (menuTop.selected == -1) return;
@@ -14,8 +14,18 @@
 */
 #include "NfcEasyWriter.h"
 
+// I2Cバスのクロック切り替え
+uint32_t I2cBusProfile::_clock = 0;
+
+void I2cBusProfile::use(TwoWire* wire, uint32_t clock) {
+  if (wire == nullptr || clock == 0 || clock == _clock) return;
+  wire->setClock(clock);
+  _clock = clock;
+}
+
 // MFRC522の初期化（MFRC522_I2CのPCD_Init()からリセットピンのGPIOの動作を除いたもの）
 void MFRC522_I2C_Extend::PCD_Init_without_resetpin() {
+  bus();
   // Perform a soft reset
   PCD_Reset();
 	// When communicating with a PICC we need a timeout if something goes wrong.
@@ -43,6 +53,12 @@ byte MFRC522_I2C_Extend::MIFARE_Ultralight_Authenticate(byte* password, byte* pa
   command[0] = 0x1B; // PWD_AUTH command
   memcpy(&command[1], password, 4);
 
+  bus();
+  if (_fastIo) {
+    crcA(command, 5, &command[5]);
+    return transceiveFast(command, sizeof(command), pack, packLen, NULL, true);
+  }
+
 	// Calculate CRC_A
 	byte result = PCD_CalculateCRC(command, 5, &command[5]);
 	if (result != STATUS_OK) {
@@ -53,6 +69,188 @@ byte MFRC522_I2C_Extend::MIFARE_Ultralight_Authenticate(byte* password, byte* pa
   return PCD_TransceiveData(command, sizeof(command), pack, packLen, NULL, 0, true);
 }
 
+// NTAGのFAST_READでページ範囲をまとめて読み込む
+byte MFRC522_I2C_Extend::NTAG_FastRead(byte startPage, byte endPage, byte* buffer, byte* bufferSize) {
+  if (buffer == NULL || endPage < startPage || *bufferSize < (endPage - startPage + 1) * 4 + 2) {
+    return STATUS_NO_ROOM;
+  }
+  byte command[5];
+  command[0] = 0x3A; // FAST_READ command
+  command[1] = startPage;
+  command[2] = endPage;
+  bus();
+  if (_fastIo) {
+    crcA(command, 3, &command[3]);
+    return transceiveFast(command, sizeof(command), buffer, bufferSize, NULL, true);
+  }
+  byte result = PCD_CalculateCRC(command, 3, &command[3]);
+  if (result != STATUS_OK) {
+    return result;
+  }
+  return PCD_TransceiveData(command, sizeof(command), buffer, bufferSize, NULL, 0, true);
+}
+
+// 1ブロック(Ultralightは4ページ)読み込む
+byte MFRC522_I2C_Extend::MIFARE_Read(byte blockAddr, byte* buffer, byte* bufferSize) {
+  bus();
+  if (!_fastIo) return MFRC522_I2C::MIFARE_Read(blockAddr, buffer, bufferSize);
+  if (buffer == NULL || *bufferSize < 18) {
+    return STATUS_NO_ROOM;
+  }
+  byte command[4];
+  command[0] = 0x30; // READ command
+  command[1] = blockAddr;
+  crcA(command, 2, &command[2]);
+  return transceiveFast(command, sizeof(command), buffer, bufferSize, NULL, true);
+}
+
+// [Classic] 1ブロック(16バイト)書き込む
+byte MFRC522_I2C_Extend::MIFARE_Write(byte blockAddr, byte* buffer, byte bufferSize) {
+  bus();
+  if (!_fastIo) return MFRC522_I2C::MIFARE_Write(blockAddr, buffer, bufferSize);
+  if (buffer == NULL || bufferSize < 16) {
+    return STATUS_INVALID;
+  }
+  byte command[2] = { 0xA0, blockAddr };  // WRITE command（ACKの後にデータを送る）
+  byte result = mifareTransceiveFast(command, sizeof(command));
+  if (result != STATUS_OK) {
+    return result;
+  }
+  return mifareTransceiveFast(buffer, 16);
+}
+
+// [Ultralight] 1ページ(4バイト)書き込む
+byte MFRC522_I2C_Extend::MIFARE_Ultralight_Write(byte page, byte* buffer, byte bufferSize) {
+  bus();
+  if (!_fastIo) return MFRC522_I2C::MIFARE_Ultralight_Write(page, buffer, bufferSize);
+  if (buffer == NULL || bufferSize < 4) {
+    return STATUS_INVALID;
+  }
+  byte command[6];
+  command[0] = 0xA2; // WRITE command
+  command[1] = page;
+  memcpy(&command[2], buffer, 4);
+  return mifareTransceiveFast(command, sizeof(command));
+}
+
+// CRC_A（ISO/IEC 14443-3 付属書B）を計算する
+//   MFRC522のCRCコプロセッサはFIFOへの書き込みと完了待ちでI2Cの往復が増えるので、送受信ではこちらを使う
+void MFRC522_I2C_Extend::crcA(const byte* data, byte length, byte* result) {
+  uint16_t crc = 0x6363;
+  for (byte i=0; i<length; i++) {
+    byte b = data[i] ^ (byte)(crc & 0xFF);
+    b ^= (byte)(b << 4);
+    crc = (crc >> 8) ^ ((uint16_t)b << 8) ^ ((uint16_t)b << 3) ^ (b >> 4);
+  }
+  result[0] = crc & 0xFF;
+  result[1] = crc >> 8;
+}
+
+// FIFOに1回のI2C転送で書き込む（最大64バイト）
+void MFRC522_I2C_Extend::writeFifo(const byte* data, byte count) {
+  _wire->beginTransmission(_chipAddr);
+  _wire->write(FIFODataReg);
+  _wire->write(data, count);
+  _wire->endTransmission();
+}
+
+// FIFOから1回のI2C転送で読み込む（最大64バイト）
+void MFRC522_I2C_Extend::readFifo(byte* data, byte count) {
+  _wire->beginTransmission(_chipAddr);
+  _wire->write(FIFODataReg);
+  _wire->endTransmission();
+  _wire->requestFrom(_chipAddr, count);
+  for (byte i=0; i<count && _wire->available(); i++) {
+    data[i] = _wire->read();
+  }
+}
+
+// 送受信する（MFRC522_I2CのPCD_TransceiveData()と同じ結果を返す）
+//   FIFOの読み書きはそれぞれ1回のI2C転送にまとめ、StartSendは読み出さずに書き込む。CRC_Aはソフトウェアで確認する
+byte MFRC522_I2C_Extend::transceiveFast(const byte* sendData, byte sendLen, byte* backData, byte* backLen, byte* validBits, bool checkCRC) {
+  if (sendLen > 64) {
+    return STATUS_NO_ROOM;
+  }
+  byte txLastBits = validBits ? *validBits : 0;
+  PCD_WriteRegister(CommandReg, PCD_Idle);       // 実行中のコマンドを止める
+  PCD_WriteRegister(ComIrqReg, 0x7F);            // 割り込みフラグをクリア
+  PCD_WriteRegister(FIFOLevelReg, 0x80);         // FIFOを空にする
+  writeFifo(sendData, sendLen);
+  PCD_WriteRegister(CommandReg, PCD_Transceive);
+  PCD_WriteRegister(BitFramingReg, 0x80 | txLastBits);  // StartSend
+
+  // 完了を待つ（タイムアウトはMFRC522のタイマーで25ms）
+  uint16_t i;
+  for (i = 2000; i > 0; i--) {
+    byte n = MFRC522_I2C::PCD_ReadRegister(ComIrqReg);
+    if (n & 0x30) break;          // RxIRq, IdleIRq
+    if (n & 0x01) return STATUS_TIMEOUT;  // TimerIRq
+  }
+  if (i == 0) {
+    return STATUS_TIMEOUT;
+  }
+  byte errorRegValue = MFRC522_I2C::PCD_ReadRegister(ErrorReg);
+  if (errorRegValue & 0x13) {     // BufferOvfl, ParityErr, ProtocolErr
+    return STATUS_ERROR;
+  }
+
+  // 受信データ
+  byte rxValidBits = 0;
+  if (backData && backLen) {
+    byte n = MFRC522_I2C::PCD_ReadRegister(FIFOLevelReg);
+    if (n > *backLen) {
+      return STATUS_NO_ROOM;
+    }
+    *backLen = n;
+    readFifo(backData, n);
+    rxValidBits = MFRC522_I2C::PCD_ReadRegister(ControlReg) & 0x07;
+    if (validBits) *validBits = rxValidBits;
+  }
+  if (errorRegValue & 0x08) {     // CollErr
+    return STATUS_COLLISION;
+  }
+
+  // CRC_Aの確認
+  if (backData && backLen && checkCRC) {
+    if (*backLen == 1 && rxValidBits == 4) {  // 4ビットのNAK
+      return STATUS_MIFARE_NACK;
+    }
+    if (*backLen < 2 || rxValidBits != 0) {
+      return STATUS_CRC_WRONG;
+    }
+    byte crc[2];
+    crcA(backData, *backLen - 2, crc);
+    if (backData[*backLen - 2] != crc[0] || backData[*backLen - 1] != crc[1]) {
+      return STATUS_CRC_WRONG;
+    }
+  }
+  return STATUS_OK;
+}
+
+// CRC_Aを付けて送り、4ビットのACKを確認する（MFRC522_I2CのPCD_MIFARE_Transceive()と同じ）
+byte MFRC522_I2C_Extend::mifareTransceiveFast(const byte* sendData, byte sendLen) {
+  byte command[18];
+  if (sendData == NULL || sendLen > 16) {
+    return STATUS_INVALID;
+  }
+  memcpy(command, sendData, sendLen);
+  crcA(command, sendLen, &command[sendLen]);
+  byte back[2];
+  byte backLen = sizeof(back);
+  byte validBits = 0;
+  byte result = transceiveFast(command, sendLen + 2, back, &backLen, &validBits, false);
+  if (result != STATUS_OK) {
+    return result;
+  }
+  if (backLen != 1 || validBits != 4) {
+    return STATUS_ERROR;
+  }
+  if ((back[0] & 0x0F) != 0x0A) {  // MF_ACK
+    return STATUS_MIFARE_NACK;
+  }
+  return STATUS_OK;
+}
+
 
 // 初期化
 void NfcEasyWriter::init() {
@@ -64,20 +262,51 @@ bool NfcEasyWriter::waitCard(uint32_t timeout) {
   uint32_t tm = millis() + timeout;
   bool stat = false;
   while (!stat) {
-    if (mfrc522.PICC_IsNewCardPresent() && mfrc522.PICC_ReadCardSerial()) {
+    if (detectCard()) {
       stat = true;
       break;
     } else if (timeout > 0 && tm < millis()) {
       break;
     }
-    delay(100);
+    delay(20);
   }
   return stat;
 }
 
+// カードが置かれているか1回だけ調べる（REQA 1回。見つかればそのまま選択する）
+bool NfcEasyWriter::detectCard() {
+  uint32_t tm = micros();
+  _selected = (mfrc522.PICC_IsNewCardPresent() && mfrc522.PICC_ReadCardSerial());
+  addTime(NOP_DETECT, tm);
+  return _selected;
+}
+
+// 選択し直す（WUPAで起こしてから選択する。待ち時間なし）
+bool NfcEasyWriter::reselectCard() {
+  byte atqa[2];
+  for (int i=0; i<2; i++) {   // 認証状態だったカードは1回目のWUPAでIDLEに戻るだけのことがある
+    byte atqaSize = sizeof(atqa);
+    byte res = mfrc522.PICC_WakeupA(atqa, &atqaSize);
+    if ((res == MFRC522_I2C::STATUS_OK || res == MFRC522_I2C::STATUS_COLLISION) && mfrc522.PICC_ReadCardSerial()) {
+      _selected = true;
+      return true;
+    }
+  }
+  _selected = false;
+  return false;
+}
+
+// 読み書きできる状態にする（選択済みなら何もしない。選択し直せなければ待つ）
+bool NfcEasyWriter::ensureCard(uint32_t timeout) {
+  if (_selected) return true;
+  if (reselectCard()) return true;
+  return waitCard(timeout);
+}
+
 // カードをマウントする（読み書きできる状態になるまで待つ）
-bool NfcEasyWriter::mountCard(uint32_t timeout, ProtectMode mode) {
+bool NfcEasyWriter::mountCard(uint32_t timeout, ProtectMode mode, bool resetReader) {
   bool stat;
+  uint32_t tm = micros();
 
   // マウント中なら先にアンマウントする
   if (_mounted) {
@@ -85,8 +314,13 @@ bool NfcEasyWriter::mountCard(uint32_t timeout, ProtectMode mode) {
   }
 
   // カード情報を取得する
-  init();
-  stat = waitCard(timeout);  // 読み書きできる状態になるまで待つ
+  if (resetReader) {
+    init();
+    stat = waitCard(timeout);  // 読み書きできる状態になるまで待つ
+    tm = micros();  // カードを待った時間は含めない
+  } else {
+    stat = ensureCard(timeout);   // detectCard()で選択済みならそのまま使う
+  }
   if (stat) {
     _cardType = checkCardType(mfrc522);
     if (_cardType == CardType::Classic) {
@@ -98,6 +332,7 @@ bool NfcEasyWriter::mountCard(uint32_t timeout, ProtectMode mode) {
       if (_ntagType != NT_UNKNOWN) {
         _maxPageUL = getMaxPageUL(_ntagType);
         _configPageUL = getConfigPageUL(_ntagType);
+        _fastReadUL = true;   // NTAG213/215/216はFAST_READに対応している
         _mounted = true;
         if (_debug) sp("Mifare Ultralight mounted");
       } else {
@@ -107,15 +342,18 @@ bool NfcEasyWriter::mountCard(uint32_t timeout, ProtectMode mode) {
     // if (!stat && _debug) sp("mount failed");
   }
   _lastProtectMode = (mode != PRT_AUTO) ? mode : PRT_NOPASS_RW;
+  addTime(NOP_MOUNT, tm);
   return stat;
 }
 
 // カードのマウントを解除する
 void NfcEasyWriter::unmountCard() {
   mfrc522.PICC_HaltA();
+  _selected = false;
   _lastProtectMode = PRT_NOPASS_RW;
   _cardType = UnknownCard;
   _ntagType = NT_UNKNOWN;
+  _fastReadUL = false;
   _mounted = false;
   delay(50);
   if (_debug) sp("unmounted");
@@ -126,8 +364,8 @@ String NfcEasyWriter::getUidString() {
   String text = "";
   char buff[3];
   if (_mounted) {
-    for (int i=0; i<mfrc522.uid.size; i++) {
-      sprintf(buff, "%02X", mfrc522.uid.uidByte[i]);
+    for (int i=0; i<mfrc522.piccUid().size; i++) {
+      sprintf(buff, "%02X", mfrc522.piccUid().uidByte[i]);
       if (i > 0) text += ":";
       text += String(buff);
     }
@@ -136,9 +374,9 @@ String NfcEasyWriter::getUidString() {
 }
 
 // カードの種類を大まかに判定する
-CardType NfcEasyWriter::checkCardType(MFRC522_I2C &mfrc522) {
+CardType NfcEasyWriter::checkCardType(NfcTransceiver &mfrc522) {
   CardType cardType = CardType::UnknownCard;
-  byte piccType = mfrc522.PICC_GetType(mfrc522.uid.sak);
+  byte piccType = mfrc522.PICC_GetType(mfrc522.piccUid().sak);
   if (piccType == MFRC522_I2C::PICC_TYPE_MIFARE_1K ||
       piccType == MFRC522_I2C::PICC_TYPE_MIFARE_4K) {
     cardType = CardType::Classic;          // Mifare Classic
@@ -168,7 +406,7 @@ bool NfcEasyWriter::isUltralight() {
 // [Ultralight] NTAGの容量タイプを取得する
 NtagType NfcEasyWriter::getNtagTypeUL(ProtectMode mode) {
   if (mode == PRT_AUTO) mode = _lastProtectMode;
-  if (!waitCard(5000)) return NT_UNKNOWN;  // 読み書きできる状態になるまで待つ
+  if (!ensureCard(5000)) return NT_UNKNOWN;  // 読み書きできる状態にする（選択済みならそのまま）
   NtagType ntag = NT_UNKNOWN;
   byte data[16];
 
@@ -234,17 +472,50 @@ bool NfcEasyWriter::rawReadUL(byte* data, size_t dataSize, uint8_t page) {
   byte buff[18];
   byte buffSize = sizeof(buff);
   memset(data, 0, dataSize);
+  _stats.frames ++;
   if (mfrc522.MIFARE_Read(page, buff, &buffSize) == MFRC522_I2C::STATUS_OK) {
     memcpy(data, buff, dataSize);
     return true;
   }
+  _selected = false;  // NAKやタイムアウトの後はIDLEに戻っている
   return false;
 }
 
+// [Ultralight] 物理アドレス指定　startPageから最大maxPagesページをまとめて読み込む
+//   NTAGはFAST_READで最大_fastReadPagesULページ、それ以外はREADで4ページずつ。読み込んだページ数を返す（失敗は0）
+//   FAST_READが失敗した場合は以降READを使う（NAKでカードは選択が解除されるので、呼び出し側で選択し直すこと）
+uint8_t NfcEasyWriter::rawReadPagesUL(byte* data, uint8_t startPage, uint8_t maxPages) {
+  if (data == nullptr || maxPages == 0) return 0;
+  uint16_t lastPage = _configPageUL + 3;  // PACKのページが最後
+  if (_fastReadUL && startPage <= lastPage) {
+    uint16_t endPage = startPage + ((maxPages < _fastReadPagesUL) ? maxPages : _fastReadPagesUL) - 1;
+    if (endPage > lastPage) endPage = lastPage;
+    byte buff[_fastReadPagesUL * 4 + 2];
+    byte buffSize = sizeof(buff);
+    uint8_t pages = endPage - startPage + 1;
+    _stats.frames ++;
+    if (mfrc522.NTAG_FastRead(startPage, endPage, buff, &buffSize) == MFRC522_I2C::STATUS_OK && buffSize >= pages * 4) {
+      memcpy(data, buff, pages * 4);
+      return pages;
+    }
+    _fastReadUL = false;
+    _selected = false;
+    if (_debug) sp("FAST_READ failed, fallback to READ");
+    return 0;
+  }
+  byte buff[16];
+  if (!rawReadUL(buff, sizeof(buff), startPage)) return 0;
+  uint8_t pages = (maxPages < 4) ? maxPages : 4;
+  memcpy(data, buff, pages * 4);
+  return pages;
+}
+
 // [Ultralight] 物理アドレス指定　1ページ(4バイト)書き込む
 bool NfcEasyWriter::rawWriteUL(byte* data, size_t dataSize, uint8_t page) {
   if (data == nullptr || dataSize != 4) return false;
-  return (mfrc522.MIFARE_Ultralight_Write(page, data, _writeLengthUL) == MFRC522_I2C::STATUS_OK);
+  if (mfrc522.MIFARE_Ultralight_Write(page, data, _writeLengthUL) == MFRC522_I2C::STATUS_OK) return true;
+  _selected = false;
+  return false;
 }
 
 // 仮想アドレスから物理アドレスに変換する
@@ -268,11 +539,14 @@ bool NfcEasyWriter::readData(uint16_t vaddr, void* data, size_t dataSize, Protec
   if (mode == PRT_AUTO) mode = _lastProtectMode;
 
   bool res = false;
+  uint32_t tm = micros();
   if (_cardType == CardType::Classic) {
     res = readDataCL(vaddr, reinterpret_cast<byte *>(data), dataSize, mode);
   } else if (_cardType == CardType::Ultralight) {
     res = readDataUL(vaddr, reinterpret_cast<byte *>(data), dataSize, mode);
   }
+  _stats.lastReadUs = micros() - tm;
+  addTime(NOP_READ, tm);
   return res;
 }
 
@@ -281,7 +555,7 @@ bool NfcEasyWriter::readDataCL(uint16_t vaddr, byte* data, size_t dataSize, Prot
   if (! isClassic()) return false;
   if (mode == PRT_AUTO) mode = _lastProtectMode;
   if (vaddr % _writeLengthCL != 0) return false;  // 16バイト単位ではないアドレスは拒否
-  if (!waitCard(5000)) return false;  // 読み書きできる状態になるまで待つ
+  if (!ensureCard(5000)) return false;  // 読み書きできる状態にする（選択済みならそのまま）
 
   // ブロックごとのループ
   size_t cplen;
@@ -291,6 +565,8 @@ bool NfcEasyWriter::readDataCL(uint16_t vaddr, byte* data, size_t dataSize, Prot
   size_t index = 0;
   bool abort = false;
   bool protect = (mode == PRT_PASSWD_RW || mode == PRT_PASSWD_RO);
+  int authedSector = -1;  // 認証済みのセクタ（同じセクタのブロックは認証し直さない）
+  bool retried = false;   // エラー後の再認証は1回だけ
 
   while (remain > 0) {
     // 読み込みセクタ/ブロックまたはページを求める
@@ -299,18 +575,23 @@ bool NfcEasyWriter::readDataCL(uint16_t vaddr, byte* data, size_t dataSize, Prot
       String keyStr = (protect ? "B" : "A");
       spf("Index=%d 読み込み元 Sector/Block=%d/%d -> blockAddr=%d key=%s\n", index, pa.sector, pa.block, pa.blockAddr, keyStr);
     }
-    // 認証
-    auto usekey = (protect) ? MFRC522_I2C::PICC_CMD_MF_AUTH_KEY_B : MFRC522_I2C::PICC_CMD_MF_AUTH_KEY_A;
-    auto keyRead = (protect) ? _authKeyB : _authKeyA;
-    if (mfrc522.PCD_Authenticate(usekey, pa.blockAddr, &keyRead, &(mfrc522.uid)) != MFRC522_I2C::STATUS_OK) { // 認証
-      if (_debug) sp("  認証失敗");
-      abort = true;
+    // 認証（セクタが変わったときだけ）
+    if (pa.sector != authedSector) {
+      if (authCL(pa.blockAddr, protect)) {
+        authedSector = pa.sector;
+      } else {
+        if (_debug) sp("  認証失敗");
+        abort = true;
+      }
     }
     // 読み込み実行
+    bufferSize = sizeof(buffer);
+    if (!abort) _stats.frames ++;
     if (!abort && mfrc522.MIFARE_Read(pa.blockAddr, buffer, &bufferSize) == MFRC522_I2C::STATUS_OK) {
         // データをコピー
         cplen = ((remain - _readLength) < 0) ? remain : _readLength;
         memcpy(((byte*)data) + index, buffer, cplen);
+        _stats.blocksRead ++;
         if (_debug) {
           spn("  Data: ");
           printDump1Line(buffer, sizeof(buffer));
@@ -319,53 +600,95 @@ bool NfcEasyWriter::readDataCL(uint16_t vaddr, byte* data, size_t dataSize, Prot
       if (_debug) sp(".. 読み込み失敗");
       abort = true;
     }
+    // エラーの後は選択し直して、このブロックから再認証する
+    if (abort && !retried && reselectCL()) {
+      retried = true;
+      abort = false;
+      authedSector = -1;
+      continue;
+    }
     if (abort) break;
     index += cplen;
     remain -= cplen;
   }//while-remain
 
   // 認証終了
-  mfrc522.PCD_StopCrypto1();
+  stopCryptoCL();
   if (abort) return false;
 
   return true;
 }
 
+// [Classic] ブロックが属するセクタを認証する（読み書き用のKeyAまたはKeyB）
+bool NfcEasyWriter::authCL(uint16_t blockAddr, bool useKeyB) {
+  auto usekey = (useKeyB) ? MFRC522_I2C::PICC_CMD_MF_AUTH_KEY_B : MFRC522_I2C::PICC_CMD_MF_AUTH_KEY_A;
+  auto key = (useKeyB) ? _authKeyB : _authKeyA;
+  _stats.auths ++;
+  uint32_t tm = micros();
+  bool res = (mfrc522.PCD_Authenticate(usekey, blockAddr, &key, &(mfrc522.piccUid())) == MFRC522_I2C::STATUS_OK);
+  addTime(NOP_AUTH, tm);
+  return res;
+}
+
+// [Classic] エラーの後にカードを選択し直す（認証はやり直しになる）
+bool NfcEasyWriter::reselectCL() {
+  stopCryptoCL();
+  _stats.retries ++;
+  if (_debug) sp("  再選択して再認証");
+  return ensureCard(500);
+}
+
+// [Classic] 認証を終了する（カードは選択し直しが必要になる）
+void NfcEasyWriter::stopCryptoCL() {
+  mfrc522.PCD_StopCrypto1();
+  _selected = false;
+}
+
 // [Ultralight] カードからバイト配列型へデータを読み込む
 bool NfcEasyWriter::readDataUL(uint16_t vaddr, byte* data, size_t dataSize, ProtectMode mode) {
   if (! isUltralight()) return false;
   if (mode == PRT_AUTO) mode = _lastProtectMode;
   if (vaddr % _writeLengthUL != 0) return false;  // 4バイト単位ではないアドレスは拒否
-  if (!waitCard(5000)) return false;  // 読み書きできる状態になるまで待つ
+  if (!ensureCard(5000)) return false;  // 読み書きできる状態にする（選択済みならそのまま）
 
   // ブロックごとのループ
   size_t cplen;
-  byte buffer[18];
-  byte bufferSize = sizeof(buffer);
+  byte buffer[_fastReadPagesUL * 4];
   int remain = dataSize;
   size_t index = 0;
   bool abort = false;
+  bool protect = (mode == PRT_PASSWD_RW || mode == PRT_PASSWD_RO);
 
   // 認証がかかっている場合は、まず認証する
-  if (mode == PRT_PASSWD_RW || mode == PRT_PASSWD_RO) {
+  if (protect) {
     if (! authUL(true)) return false;   
   }
 
-  // ブロックごとのループ　最小読み込み単位ごとに分割して読み込む
+  // ページ範囲ごとのループ　NTAGはFAST_READで_fastReadPagesULページずつ、それ以外は4ページずつ読み込む
   while (remain > 0) {
-    // 読み込みセクタ/ブロックまたはページを求める
+    // 読み込みページを求める
     PhyAddr pa = addr2PhysicalAddr(vaddr + index, CardType::Ultralight);
+    uint16_t remainPages = (remain + 3) / 4;
+    uint8_t wantPages = (remainPages < _fastReadPagesUL) ? remainPages : _fastReadPagesUL;
     if (_debug) {
-      spf("Index=%d 読み込み元 Page=%d\n", index, pa.blockAddr);
+      spf("Index=%d 読み込み元 Page=%d (%d pages)\n", index, pa.blockAddr, wantPages);
     }
     // 読み込み実行
-    if (!abort && mfrc522.MIFARE_Read(pa.blockAddr, buffer, &bufferSize) == MFRC522_I2C::STATUS_OK) {
+    bool fastRead = _fastReadUL;
+    uint8_t pages = rawReadPagesUL(buffer, pa.blockAddr, wantPages);
+    if (pages == 0 && fastRead && !_fastReadUL) {   // FAST_READに失敗したら選択し直してREADでやり直す
+      if (!ensureCard(500)) return false;
+      if (protect && !authUL(true)) return false;
+      pages = rawReadPagesUL(buffer, pa.blockAddr, wantPages);
+    }
+    if (pages > 0) {
         // データをコピー
-        cplen = ((remain - _readLength) < 0) ? remain : _readLength;
+        cplen = ((remain - pages * 4) < 0) ? remain : pages * 4;
         memcpy(((byte*)data) + index, buffer, cplen);
+        _stats.blocksRead += (pages + 3) / 4;
         if (_debug) {
           spn("  Data: ");
-          printDump1Line(buffer, sizeof(buffer));
+          printDump1Line(buffer, pages * 4);
         }
     } else {
       if (_debug) sp(".. 読み込み失敗");
@@ -387,11 +710,14 @@ bool NfcEasyWriter::writeData(uint16_t vaddr, void* data, size_t dataSize, Prote
   if (_debug) Serial.println("Total Data size="+String(dataSize));
 
   bool res = false;
+  uint32_t tm = micros();
   if (_cardType == CardType::Classic) {
     res = writeDataCL(vaddr, reinterpret_cast<byte *>(data), dataSize, mode);
   } else if (_cardType == CardType::Ultralight) {
     res = writeDataUL(vaddr, reinterpret_cast<byte *>(data), dataSize, mode);
   }
+  _stats.lastWriteUs = micros() - tm;
+  addTime(NOP_WRITE, tm);
   return res;
 }
 
@@ -400,7 +726,7 @@ bool NfcEasyWriter::writeDataCL(uint16_t vaddr, byte* data, size_t dataSize, Pro
   if (! isClassic()) return false;
   if (mode == PRT_AUTO) mode = _lastProtectMode;
   if (vaddr % _writeLengthCL != 0) return false;  // 16バイト単位ではないアドレスは拒否
-  if (!waitCard(5000)) return false;  // 読み書きできる状態になるまで待つ
+  if (!ensureCard(5000)) return false;  // 読み書きできる状態にする（選択済みならそのまま）
 
   // 準備
   byte buffer[_writeLengthCL];
@@ -408,6 +734,8 @@ bool NfcEasyWriter::writeDataCL(uint16_t vaddr, byte* data, size_t dataSize, Pro
   size_t index = 0;
   bool abort = false;
   bool protect = (mode == PRT_PASSWD_RW || mode == PRT_PASSWD_RO);
+  int authedSector = -1;  // 認証済みのセクタ（同じセクタのブロックは認証し直さない）
+  bool retried = false;   // エラー後の再認証は1回だけ
 
   // ブロックごとのループ　最小書き込み単位ごとに分割して書き込む
   while (remain > 0) {
@@ -427,29 +755,41 @@ bool NfcEasyWriter::writeDataCL(uint16_t vaddr, byte* data, size_t dataSize, Pro
       printDump1Line(buffer, sizeof(buffer));
     }
 
-    // 認証
-    auto usekey = (protect) ? MFRC522_I2C::PICC_CMD_MF_AUTH_KEY_B : MFRC522_I2C::PICC_CMD_MF_AUTH_KEY_A;
-    auto keyWrite = (protect) ? _authKeyB : _authKeyA;
-    if (mfrc522.PCD_Authenticate(usekey, pa.blockAddr, &keyWrite, &(mfrc522.uid)) == MFRC522_I2C::STATUS_OK) {
-      // 書き込み
+    // 認証（セクタが変わったときだけ）
+    if (pa.sector != authedSector) {
+      if (authCL(pa.blockAddr, protect)) {
+        authedSector = pa.sector;
+      } else {
+        if (_debug) sp("  認証失敗");
+        abort = true;
+      }
+    }
+    // 書き込み
+    if (!abort) {
+      _stats.frames ++;
       if (mfrc522.MIFARE_Write(pa.blockAddr, buffer, _writeLengthCL) == MFRC522_I2C::STATUS_OK) {
+        _stats.blocksWritten ++;
         if (_debug) sp("  書き込み成功");
       } else {
         if (_debug) sp("  書き込み失敗");
         abort = true;
       }
-    } else {
-      if (_debug) sp("  認証失敗");
-      abort = true;
     }
 
+    // エラーの後は選択し直して、このブロックから再認証する
+    if (abort && !retried && reselectCL()) {
+      retried = true;
+      abort = false;
+      authedSector = -1;
+      continue;
+    }
     if (abort) break;
     index += cplen;
     remain -= cplen;
   }//while-remain
 
   // 認証終了
-  mfrc522.PCD_StopCrypto1();
+  stopCryptoCL();
   if (abort) return false;
 
   return true;
@@ -460,7 +800,7 @@ bool NfcEasyWriter::writeDataUL(uint16_t vaddr, byte* data, size_t dataSize, Pro
   if (! isUltralight()) return false;
   if (mode == PRT_AUTO) mode = _lastProtectMode;
   if (vaddr % _writeLengthUL != 0) return false;  // 4バイト単位ではないアドレスは拒否
-  if (!waitCard(5000)) return false;  // 読み書きできる状態になるまで待つ
+  if (!ensureCard(5000)) return false;  // 読み書きできる状態にする（選択済みならそのまま）
 
   // 準備
   byte buffer[_writeLengthUL];
@@ -491,10 +831,13 @@ bool NfcEasyWriter::writeDataUL(uint16_t vaddr, byte* data, size_t dataSize, Pro
     }
 
     // 書き込み
+    _stats.frames ++;
     if (mfrc522.MIFARE_Ultralight_Write(pa.blockAddr, buffer, _writeLengthUL)  == MFRC522_I2C::STATUS_OK) {
+      _stats.blocksWritten ++;
       if (_debug) sp("..ok");
     } else {
       if (_debug) sp(".. 書き込み失敗");
+      _selected = false;
       return false;
     }
     index += cplen;
@@ -504,6 +847,234 @@ bool NfcEasyWriter::writeDataUL(uint16_t vaddr, byte* data, size_t dataSize, Pro
   return true;
 }
 
+// スロットのヘッダとCRCが正しいか調べる
+static bool slotIsValid(const byte* slot, uint16_t slotSize) {
+  const SlotHeader* hd = reinterpret_cast<const SlotHeader*>(slot);
+  if (hd->magic[0] != 'S' || hd->magic[1] != 'L') return false;
+  if (hd->length > slotSize - sizeof(SlotHeader)) return false;
+  uint16_t crc = NfcEasyWriter::crc16(slot, offsetof(SlotHeader, crc));
+  crc = NfcEasyWriter::crc16(slot + sizeof(SlotHeader), hd->length, crc);
+  return (crc == hd->crc);
+}
+
+// [共通] A/Bの2スロットの古い方にデータを書き込み、書き込んだ範囲だけ読み返して確認する
+// 書き込み中に途切れても、もう一方のスロットは前回の内容のまま残る
+bool NfcEasyWriter::writeSlot(uint16_t vaddr, uint16_t slotSize, const void* data, size_t dataSize, ProtectMode mode, int8_t forceSlot) {
+  if (! isMounted()) return false;
+  if (mode == PRT_AUTO) mode = _lastProtectMode;
+  if (slotSize % _writeLengthCL != 0) return false;
+  if (forceSlot < -1 || forceSlot > 1) return false;
+  if (dataSize > slotSize - sizeof(SlotHeader)) return false;
+
+  // 両方のスロットのヘッダを調べる（壊れているスロットは無効扱い）
+  // 読めないときは、どちらが新しいか分からないので書かない（新しい方を上書きしてしまうため）
+  byte slots[slotSize * 2];
+  if (! readData(vaddr, slots, sizeof(slots), mode)) {
+    memset(slots, 0, sizeof(slots));
+    return false;
+  }
+  bool valid[2];
+  valid[0] = slotIsValid(slots, slotSize);
+  valid[1] = slotIsValid(slots + slotSize, slotSize);
+  uint16_t seq[2];
+  for (int i=0; i<2; i++) {
+    seq[i] = reinterpret_cast<SlotHeader*>(slots + slotSize * i)->seq;
+  }
+
+  // 書き込み先を決める　両方無効ならBにする（forceSlotを指定したらそのスロット）
+  // （スロット化前のカードは先頭に秘密鍵ファイルがあり、スロットAと重なるので、最初の書き込みでは使わない）
+  int target;
+  if (forceSlot >= 0) {
+    target = forceSlot;
+  } else if (valid[0] && valid[1]) {
+    target = ((int16_t)(seq[1] - seq[0]) > 0) ? 0 : 1;  // 古い方
+  } else if (valid[1]) {
+    target = 0;
+  } else {
+    target = 1;
+  }
+  uint16_t newSeq = 1;  // 有効なスロットのうち新しい方の次
+  if (valid[0] && valid[1]) {
+    newSeq = (((int16_t)(seq[1] - seq[0]) > 0) ? seq[1] : seq[0]) + 1;
+  } else if (valid[0] || valid[1]) {
+    newSeq = seq[valid[0] ? 0 : 1] + 1;
+  }
+
+  // スロットの内容を作る（ヘッダ＋データ＋0埋め）
+  byte slot[slotSize];
+  memset(slot, 0, sizeof(slot));
+  SlotHeader* hd = reinterpret_cast<SlotHeader*>(slot);
+  hd->magic[0] = 'S';
+  hd->magic[1] = 'L';
+  hd->seq = newSeq;
+  hd->length = dataSize;
+  memcpy(slot + sizeof(SlotHeader), data, dataSize);
+  hd->crc = crc16(slot, offsetof(SlotHeader, crc));
+  hd->crc = crc16(slot + sizeof(SlotHeader), dataSize, hd->crc);
+  if (_debug) spf("writeSlot: slot=%c seq=%d valid=%d/%d\n", 'A'+target, newSeq, valid[0], valid[1]);
+
+  // 書き込んで、同じ範囲だけ読み返して比較する
+  uint16_t addr = vaddr + slotSize * target;
+  if (! writeData(addr, slot, sizeof(slot), mode)) return false;
+  byte verify[slotSize];
+  if (! readData(addr, verify, sizeof(verify), mode)) return false;
+  bool res = (memcmp(slot, verify, sizeof(slot)) == 0);
+  if (_debug) spp("writeSlot: verify", (res ? "ok" : "failed"));
+  memset(slot, 0, sizeof(slot));
+  memset(verify, 0, sizeof(verify));
+  memset(slots, 0, sizeof(slots));
+  return res;
+}
+
+// [共通] A/Bの2スロットのうち有効で新しい方のデータを読み込む
+size_t NfcEasyWriter::readSlot(uint16_t vaddr, uint16_t slotSize, void* data, size_t dataSize, ProtectMode mode, int8_t* usedSlot) {
+  if (usedSlot != nullptr) *usedSlot = -1;
+  if (! isMounted()) return 0;
+  if (mode == PRT_AUTO) mode = _lastProtectMode;
+  if (slotSize % _writeLengthCL != 0) return 0;
+
+  byte slots[slotSize * 2];
+  if (! readData(vaddr, slots, sizeof(slots), mode)) return 0;
+  bool valid[2];
+  valid[0] = slotIsValid(slots, slotSize);
+  valid[1] = slotIsValid(slots + slotSize, slotSize);
+  const SlotHeader* hd[2] = {
+    reinterpret_cast<const SlotHeader*>(slots),
+    reinterpret_cast<const SlotHeader*>(slots + slotSize),
+  };
+
+  // 有効なスロットのうち新しい方を選ぶ
+  int target = -1;
+  if (valid[0] && valid[1]) {
+    target = ((int16_t)(hd[1]->seq - hd[0]->seq) > 0) ? 1 : 0;
+  } else if (valid[0]) {
+    target = 0;
+  } else if (valid[1]) {
+    target = 1;
+  }
+  if (_debug) spf("readSlot: valid=%d/%d use=%c\n", valid[0], valid[1], (target < 0) ? '-' : 'A'+target);
+
+  size_t len = 0;
+  if (target >= 0 && hd[target]->length <= dataSize) {
+    len = hd[target]->length;
+    memcpy(data, slots + slotSize * target + sizeof(SlotHeader), len);
+    if (usedSlot != nullptr) *usedSlot = target;
+  }
+  memset(slots, 0, sizeof(slots));
+  return len;
+}
+
+// [Ultralight] NDEFコンテナのデータ領域の仮想アドレスを求める（ヘッダの次の16バイト境界）
+//   hdrLen: page.4からProprietary TLVのT,Lまでのバイト数
+static uint16_t ndefDataVaddrUL(uint16_t hdrLen, uint16_t pre) {
+  return (hdrLen > pre) ? (hdrLen - pre + 15) / 16 * 16 : 0;
+}
+
+// [Ultralight] page.4からNDEFコンテナのヘッダを書き込む
+bool NfcEasyWriter::writeNdefContainerUL(const char* type, const byte* info, uint8_t infoLen, uint16_t dataSize, uint16_t* dataVaddr, ProtectMode mode) {
+  if (! isUltralight() || type == nullptr || (info == nullptr && infoLen > 0)) return false;
+  if (mode == PRT_AUTO) mode = _lastProtectMode;
+  const uint16_t pre = (_minPageUL - 4) * 4;  // page.4から仮想アドレス0までのバイト数
+  const uint8_t typeLen = strlen(type);
+  uint16_t recLen = 3 + typeLen + infoLen;    // NDEFレコード（ヘッダ3バイト + type + payload）
+  if (typeLen == 0 || recLen > 254 || dataSize > 254) return false;  // TLVの長さは1バイト形式のみ
+  if (dataSize % _writeLengthUL != 0) return false;  // Terminator TLVをページの先頭に置くため
+
+  // ヘッダを作る（page.4から データ領域の直前まで）
+  byte hdr[64];
+  uint16_t v = ndefDataVaddrUL(2 + recLen + 2, pre);
+  uint16_t q = pre + v;   // page.4からデータ領域までのバイト数
+  if (q > sizeof(hdr) || v + dataSize + 4 > getVCapacities()) return false;
+  memset(hdr, 0x00, q);   // 隙間はNULL TLVで埋める
+  hdr[0] = 0x03;          // NDEF Message TLV
+  hdr[1] = recLen;
+  hdr[2] = 0xD4;          // MB=1, ME=1, SR=1, TNF=4(NFC Forum外部タイプ)
+  hdr[3] = typeLen;
+  hdr[4] = infoLen;
+  memcpy(&hdr[5], type, typeLen);
+  if (infoLen > 0) memcpy(&hdr[5 + typeLen], info, infoLen);
+  hdr[q - 2] = 0xFD;      // Proprietary TLV（値がデータ領域）
+  hdr[q - 1] = dataSize;
+  if (dataVaddr != nullptr) *dataVaddr = v;
+
+  // 同じヘッダが書き込み済みなら何もしない（page.4は常にプロテクトの範囲外）
+  byte cur[sizeof(hdr)];
+  bool same = (pre == 0 || rawReadPagesUL(cur, 4, pre / 4) == pre / 4);
+  if (same) same = readData(0, &cur[pre], v, mode);
+  if (same) same = (memcmp(cur, hdr, q) == 0);
+  if (_debug) spp("writeNdefContainerUL: same header", same);
+  if (same) return true;
+
+  // データ領域の後ろのTerminator TLV → 仮想アドレス0以降のヘッダ → page.4 の順に書き込む
+  // （page.4を最後にするので、途中で失敗してもNDEFとして中途半端なヘッダは見えない）
+  byte term[4] = { 0xFE, 0, 0, 0 };
+  if (! writeData(v + dataSize, term, sizeof(term), mode)) return false;
+  if (v > 0 && ! writeData(0, &hdr[pre], v, mode)) return false;
+  for (uint16_t i=0; i<pre; i+=_writeLengthUL) {
+    if (! rawWriteUL(&hdr[i], _writeLengthUL, 4 + i / _writeLengthUL)) return false;
+  }
+  return true;
+}
+
+// [Ultralight] page.4からNDEFコンテナを探し、データ領域の仮想アドレスと大きさを返す
+bool NfcEasyWriter::findNdefContainerUL(const char* type, uint16_t* dataVaddr, uint16_t* dataSize) {
+  if (! isUltralight() || type == nullptr || dataVaddr == nullptr || dataSize == nullptr) return false;
+  if (!ensureCard(500)) return false;  // 読み書きできる状態にする（選択済みならそのまま）
+  const uint16_t pre = (_minPageUL - 4) * 4;  // page.4から仮想アドレス0までのバイト数
+  const uint8_t typeLen = strlen(type);
+
+  // page.4から先頭lenバイトまでを読み込む（読み込み済みのページは読まない）
+  byte hdr[64];
+  uint16_t loaded = 0;
+  auto need = [&](uint16_t len) -> bool {
+    if (len > sizeof(hdr)) return false;
+    while (loaded < len) {
+      uint8_t page = 4 + loaded / 4;
+      uint8_t wantPages = (len - loaded + 3) / 4;
+      bool fastRead = _fastReadUL;
+      uint8_t pages = rawReadPagesUL(&hdr[loaded], page, wantPages);
+      if (pages == 0 && fastRead && !_fastReadUL) {   // FAST_READに失敗したら選択し直してREADでやり直す
+        if (!ensureCard(500)) return false;
+        pages = rawReadPagesUL(&hdr[loaded], page, wantPages);
+      }
+      if (pages == 0) return false;
+      loaded += pages * 4;
+    }
+    return true;
+  };
+
+  // NDEF Message TLVの長さからデータ領域の位置が決まるので、そこまでのページだけ読む
+  if (! need(16)) return false;
+  if (hdr[0] != 0x03 || hdr[1] == 0xFF) return false;  // フォーマット直後(Terminator TLV)や旧形式
+  uint16_t v = ndefDataVaddrUL(2 + hdr[1] + 2, pre);
+  uint16_t q = pre + v;
+  if (! need(q)) return false;
+
+  // 外部タイプのレコードが1個だけで、typeが一致するか
+  if (hdr[2] != 0xD4 || hdr[3] != typeLen || 3 + typeLen + hdr[4] != hdr[1]) return false;
+  if (memcmp(&hdr[5], type, typeLen) != 0) return false;
+  // NULL TLVの後ろがProprietary TLVか
+  for (uint16_t i=2+hdr[1]; i<q-2; i++) {
+    if (hdr[i] != 0x00) return false;
+  }
+  if (hdr[q - 2] != 0xFD) return false;
+  *dataVaddr = v;
+  *dataSize = hdr[q - 1];
+  if (_debug) spf("findNdefContainerUL: vaddr=%d size=%d (%d pages read)\n", v, *dataSize, loaded / 4);
+  return true;
+}
+
+// CRC-16/CCITT(多項式0x1021)を計算する
+uint16_t NfcEasyWriter::crc16(const byte* data, size_t dataSize, uint16_t crc) {
+  for (size_t i=0; i<dataSize; i++) {
+    crc ^= (uint16_t)data[i] << 8;
+    for (int b=0; b<8; b++) {
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+    }
+  }
+  return crc;
+}
+
 // 認証キーを設定する（書き込みはしない）
 void NfcEasyWriter::setAuthKey(AuthKey* key) {
   memcpy(_authKeyB.keyByte, key->keyByte, sizeof(_authKeyB.keyByte));  // 6 bytes for Classic
@@ -541,7 +1112,7 @@ bool NfcEasyWriter::writeProtectCL(ProtectMode mode, AuthKey* key, uint16_t vadd
   if (lastmode == PRT_AUTO) lastmode = _lastProtectMode;
   bool bfProt;//, afProt;
   if (vaddr % 48 != 0) return false;  // セクター単位で行うのでブロックの途中からは受け付けない
-  if (!waitCard(5000)) return false;  // 読み書きできる状態になるまで待つ
+  if (!ensureCard(5000)) return false;  // 読み書きできる状態にする（選択済みならそのまま）
 
   // Access Bitの計算　運用方針：KeyAはデフォルト値のまま運用、KeyBはパスワード認証モードのときだけ使用
   uint8_t dataBit, accBit;
@@ -592,7 +1163,7 @@ bool NfcEasyWriter::writeProtectCL(ProtectMode mode, AuthKey* key, uint16_t vadd
     // 認証開始
     auto usekey = (bfProt) ? MFRC522_I2C::PICC_CMD_MF_AUTH_KEY_B : MFRC522_I2C::PICC_CMD_MF_AUTH_KEY_A;
     auto keyWrite = (bfProt) ? _authKeyB : _authKeyA;
-    if (mfrc522.PCD_Authenticate(usekey, blockAddr, &keyWrite, &(mfrc522.uid)) == MFRC522_I2C::STATUS_OK) {
+    if (mfrc522.PCD_Authenticate(usekey, blockAddr, &keyWrite, &(mfrc522.piccUid())) == MFRC522_I2C::STATUS_OK) {
       // 書き込み
       if (mfrc522.MIFARE_Write(blockAddr, buffer, _writeLengthCL) == MFRC522_I2C::STATUS_OK) {
         if (_debug) sp("  書き込み成功");
@@ -609,18 +1180,38 @@ bool NfcEasyWriter::writeProtectCL(ProtectMode mode, AuthKey* key, uint16_t vadd
     remain -= 48;
   }
   // 認証終了
-  mfrc522.PCD_StopCrypto1();
+  stopCryptoCL();
   if (!abort) _lastProtectMode = mode;
   return !abort;
 }
 
+// [Classic] 指定した仮想アドレスのセクタのプロテクトモードを読み込む
+//   writeProtectCL()がセクタートレーラーのUser Dataに書いた値を返す。出荷時のままならPRT_NOPASS_RW、読めなければPRT_AUTO
+//   KeyAで認証するので、KeyBのパスワードを知らなくても読める
+ProtectMode NfcEasyWriter::readProtectModeCL(uint16_t vaddr) {
+  if (! isClassic()) return PRT_AUTO;
+  if (!ensureCard(5000)) return PRT_AUTO;  // 読み書きできる状態にする（選択済みならそのまま）
+  PhyAddr pa = addr2PhysicalAddr(vaddr, CardType::Classic);
+  uint16_t blockAddr = pa.sector * 4 + 3;
+  byte buffer[18];
+  byte bufferSize = sizeof(buffer);
+  ProtectMode mode = PRT_AUTO;
+  if (authCL(blockAddr, false) && mfrc522.MIFARE_Read(blockAddr, buffer, &bufferSize) == MFRC522_I2C::STATUS_OK) {
+    byte userData = buffer[9];
+    mode = (userData >= PRT_NOPASS_RW && userData <= PRT_PASSWD_RO) ? (ProtectMode)userData : PRT_NOPASS_RW;
+  }
+  if (_debug) spf("readProtectModeCL: blockAddr=%d mode=%d\n", blockAddr, mode);
+  stopCryptoCL();
+  return mode;
+}
+
 // [Ultralight] プロテクトモードや認証キーを書き込む（指定した仮想アドレス以降のにあるページ全て）
 bool NfcEasyWriter::writeProtectUL(ProtectMode mode, AuthKey* key, uint16_t vaddr, bool phyaddr, ProtectMode lastmode) {
   if (! isUltralight()) return false;
   if (lastmode == PRT_AUTO) lastmode = _lastProtectMode;
   bool bfProt, afProt, aReado;
   if (vaddr % 4 != 0 && !phyaddr) return false;  // ページ単位で行うのでページの途中からは受け付けない
-  if (!waitCard(5000)) return false;  // 読み書きできる状態になるまで待つ
+  if (!ensureCard(5000)) return false;  // 読み書きできる状態にする（選択済みならそのまま）
   if (mode == PRT_NOPASS_RO) return false;  // UltralightにはPWなしReadonlyは無いのでエラーで返す
 
   // 準備
@@ -657,12 +1248,18 @@ bool NfcEasyWriter::authUL(bool checkPack) {
   memcpy(password, _authKeyB.keyByte, sizeof(password));
   byte passwordLen = sizeof(password);
   byte packLen = sizeof(pack);
+  uint32_t tm = micros();
   byte result = mfrc522.MIFARE_Ultralight_Authenticate(password, &passwordLen, pack, &packLen);
+  addTime(NOP_AUTH, tm);
+  _stats.auths ++;
   if (_debug) {
     spf("認証結果 authUL() result=%d, send password=",result);
     printDump1Line(password, passwordLen);
   }
-  if (result != MFRC522_I2C::STATUS_OK) return false;
+  if (result != MFRC522_I2C::STATUS_OK) {
+    _selected = false;
+    return false;
+  }
   if (checkPack) {
     if (_debug) spf("received pack=%02X %02X\n", pack[0], pack[1]);
     return (pack[0] == _authKeyB.keyByte[4] && pack[1] == _authKeyB.keyByte[5]);
@@ -680,7 +1277,7 @@ bool NfcEasyWriter::unauthUL(ProtectMode mode) {
 bool NfcEasyWriter::readConfigDataUL(ULConfig* ulconf, ProtectMode mode) {
   if (mode == PRT_AUTO) mode = _lastProtectMode;
   if (_configPageUL == 0) return false;
-  if (!waitCard(5000)) return false;  // 読み書きできる状態になるまで待つ
+  if (!ensureCard(5000)) return false;  // 読み書きできる状態にする（選択済みならそのまま）
   memset(ulconf, 0, sizeof(ULConfig));
 
   // 認証がかかっている場合は、まず認証する
@@ -720,7 +1317,7 @@ bool NfcEasyWriter::readConfigDataUL(ULConfigEx* ulconfex, ProtectMode mode) {
 bool NfcEasyWriter::writeConfigDataUL(ULConfig* ulconf, ProtectMode mode) {
   if (mode == PRT_AUTO) mode = _lastProtectMode;
   if (_configPageUL <= 3) return false;
-  if (!waitCard(5000)) return false;  // 読み書きできる状態になるまで待つ
+  if (!ensureCard(5000)) return false;  // 読み書きできる状態にする（選択済みならそのまま）
   byte data[4];
 
   // 認証がかかっている場合は、まず認証する
@@ -754,7 +1351,7 @@ bool NfcEasyWriter::format(bool formatAll) {
 
   // [Ultralight] page.4のNDEFメッセージを削除する（データはpage.5から始まる）
   if (_cardType == CardType::Ultralight) {
-    if (!mfrc522.MIFARE_Ultralight_Write(4, buff, 4) == MFRC522_I2C::STATUS_OK) return false;
+    if (mfrc522.MIFARE_Ultralight_Write(4, buff, 4) != MFRC522_I2C::STATUS_OK) return false;
     // if (!mfrc522.MIFARE_Ultralight_Write(5, &buff[4], 4) == MFRC522_I2C::STATUS_OK) return false;
   }
 
@@ -768,6 +1365,37 @@ bool NfcEasyWriter::format(bool formatAll) {
   return true;
 }
 
+// 通信の統計をリセットする
+void NfcEasyWriter::resetStats() {
+  _stats = NfcStats();
+}
+
+// 操作の所要時間を集計する
+void NfcEasyWriter::addTime(NfcOp op, uint32_t startUs) {
+  uint32_t us = micros() - startUs;
+  NfcOpTime& t = _times[op];
+  t.count ++;
+  t.totalUs += us;
+  if (us > t.maxUs) t.maxUs = us;
+}
+
+// 操作ごとの所要時間の集計をシリアルに表示する
+void NfcEasyWriter::printTimes() {
+  const char* names[NOP_COUNT] = { "detect", "mount", "auth", "read", "write" };
+  spf("NFC timing (I2C %u kHz)\n", mfrc522.busClock() / 1000);
+  sp("  op       count   avg(us)   max(us)");
+  for (int i=0; i<NOP_COUNT; i++) {
+    const NfcOpTime& t = _times[i];
+    uint32_t avg = (t.count > 0) ? t.totalUs / t.count : 0;
+    spf("  %-7s %6u %9u %9u\n", names[i], t.count, avg, t.maxUs);
+  }
+}
+
+// 操作ごとの所要時間の集計をリセットする
+void NfcEasyWriter::resetTimes() {
+  for (int i=0; i<NOP_COUNT; i++) _times[i] = NfcOpTime();
+}
+
 // ファームウェアバージョンのチェック
 bool NfcEasyWriter::firmwareVersionCheck() {
 	byte ver = mfrc522.PCD_ReadRegister(MFRC522_I2C::VersionReg);
@@ -785,6 +1413,7 @@ bool NfcEasyWriter::recoverySectorTruckCL(uint16_t blockAddr, AuthKey* key, bool
   if (! isClassic()) return false;
   if (blockAddr < 7) return false;
   if (blockAddr % 4 != 3) return false;
+  if (!ensureCard(5000)) return false;  // 読み書きできる状態にする（選択済みならそのまま）
   bool abort = false;
 
   // デフォルト時データ作成
@@ -800,7 +1429,7 @@ bool NfcEasyWriter::recoverySectorTruckCL(uint16_t blockAddr, AuthKey* key, bool
   memcpy(&mifarekey, key, sizeof(MFRC522_I2C::MIFARE_Key));
   spf("セクタートレーラー修復 blockAddr=%d key=%s\n", blockAddr, (useKeyB?"B":"A") );
   auto usekey = (useKeyB) ? MFRC522_I2C::PICC_CMD_MF_AUTH_KEY_B : MFRC522_I2C::PICC_CMD_MF_AUTH_KEY_A;
-  if (mfrc522.PCD_Authenticate(usekey, blockAddr, &mifarekey, &(mfrc522.uid)) == MFRC522_I2C::STATUS_OK) {
+  if (mfrc522.PCD_Authenticate(usekey, blockAddr, &mifarekey, &(mfrc522.piccUid())) == MFRC522_I2C::STATUS_OK) {
     // 書き込み
     if (mfrc522.MIFARE_Write(blockAddr, buffer, _writeLengthCL) == MFRC522_I2C::STATUS_OK) {
       if (_debug) sp("  書き込み成功");
@@ -814,7 +1443,7 @@ bool NfcEasyWriter::recoverySectorTruckCL(uint16_t blockAddr, AuthKey* key, bool
   }
 
   // 認証終了
-  mfrc522.PCD_StopCrypto1();
+  stopCryptoCL();
   return !abort;
 }
 
@@ -857,8 +1486,8 @@ bool NfcEasyWriter::recoveryConfigDataUL(bool useAuth, AuthKey* key, ProtectMode
 void NfcEasyWriter::dumpAllBasic() {
   if (! isMounted()) return;
   if (_cardType == CardType::Classic) {
-    if (!waitCard(5000)) return;  // 読み書きできる状態になるまで待つ
-    mfrc522.PICC_DumpToSerial(&(mfrc522.uid));
+    if (!ensureCard(5000)) return;  // 読み書きできる状態にする（選択済みならそのまま）
+    mfrc522.PICC_DumpToSerial(&(mfrc522.piccUid()));
   } else if (_cardType == CardType::Ultralight) {
     mfrc522.PICC_DumpMifareUltralightToSerial();  // この関数は16ページまでしか読まないので全部は見れない
   }
@@ -869,16 +1498,16 @@ void NfcEasyWriter::dumpAll(bool inProtect, uint8_t phySta, uint8_t phyEnd) {
   if (! isMounted()) return;
   byte buffer[18];
   byte bufferSize = sizeof(buffer);
-  if (!waitCard(5000)) return;  // 読み書きできる状態になるまで待つ
+  if (!ensureCard(5000)) return;  // 読み書きできる状態にする（選択済みならそのまま）
   bool debugOrig = _debug;
   _debug = false;
 
   // カード情報
   spn("Card UID: ");
-  for (int i=0; i<mfrc522.uid.size; i++) {
-    spf("%02X ", mfrc522.uid.uidByte[i]);
+  for (int i=0; i<mfrc522.piccUid().size; i++) {
+    spf("%02X ", mfrc522.piccUid().uidByte[i]);
   }
-  sp("\nCard Type: "+String(mfrc522.PICC_GetTypeName(mfrc522.PICC_GetType(mfrc522.uid.sak))));
+  sp("\nCard Type: "+String(mfrc522.PICC_GetTypeName(mfrc522.PICC_GetType(mfrc522.piccUid().sak))));
 
   // Mifare Classicの場合
   if (isClassic()) {
@@ -895,7 +1524,7 @@ void NfcEasyWriter::dumpAll(bool inProtect, uint8_t phySta, uint8_t phyEnd) {
           usekey = MFRC522_I2C::PICC_CMD_MF_AUTH_KEY_A;
           keyRead = (sector == 0) ? _authKeyNdefClassic0 : _authKeyNdefClassic1;
         }
-        if (mfrc522.PCD_Authenticate(usekey, blockAddr, &keyRead, &(mfrc522.uid)) == MFRC522_I2C::STATUS_OK) {
+        if (mfrc522.PCD_Authenticate(usekey, blockAddr, &keyRead, &(mfrc522.piccUid())) == MFRC522_I2C::STATUS_OK) {
           if (mfrc522.MIFARE_Read(blockAddr, buffer, &bufferSize) == MFRC522_I2C::STATUS_OK) {
             String pstr = (protect && block < 3) ? "*" : " ";
             spf("%s%3d / %d |  %3d | ", pstr, sector, block, blockAddr);
@@ -918,7 +1547,7 @@ void NfcEasyWriter::dumpAll(bool inProtect, uint8_t phySta, uint8_t phyEnd) {
       }
       //if (abort) break;
     }
-    mfrc522.PCD_StopCrypto1();
+    stopCryptoCL();
 
   // Mifare Ultralightの場合
   } else if (isUltralight()) {
@@ -926,19 +1555,25 @@ void NfcEasyWriter::dumpAll(bool inProtect, uint8_t phySta, uint8_t phyEnd) {
     char strs[5] = "\0";
     sp("Page : 0  1  2  3  : Text");
     uint8_t maxpage = (_dbgopt & NFCOPT_DUMP_UL255PAGE_READ) ? 255 : _maxPageUL+5;
-    for (uint8_t page=0; page<=(maxpage-2); page+=4) {
+    bool fastReadOrig = _fastReadUL;
+    if (_dbgopt & NFCOPT_DUMP_UL255PAGE_READ) _fastReadUL = false;  // 最終ページ以降はREADでしか読めない
+    byte pagesBuffer[_fastReadPagesUL * 4];
+    uint8_t pages = 0;
+    for (uint16_t page=0; page<=(maxpage-2); page+=pages) {
       if (inProtect && !authed) {
         authUL(false);  // プロテクト時は認証する
         authed = true;
       }
-      if (mfrc522.MIFARE_Read(page, buffer, &bufferSize) == MFRC522_I2C::STATUS_OK) {
-        for (int i=0; i < bufferSize-2; i++) {
+      uint16_t remainPages = maxpage - page + 1;
+      pages = rawReadPagesUL(pagesBuffer, page, (remainPages < _fastReadPagesUL) ? remainPages : _fastReadPagesUL);
+      if (pages > 0) {
+        for (int i=0; i < pages*4; i++) {
           if (i%4 == 0) {
             String pstr = (inProtect && phySta <= (page+i/4)) ? "*" : " ";
             spf("%s%3d : ", pstr, page+i/4);
           }
-          spf("%02X ", buffer[i]);
-          strs[i%4] = (buffer[i] >= 0x20 && buffer[i] <= 0x7F) ? buffer[i] : ' ';
+          spf("%02X ", pagesBuffer[i]);
+          strs[i%4] = (pagesBuffer[i] >= 0x20 && pagesBuffer[i] <= 0x7F) ? pagesBuffer[i] : ' ';
           strs[4] = '\0';
           if (i%4 == 3) {
             spn(": "+String(strs)+"\n");
@@ -955,6 +1590,7 @@ void NfcEasyWriter::dumpAll(bool inProtect, uint8_t phySta, uint8_t phyEnd) {
         break;
       }
     }
+    _fastReadUL = fastReadOrig;
   } else {
     sp("UnknownCard Card Type");
   }
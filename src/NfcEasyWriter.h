@@ -74,19 +74,130 @@ struct ULConfigEx { // Ultralightの設定情報＋参考値
 struct AuthKey {  // 認証キー（Classicは48bit使用、Ultralightは32bit使用）
   byte keyByte[6];
 };
+struct NfcStats { // 通信の統計（所要時間の計測用）
+  uint32_t auths = 0;         // 認証の回数（ClassicのCrypto1、UltralightのPWD_AUTH）
+  uint32_t retries = 0;       // エラー後に選択し直した回数
+  uint32_t blocksRead = 0;    // 読み込んだブロック数（Ultralightは4ページ単位）
+  uint32_t blocksWritten = 0; // 書き込んだブロック数（Ultralightはページ数）
+  uint32_t frames = 0;        // 読み書きのコマンドの回数（認証を除く）
+  uint32_t lastReadUs = 0;    // 最後のreadData()の所要時間
+  uint32_t lastWriteUs = 0;   // 最後のwriteData()の所要時間
+};
+enum NfcOp : uint8_t { NOP_DETECT, NOP_MOUNT, NOP_AUTH, NOP_READ, NOP_WRITE, NOP_COUNT };  // 所要時間を集計する操作
+struct NfcOpTime { // 操作ごとの所要時間の集計（resetStats()ではリセットしない）
+  uint32_t count = 0;     // 回数
+  uint32_t totalUs = 0;   // 合計
+  uint32_t maxUs = 0;     // 最大
+};
+struct SlotHeader { // A/Bスロットのヘッダ 8バイト（データの前に置く）
+  byte magic[2];    // "SL"
+  uint16_t seq;     // 書き込みごとに1増える番号（大きい方が新しい）
+  uint16_t length;  // データ長
+  uint16_t crc;     // magic〜lengthとデータのCRC-16/CCITT
+};
+
+
+//
+// NFCリーダーとカードの送受信のインターフェース
+// NfcEasyWriterはこれだけを使う。実機はMFRC522_I2C_Extend、カードなしで試すときはNfcCardSimulator（test/、PCでのテスト用）
+//
+class NfcTransceiver {
+public:
+  virtual ~NfcTransceiver() {}
+  // リーダー
+  virtual void PCD_Init_without_resetpin() = 0;
+  virtual byte PCD_ReadRegister(byte reg) = 0;
+  // カードの検出・選択・停止
+  virtual bool PICC_IsNewCardPresent() = 0;   // REQA
+  virtual bool PICC_ReadCardSerial() = 0;     // 衝突防止と選択
+  virtual byte PICC_WakeupA(byte* bufferATQA, byte* bufferSize) = 0;  // WUPA
+  virtual byte PICC_HaltA() = 0;
+  virtual MFRC522_I2C::Uid& piccUid() = 0;    // 選択したカードのUIDとSAK
+  virtual byte PICC_GetType(byte sak) = 0;
+  virtual String PICC_GetTypeName(byte piccType) = 0;
+  // Classic
+  virtual byte PCD_Authenticate(byte command, byte blockAddr, MFRC522_I2C::MIFARE_Key* key, MFRC522_I2C::Uid* uid) = 0;
+  virtual void PCD_StopCrypto1() = 0;
+  virtual byte MIFARE_Read(byte blockAddr, byte* buffer, byte* bufferSize) = 0;  // Ultralightは4ページ
+  virtual byte MIFARE_Write(byte blockAddr, byte* buffer, byte bufferSize) = 0;
+  virtual void MIFARE_SetAccessBits(byte* accessBitBuffer, byte g0, byte g1, byte g2, byte g3) = 0;
+  // Ultralight
+  virtual byte MIFARE_Ultralight_Write(byte page, byte* buffer, byte bufferSize) = 0;
+  virtual byte MIFARE_Ultralight_Authenticate(byte* password, byte* passwordLen, byte* pack, byte* packLen) = 0;
+  virtual byte NTAG_FastRead(byte startPage, byte endPage, byte* buffer, byte* bufferSize) = 0;
+  // デバッグ用
+  virtual void PICC_DumpToSerial(MFRC522_I2C::Uid* uid) {}
+  virtual void PICC_DumpMifareUltralightToSerial() {}
+  virtual uint32_t busClock() { return 0; }   // 通信に使うI2Cクロック（I2Cでなければ0）
+};
+
+
+//
+// I2Cバスのクロック切り替え
+//   同じバスにクロックの上限が違うデバイスがつながっている場合に、通信の前にそのデバイスのクロックにする
+//   今のクロックと同じなら何もしない（Wireは1本だけを想定）
+//
+class I2cBusProfile {
+public:
+  static void use(TwoWire* wire, uint32_t clock);
+  static void invalidate() { _clock = 0; }   // ライブラリのbegin()などでクロックが変わった場合に呼ぶ
+private:
+  static uint32_t _clock;
+};
 
 
 //
 // 派生クラスで新しい機能を追加
 //
-class MFRC522_I2C_Extend : public MFRC522_I2C {
+class MFRC522_I2C_Extend : public MFRC522_I2C, public NfcTransceiver {
 public:
+  uint32_t _busClock = 400000U;  // このデバイスと通信するときのI2Cクロック（WS1850SはFast-mode 400kHzまで確認済み）
+  bool _fastIo = true;  // READ/WRITE/FAST_READ/PWD_AUTHはFIFOをまとめて転送し、CRC_Aをソフトウェアで計算する
+
   MFRC522_I2C_Extend(byte chipAddress, byte resetPowerDownPin, TwoWire *TwoWireInstance = &Wire)
-    : MFRC522_I2C(chipAddress, resetPowerDownPin, TwoWireInstance) {}
+    : MFRC522_I2C(chipAddress, resetPowerDownPin, TwoWireInstance), _wire(TwoWireInstance), _chipAddr(chipAddress) {}
   // MFRC522の初期化（MFRC522_I2CのPCD_Init()からリセットピンのGPIOの動作を除いたもの）
-  void PCD_Init_without_resetpin();
+  void PCD_Init_without_resetpin() override;
   // Mifare Ultralightのパスワード認証を行う
-  byte MIFARE_Ultralight_Authenticate(byte* password, byte* passwordLen, byte* pack, byte* packLen);
+  byte MIFARE_Ultralight_Authenticate(byte* password, byte* passwordLen, byte* pack, byte* packLen) override;
+  // NTAGのFAST_READでページ範囲をまとめて読み込む（bufferSizeはページ数×4+CRC 2バイト以上）
+  byte NTAG_FastRead(byte startPage, byte endPage, byte* buffer, byte* bufferSize) override;
+  // 読み書き（_fastIoならFIFOをまとめて転送する）
+  byte MIFARE_Read(byte blockAddr, byte* buffer, byte* bufferSize) override;
+  byte MIFARE_Write(byte blockAddr, byte* buffer, byte bufferSize) override;
+  byte MIFARE_Ultralight_Write(byte page, byte* buffer, byte bufferSize) override;
+  // CRC_A（ISO/IEC 14443-3）を計算する
+  static void crcA(const byte* data, byte length, byte* result);
+
+  // 以下はNfcTransceiverの実装（バスのクロックを合わせてからMFRC522_I2Cの関数をそのまま呼ぶ）
+  byte PCD_ReadRegister(byte reg) override { bus(); return MFRC522_I2C::PCD_ReadRegister(reg); }
+  bool PICC_IsNewCardPresent() override { bus(); return MFRC522_I2C::PICC_IsNewCardPresent(); }
+  bool PICC_ReadCardSerial() override { bus(); return MFRC522_I2C::PICC_ReadCardSerial(); }
+  byte PICC_WakeupA(byte* bufferATQA, byte* bufferSize) override { bus(); return MFRC522_I2C::PICC_WakeupA(bufferATQA, bufferSize); }
+  byte PICC_HaltA() override { bus(); return MFRC522_I2C::PICC_HaltA(); }
+  MFRC522_I2C::Uid& piccUid() override { return uid; }
+  byte PICC_GetType(byte sak) override { return MFRC522_I2C::PICC_GetType(sak); }
+  String PICC_GetTypeName(byte piccType) override { return String(MFRC522_I2C::PICC_GetTypeName(piccType)); }
+  byte PCD_Authenticate(byte command, byte blockAddr, MFRC522_I2C::MIFARE_Key* key, MFRC522_I2C::Uid* uid) override {
+    bus();
+    return MFRC522_I2C::PCD_Authenticate(command, blockAddr, key, uid);
+  }
+  void PCD_StopCrypto1() override { bus(); MFRC522_I2C::PCD_StopCrypto1(); }
+  void MIFARE_SetAccessBits(byte* accessBitBuffer, byte g0, byte g1, byte g2, byte g3) override {
+    MFRC522_I2C::MIFARE_SetAccessBits(accessBitBuffer, g0, g1, g2, g3);
+  }
+  void PICC_DumpToSerial(MFRC522_I2C::Uid* uid) override { bus(); MFRC522_I2C::PICC_DumpToSerial(uid); }
+  void PICC_DumpMifareUltralightToSerial() override { bus(); MFRC522_I2C::PICC_DumpMifareUltralightToSerial(); }
+  uint32_t busClock() override { return _busClock; }
+
+private:
+  TwoWire* _wire;   // MFRC522_I2Cのメンバーは参照できないので別に持つ
+  byte _chipAddr;
+  void bus() { I2cBusProfile::use(_wire, _busClock); }  // バスのクロックをこのデバイスに合わせる
+  void writeFifo(const byte* data, byte count);   // FIFOに1回のI2C転送で書き込む
+  void readFifo(byte* data, byte count);          // FIFOから1回のI2C転送で読み込む
+  byte transceiveFast(const byte* sendData, byte sendLen, byte* backData, byte* backLen, byte* validBits, bool checkCRC);
+  byte mifareTransceiveFast(const byte* sendData, byte sendLen);  // CRC_Aを付けて送り、4ビットのACKを確認する
 };
 
 
@@ -95,7 +206,7 @@ public:
 //
 class NfcEasyWriter {
 public:
-  MFRC522_I2C_Extend& mfrc522;  // MFRC522_I2C オブジェクトの参照を保持
+  NfcTransceiver& mfrc522;  // 送受信に使うオブジェクト（MFRC522_I2C_ExtendかNfcCardSimulator）の参照を保持
   bool _debug = false;  // Serialにデバッグ出力
   uint16_t _dbgopt = 0;   // デバッグオプション
   uint16_t _minSectorCL = 1;   // Classicで使用するセクタの先頭
@@ -106,13 +217,18 @@ public:
   const uint16_t _writeLengthCL = 16;  // Classicの書き込み単位
   const uint16_t _writeLengthUL = 4;   // Ultralightの書き込み単位
   const uint16_t _readLength = 16;     // CL/UL共通の読み込み単位
+  const uint8_t _fastReadPagesUL = 15; // FAST_READで1回に読むページ数（WS1850SのFIFO 64バイトにCRC 2バイトと共に収まる分）
+  bool _fastReadUL = false;   // FAST_READを使う（NTAGのみ。失敗したらREADに戻す）
   MFRC522_I2C::MIFARE_Key _authKeyA = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };  // デフォルトの認証用（通常は変更しない）
   MFRC522_I2C::MIFARE_Key _authKeyB = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };  // プロテクト時の認証用
   MFRC522_I2C::MIFARE_Key _authKeyBDefault = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };  // KeyBのデフォルト値（プロテクト解除時に使う）
   MFRC522_I2C::MIFARE_Key _authKeyNdefClassic0 = { 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5 };  // NDEF書込済Classicの初期値 sector0
   MFRC522_I2C::MIFARE_Key _authKeyNdefClassic1 = { 0xD3, 0xF7, 0xD3, 0xF7, 0xD3, 0xF7 };  // NDEF書込済Classicの初期値 sector1以降
   bool _authedUL = true;    // 認証済みフラグ
+  bool _selected = false;   // カードを選択済み（Ultralightは読み書きの間も選択されたまま、Classicは認証終了で解除）
   ProtectMode _lastProtectMode = PRT_NOPASS_RW;  // 最後に設定したプロテクトモード 内部参照用
+  NfcStats _stats;   // 通信の統計
+  NfcOpTime _times[NOP_COUNT];  // 操作ごとの所要時間
 
   // マウント時のカード情報
   bool _mounted = false;
@@ -120,7 +236,7 @@ public:
   NtagType _ntagType = NT_UNKNOWN;
 
   // コンストラクタ　MFRC522_I2C の参照を受け取る
-  NfcEasyWriter(MFRC522_I2C_Extend& ref) : mfrc522(ref) {}
+  NfcEasyWriter(NfcTransceiver& ref) : mfrc522(ref) {}
 
   // 初期化
   void init();
@@ -128,8 +244,17 @@ public:
   // 読み書きできる状態になるまで待つ
   bool waitCard(uint32_t timeout=5000);
 
-  // カードをマウントする（読み書きできる状態になるまで待つ）
-  bool mountCard(uint32_t timeout=0, ProtectMode mode=PRT_AUTO);
+  // カードが置かれているか1回だけ調べる（見つかれば選択する）
+  bool detectCard();
+
+  // 選択し直す（待ち時間なし）
+  bool reselectCard();
+
+  // 読み書きできる状態にする（選択済みなら何もしない）
+  bool ensureCard(uint32_t timeout=5000);
+
+  // カードをマウントする（読み書きできる状態になるまで待つ）　resetReader=falseならdetectCard()で選択したカードを使う
+  bool mountCard(uint32_t timeout=0, ProtectMode mode=PRT_AUTO, bool resetReader=true);
 
   // カードのマウントを解除する
   void unmountCard();
@@ -138,7 +263,7 @@ public:
   String getUidString();
 
   // カードの種類を大まかに判定する
-  CardType checkCardType(MFRC522_I2C &mfrc522);
+  CardType checkCardType(NfcTransceiver &mfrc522);
 
   // カードがマウントされているか？（mountCard()が成功したか見てるだけ）
   bool isMounted();
@@ -164,6 +289,9 @@ public:
   // [Ultralight] 物理アドレス指定　4ページ(16バイト)読み込む
   bool rawReadUL(byte* data, size_t dataSize, uint8_t page);
 
+  // [Ultralight] 物理アドレス指定　複数ページをまとめて読み込む（NTAGはFAST_READ、それ以外はREAD）
+  uint8_t rawReadPagesUL(byte* data, uint8_t startPage, uint8_t maxPages);
+
   // [Ultralight] 物理アドレス指定　1ページ(4バイト)書き込む
   bool rawWriteUL(byte* data, size_t dataSize, uint8_t page);
 
@@ -180,6 +308,40 @@ public:
   bool writeDataCL(uint16_t vaddr, byte* data, size_t dataSize, ProtectMode mode=PRT_AUTO);  // for Classic
   bool writeDataUL(uint16_t vaddr, byte* data, size_t dataSize, ProtectMode mode=PRT_AUTO);  // for Ultralight
 
+  // A/Bの2スロットの古い方にデータを書き込み、書き込んだ範囲だけ読み返して確認する（両方無効ならスロットB）
+  // （vaddrからslotSize×2バイトを使用する。slotSizeは16の倍数でヘッダ8バイト＋データが入る大きさ）
+  // forceSlotに0(A)/1(B)を指定すると、古い方ではなくそのスロットに書く（他のデータと重なる位置を避けたいとき）
+  bool writeSlot(uint16_t vaddr, uint16_t slotSize, const void* data, size_t dataSize, ProtectMode mode=PRT_AUTO, int8_t forceSlot=-1);
+
+  // A/Bの2スロットのうち有効で新しい方のデータを読み込む（読み込んだデータ長を返す、有効なスロットがなければ0）
+  // usedSlotには読み込んだスロット(0=A, 1=B, -1=なし)を返す
+  size_t readSlot(uint16_t vaddr, uint16_t slotSize, void* data, size_t dataSize, ProtectMode mode=PRT_AUTO, int8_t* usedSlot=nullptr);
+
+  // [Ultralight] page.4からNDEFコンテナのヘッダを書き込む（NDEF Message TLV + NULL TLV + Proprietary TLV）
+  //   NDEF Messageには外部タイプ(type)のレコードを1個入れ、payloadはinfo（公開してよい情報のみ）
+  //   Proprietary TLVの値がdataSizeバイトのデータ領域で、ヘッダの次の16バイト境界から始まる（仮想アドレスをdataVaddrに返す）
+  //   データ領域の後ろにTerminator TLVを書き込む。同じヘッダが書き込み済みなら書き込まない
+  bool writeNdefContainerUL(const char* type, const byte* info, uint8_t infoLen, uint16_t dataSize, uint16_t* dataVaddr, ProtectMode mode=PRT_AUTO);
+
+  // [Ultralight] page.4からNDEFコンテナを探し、データ領域の仮想アドレスと大きさを返す（typeが違えばfalse）
+  //   ヘッダのページだけ読むので、データ領域にプロテクトがかかっていても認証なしで読める
+  bool findNdefContainerUL(const char* type, uint16_t* dataVaddr, uint16_t* dataSize);
+
+  // CRC-16/CCITT(初期値0xFFFF)を計算する
+  static uint16_t crc16(const byte* data, size_t dataSize, uint16_t crc=0xFFFF);
+
+  // 操作の所要時間を集計する
+  void addTime(NfcOp op, uint32_t startUs);
+
+  // [Classic] ブロックが属するセクタを認証する
+  bool authCL(uint16_t blockAddr, bool useKeyB);
+
+  // [Classic] エラーの後にカードを選択し直す
+  bool reselectCL();
+
+  // [Classic] 認証を終了する
+  void stopCryptoCL();
+
   // 認証キーを設定する（書き込みはしない）
   void setAuthKey(AuthKey* key);
   void setAuthKey(MFRC522_I2C::MIFARE_Key* key);
@@ -192,6 +354,9 @@ public:
   bool writeProtectCL(ProtectMode mode, AuthKey* key, uint16_t vaddr, int size, ProtectMode lastmode=PRT_AUTO); // Classic
   bool writeProtectUL(ProtectMode mode, AuthKey* key, uint16_t vaddr, bool phyaddr=false, ProtectMode lastmode=PRT_AUTO); // Ultralight
 
+  // [Classic] 指定した仮想アドレスのセクタのプロテクトモードを読み込む（読めなければPRT_AUTO）
+  ProtectMode readProtectModeCL(uint16_t vaddr);
+
   // [Ultralight] パスワード認証を行う
   bool authUL(bool checkPack=true);
 
@@ -208,6 +373,13 @@ public:
   // データ領域のフォーマット（NDEFメッセージを削除する）
   bool format(bool formatAll);
 
+  // 通信の統計をリセットする
+  void resetStats();
+
+  // 操作ごとの所要時間の集計をシリアルに表示する / リセットする
+  void printTimes();
+  void resetTimes();
+
   // ファームウェアバージョンのチェック
   bool firmwareVersionCheck();
 
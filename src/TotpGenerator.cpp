@@ -0,0 +1,213 @@
+/*
+  TotpGenerator.cpp
+  ワンタイムパスワード(TOTP)を高速に生成するクラス
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#include "TotpGenerator.h"
+#include <Base32-Decode.h>
+
+// 10のべき乗のテーブル（桁数で丸める際の除数）
+static constexpr uint64_t kPow10[TotpGenerator::DIGITS_MAX+1] = {
+  1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+  10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+};
+
+// アルゴリズムの定義
+const TotpGenerator::AlgoDef TotpGenerator::_algoDefs[] = {
+  { TOTP_ALGO_SHA1,   MBEDTLS_MD_SHA1,    64, "SHA1" },
+  { TOTP_ALGO_SHA256, MBEDTLS_MD_SHA256,  64, "SHA256" },
+  { TOTP_ALGO_SHA512, MBEDTLS_MD_SHA512, 128, "SHA512" },
+};
+
+// コンストラクタ
+TotpGenerator::TotpGenerator() {
+  mbedtls_md_init(&_inner);
+  mbedtls_md_init(&_outer);
+  mbedtls_md_init(&_work);
+}
+
+// デストラクタ　中間状態を消去する
+TotpGenerator::~TotpGenerator() {
+  end();
+}
+
+// 秘密鍵をBase32文字列で指定する
+bool TotpGenerator::begin(const char* secretBase32, uint8_t period, uint8_t digits, uint8_t algorithm) {
+  if (secretBase32 == nullptr) return false;
+  size_t maxOut = strlen(secretBase32);
+  if (maxOut > SECRET_MAXLEN) maxOut = SECRET_MAXLEN;
+  uint8_t key[SECRET_MAXLEN];
+  int decLen = base32decode(secretBase32, key, maxOut);
+  if (decLen <= 0) return false;
+  bool res = begin(key, decLen, period, digits, algorithm);
+  memset(key, 0, sizeof(key));
+  return res;
+}
+
+// 秘密鍵をデコード済みのバイト列で指定し、HMACの中間状態を計算する
+bool TotpGenerator::begin(const uint8_t* key, size_t keyLen, uint8_t period, uint8_t digits, uint8_t algorithm) {
+  end();
+  if (key == nullptr || keyLen == 0 || period == 0) return false;
+  if (digits < DIGITS_MIN || digits > DIGITS_MAX) return false;
+  const AlgoDef* algo = findAlgo(algorithm);
+  if (algo == nullptr) return false;
+  const mbedtls_md_info_t* mdInfo = mbedtls_md_info_from_type(algo->mdType);
+  if (mdInfo == nullptr) return false;
+  if (mbedtls_md_setup(&_inner, mdInfo, 0) != 0) return false;
+  if (mbedtls_md_setup(&_outer, mdInfo, 0) != 0) return false;
+  if (mbedtls_md_setup(&_work, mdInfo, 0) != 0) return false;
+  uint8_t blockSize = algo->blockSize;
+  _hashSize = mbedtls_md_get_size(mdInfo);
+
+  // ブロック長より長い鍵はハッシュ化する（RFC 2104）
+  uint8_t k[BLOCK_MAXSIZE] = {0};
+  if (keyLen > blockSize) {
+    mbedtls_md(mdInfo, key, keyLen, k);
+  } else {
+    memcpy(k, key, keyLen);
+  }
+
+  // ipad/opadを1ブロック処理した中間状態を保存しておく
+  uint8_t pad[BLOCK_MAXSIZE];
+  for (int i=0; i<blockSize; i++) pad[i] = k[i] ^ 0x36;
+  mbedtls_md_starts(&_inner);
+  mbedtls_md_update(&_inner, pad, blockSize);
+  for (int i=0; i<blockSize; i++) pad[i] = k[i] ^ 0x5C;
+  mbedtls_md_starts(&_outer);
+  mbedtls_md_update(&_outer, pad, blockSize);
+  memset(k, 0, sizeof(k));
+  memset(pad, 0, sizeof(pad));
+
+  _period = period;
+  _digits = digits;
+  _ready = true;
+  return true;
+}
+
+// 秘密鍵と中間状態を消去する
+void TotpGenerator::end() {
+  mbedtls_md_free(&_inner);
+  mbedtls_md_free(&_outer);
+  mbedtls_md_free(&_work);
+  mbedtls_md_init(&_inner);
+  mbedtls_md_init(&_outer);
+  mbedtls_md_init(&_work);
+  _ready = false;
+}
+
+// HOTPの値を計算する（RFC 4226 Dynamic Truncation）
+uint32_t TotpGenerator::hotp(uint64_t counter) {
+  if (!_ready) return 0;
+  uint8_t msg[8];
+  for (int i=7; i>=0; i--) {
+    msg[i] = counter & 0xFF;
+    counter >>= 8;
+  }
+
+  // inner = H((K^ipad) || msg)　中間状態を複製して続きから計算する
+  uint8_t hash[HASH_MAXSIZE];
+  mbedtls_md_clone(&_work, &_inner);
+  mbedtls_md_update(&_work, msg, sizeof(msg));
+  mbedtls_md_finish(&_work, hash);
+
+  // outer = H((K^opad) || inner)
+  mbedtls_md_clone(&_work, &_outer);
+  mbedtls_md_update(&_work, hash, _hashSize);
+  mbedtls_md_finish(&_work, hash);
+
+  uint8_t offset = hash[_hashSize-1] & 0x0F;
+  uint32_t bin = ((uint32_t)(hash[offset] & 0x7F) << 24)
+               | ((uint32_t)hash[offset+1] << 16)
+               | ((uint32_t)hash[offset+2] << 8)
+               |  (uint32_t)hash[offset+3];
+  return bin;
+}
+
+// 指定時刻のコードを取得する
+bool TotpGenerator::getCode(time_t epoch, char* code, size_t codeSize) {
+  if (!_ready || code == nullptr || codeSize < (size_t)_digits+1) return false;
+  formatCode(hotp((uint64_t)epoch / _period), code);
+  return true;
+}
+
+// 指定時刻の前後のコードをまとめて取得する
+int TotpGenerator::getCodes(time_t epoch, int from, int count, char (*codes)[TOTP_CODE_BUFSIZE]) {
+  if (!_ready || codes == nullptr) return 0;
+  int64_t step = (int64_t)((uint64_t)epoch / _period);
+  for (int i=0; i<count; i++) {
+    formatCode(hotp((uint64_t)(step + from + i)), codes[i]);
+  }
+  return count;
+}
+
+// 桁数で丸めて0埋めの文字列にする
+void TotpGenerator::formatCode(uint32_t value, char* code) {
+  uint64_t v = (uint64_t)value % kPow10[_digits];  // 桁数による分岐はせずテーブルの除数で丸める
+  for (int i=_digits-1; i>=0; i--) {
+    code[i] = '0' + (v % 10);
+    v /= 10;
+  }
+  code[_digits] = '\0';
+}
+
+// アルゴリズムの定義を探す
+const TotpGenerator::AlgoDef* TotpGenerator::findAlgo(uint8_t algorithm) {
+  for (size_t i=0; i<sizeof(_algoDefs)/sizeof(_algoDefs[0]); i++) {
+    if (_algoDefs[i].algorithm == algorithm) return &_algoDefs[i];
+  }
+  return nullptr;
+}
+
+// アルゴリズム名を返す
+const char* TotpGenerator::algorithmName(uint8_t algorithm) {
+  const AlgoDef* algo = findAlgo(algorithm);
+  return (algo != nullptr) ? algo->name : "";
+}
+
+// アルゴリズム名からTotpAlgorithmを返す（大文字小文字は区別しない、不明なら0）
+uint8_t TotpGenerator::algorithmFromName(const char* name, size_t len) {
+  if (name == nullptr) return 0;
+  for (size_t i=0; i<sizeof(_algoDefs)/sizeof(_algoDefs[0]); i++) {
+    const char* def = _algoDefs[i].name;
+    if (strlen(def) == len && strncasecmp(def, name, len) == 0) return _algoDefs[i].algorithm;
+  }
+  return 0;
+}
+
+// RFC 6238 Appendix B のテストベクタで自己診断する
+bool TotpGenerator::selfTest(bool verbose) {
+  struct Vector {
+    time_t epoch;
+    const char* code[3];  // SHA1, SHA256, SHA512
+  };
+  const Vector vectors[] = {
+    {          59, { "94287082", "46119246", "90693936" } },
+    {  1111111109, { "07081804", "68084774", "25091201" } },
+    {  1111111111, { "14050471", "67062674", "99943326" } },
+    {  1234567890, { "89005924", "91819424", "93441116" } },
+    {  2000000000, { "69279037", "90698825", "38618901" } },
+    { 20000000000, { "65353130", "77737706", "47863826" } },
+  };
+  const char* seed = "1234567890123456789012345678901234567890123456789012345678901234";
+  const uint8_t keyLens[3] = { 20, 32, 64 };
+  const uint8_t algos[3] = { TOTP_ALGO_SHA1, TOTP_ALGO_SHA256, TOTP_ALGO_SHA512 };
+
+  bool pass = true;
+  TotpGenerator totp;
+  for (int a=0; a<3; a++) {
+    if (!totp.begin(reinterpret_cast<const uint8_t*>(seed), keyLens[a], 30, 8, algos[a])) return false;
+    for (size_t i=0; i<sizeof(vectors)/sizeof(vectors[0]); i++) {
+      char code[TOTP_CODE_BUFSIZE];
+      totp.getCode(vectors[i].epoch, code, sizeof(code));
+      bool ok = (strcmp(code, vectors[i].code[a]) == 0);
+      if (!ok) pass = false;
+      if (verbose) {
+        TOTP_PRINTF("  %-6s %11lld %s %s\n", algorithmName(algos[a]), (long long)vectors[i].epoch, code, (ok ? "PASS" : "FAIL"));
+      }
+    }
+  }
+  return pass;
+}
@@ -0,0 +1,102 @@
+/*
+  TotpGenerator.h
+  ワンタイムパスワード(TOTP)を高速に生成するクラス
+
+  秘密鍵のBase32デコードとHMACの鍵スケジュール(ipad/opadを処理した中間状態)を
+  begin()で一度だけ計算し、以降はコード1つにつき圧縮関数2回で生成する
+  ハッシュはSHA1/SHA256/SHA512に対応（mbedtlsのmd APIを使用）
+  Arduinoに依存しないので、PCでもmbedtlsとBase32-Decodeがあればコンパイルできる
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#pragma once
+#ifdef ARDUINO
+  #include <Arduino.h>
+  #define TOTP_PRINTF  Serial.printf
+#else
+  #include <cstdint>
+  #include <cstddef>
+  #include <cstdio>
+  #include <cstring>
+  #include <ctime>
+  #include <strings.h>
+  #define TOTP_PRINTF  printf
+#endif
+#include "mbedtls/md.h"
+
+#define TOTP_CODE_BUFSIZE  12   // コード文字列のバッファサイズ（最大桁数+終端）
+
+// SHAの実装（コンパイル時に決定される。mbedtlsのmd APIがどちらかに振り分ける）
+#if defined(CONFIG_MBEDTLS_HARDWARE_SHA)
+  #define TOTP_SHA_BACKEND "ESP32 hardware SHA"
+#else
+  #define TOTP_SHA_BACKEND "software"
+#endif
+
+// ハッシュアルゴリズム（TotpParams::algorithmの値）
+enum TotpAlgorithm : uint8_t {
+  TOTP_ALGO_SHA1 = 1,
+  TOTP_ALGO_SHA256 = 2,
+  TOTP_ALGO_SHA512 = 3,
+};
+
+class TotpGenerator {
+public:
+  static const uint8_t SECRET_MAXLEN = 64;  // デコード後の秘密鍵の最大長
+  static const uint8_t BLOCK_MAXSIZE = 128; // ブロック長の最大値（SHA512）
+  static const uint8_t HASH_MAXSIZE = 64;   // 出力長の最大値（SHA512）
+  static const uint8_t DIGITS_MIN = 6;      // コードの最小桁数
+  static const uint8_t DIGITS_MAX = 10;     // コードの最大桁数（31bit値なので10桁で全範囲）
+
+  TotpGenerator();
+  ~TotpGenerator();
+
+  // 秘密鍵を設定し、HMACの中間状態を計算する
+  bool begin(const char* secretBase32, uint8_t period=30, uint8_t digits=6, uint8_t algorithm=TOTP_ALGO_SHA1);   // Base32文字列で指定
+  bool begin(const uint8_t* key, size_t keyLen, uint8_t period=30, uint8_t digits=6, uint8_t algorithm=TOTP_ALGO_SHA1);  // デコード済みのバイト列で指定
+
+  // 秘密鍵と中間状態を消去する
+  void end();
+
+  // 使用可能な状態か？
+  bool isReady() { return _ready; }
+
+  // HOTPの値を計算する（桁数で丸める前の31bit値）
+  uint32_t hotp(uint64_t counter);
+
+  // 指定時刻のコードを取得する
+  bool getCode(time_t epoch, char* code, size_t codeSize);
+
+  // 指定時刻の前後のコードをまとめて取得する（from=-1, count=3 なら前/現在/次）
+  int getCodes(time_t epoch, int from, int count, char (*codes)[TOTP_CODE_BUFSIZE]);
+
+  // RFC 6238 Appendix B のテストベクタで自己診断する
+  static bool selfTest(bool verbose=false);
+
+  // アルゴリズム名（"SHA1"等）とTotpAlgorithmの相互変換
+  static const char* algorithmName(uint8_t algorithm);
+  static uint8_t algorithmFromName(const char* name, size_t len);
+
+private:
+  mbedtls_md_context_t _inner;  // ipadを処理した後の中間状態
+  mbedtls_md_context_t _outer;  // opadを処理した後の中間状態
+  mbedtls_md_context_t _work;   // 計算用
+  bool _ready = false;
+  uint8_t _period = 30;
+  uint8_t _digits = 6;
+  uint8_t _hashSize = 20;
+
+  // アルゴリズムごとのmd種別とブロック長
+  struct AlgoDef {
+    uint8_t algorithm;
+    mbedtls_md_type_t mdType;
+    uint8_t blockSize;
+    const char* name;
+  };
+  static const AlgoDef _algoDefs[];
+  static const AlgoDef* findAlgo(uint8_t algorithm);
+
+  void formatCode(uint32_t value, char* code);
+};
@@ -0,0 +1,455 @@
+/*
+  benchmark.h
+  開発者向けベンチマーク　結果はシリアルに出力する
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#pragma once
+
+#include "common.h"
+#include "TotpGenerator.h"
+#include <Base32-Decode.h>
+#include "mbedtls/md.h"
+#include "mbedtls/aes.h"
+#include "mbedtls/gcm.h"
+#include "esp_heap_caps.h"
+#include "DinMeterUI.h"
+extern DinMeterUI ui;
+
+// ベンチマーク用のテストデータ（RFC 6238の秘密鍵 "12345678901234567890"）
+const char BENCH_SECRET_B32[] = "GEZDGNBVGY3TQOJQGEZDGNBVGY3TQOJQ";
+const time_t BENCH_EPOCH = 1700000000;
+// 記録済みのエクスポートデータ（3件中1件はHOTPなので除外される）
+const char BENCH_MIGRATION_URI[] = "otpauth-migration://offline?data=Cj8KFDEyMzQ1Njc4OTAxMjM0NTY3ODkwEhhFeGFtcGxlOmFsaWNlQGdvb2dsZS5jb20aB0V4YW1wbGUgASgBMAIKNgog"
+  "AAECAwQFBgcICQoLDA0ODxAREhMUFRYXGBkaGxwdHh8SA2JvYhoHQUNNRSBDbyACKAIwAgolCgpob3Rwc2VjcmV0Eglob3RwLXVzZXIaBEhPVFAgASgBMAE4BRABGAEgACiVmu86";
+struct BenchMigrationExpect {
+  const char* issuer;
+  const char* account;
+  const char* secret;
+  uint8_t algorithm, digit, period;
+};
+const BenchMigrationExpect BENCH_MIGRATION_EXPECT[2] = {
+  { "Example", "alice@google.com", "GEZDGNBVGY3TQOJQGEZDGNBVGY3TQOJQ", TOTP_ALGO_SHA1, 6, 30 },
+  { "ACME Co", "bob", "AAAQEAYEAUDAOCAJBIFQYDIOB4IBCEQTCQKRMFYYDENBWHA5DYPQ", TOTP_ALGO_SHA256, 8, 30 },
+};
+const char BENCH_URI[] = "otpauth://totp/ACME%20Co:%20john.doe%40email.com?secret=HXDMVJECJJWSRB3HWIZR4IFUGFTMXBOZ"
+                         "&issuer=ACME+Co&algorithm=SHA256&digits=8&period=60";
+
+//--------------------------------------------------------------
+// 全てのベンチマークを実行する
+//--------------------------------------------------------------
+void runBenchmarks() {
+  sp("\n===== Benchmark start =====");
+  benchmarkTotp();
+  benchmarkUriParse();
+  benchmarkMigration();
+  benchmarkVault();
+  benchmarkCrypto();
+  benchmarkImage();
+  sp("===== Benchmark end =====\n");
+}
+
+//--------------------------------------------------------------
+// TOTP生成の速度　従来方式(毎回デコード＋HMAC)と鍵スケジュールキャッシュの比較
+//--------------------------------------------------------------
+void benchmarkTotp() {
+  const int loops = 300;   // funcOtpShow()の1秒分（前/現在/次）× loops
+  char codes[3][TOTP_CODE_BUFSIZE];
+  char legacy[3][TOTP_CODE_BUFSIZE];
+  uint32_t tm;
+
+  // RFC 6238のテストベクタ
+  bool pass = TotpGenerator::selfTest(true);
+  spf("[TOTP] selfTest %s  (SHA backend: %s)\n", (pass ? "PASS" : "FAIL"), TOTP_SHA_BACKEND);
+
+  // 従来方式　コードごとにBase32デコードしてHMACを最初から計算する
+  const mbedtls_md_info_t* sha1 = mbedtls_md_info_from_type(MBEDTLS_MD_SHA1);
+  tm = micros();
+  for (int n=0; n<loops; n++) {
+    for (int i=0; i<3; i++) {
+      uint8_t key[TotpGenerator::SECRET_MAXLEN];
+      int decLen = base32decode(BENCH_SECRET_B32, key, strlen(BENCH_SECRET_B32));
+      uint64_t counter = (BENCH_EPOCH + n*30) / 30 + (i-1);
+      uint8_t msg[8];
+      for (int j=7; j>=0; j--) {
+        msg[j] = counter & 0xFF;
+        counter >>= 8;
+      }
+      uint8_t hash[20];
+      mbedtls_md_hmac(sha1, key, decLen, msg, sizeof(msg), hash);
+      uint8_t offset = hash[19] & 0x0F;
+      uint32_t bin = ((uint32_t)(hash[offset] & 0x7F) << 24) | ((uint32_t)hash[offset+1] << 16)
+                   | ((uint32_t)hash[offset+2] << 8) | (uint32_t)hash[offset+3];
+      snprintf(legacy[i], sizeof(legacy[i]), "%06u", bin % 1000000);
+    }
+  }
+  uint32_t tmLegacy = micros() - tm;
+
+  // 新方式　一度だけ鍵スケジュールを計算し、まとめて生成する
+  tm = micros();
+  TotpGenerator totp;
+  totp.begin(BENCH_SECRET_B32, 30, 6);
+  for (int n=0; n<loops; n++) {
+    totp.getCodes(BENCH_EPOCH + n*30, -1, 3, codes);
+  }
+  uint32_t tmCached = micros() - tm;
+
+  // 結果の一致確認（最後の1回分）
+  bool same = true;
+  for (int i=0; i<3; i++) {
+    if (strcmp(legacy[i], codes[i]) != 0) same = false;
+  }
+
+  // 結果
+  int total = loops * 3;
+  sp("[TOTP] codes/sec");
+  spf("  legacy (decode+HMAC per code) : %8.0f  (%u us / %d codes)\n", total * 1e6 / tmLegacy, tmLegacy, total);
+  spf("  cached (HMAC midstate, batch) : %8.0f  (%u us / %d codes)\n", total * 1e6 / tmCached, tmCached, total);
+  spf("  speedup x%.1f, result %s\n", (float)tmLegacy / tmCached, tf(same).c_str());
+
+  // アルゴリズムごとのスループット
+  const uint8_t algos[3] = { TOTP_ALGO_SHA1, TOTP_ALGO_SHA256, TOTP_ALGO_SHA512 };
+  sp("[TOTP] codes/sec by algorithm");
+  for (int a=0; a<3; a++) {
+    totp.begin(BENCH_SECRET_B32, 30, 6, algos[a]);
+    tm = micros();
+    for (int n=0; n<loops; n++) {
+      totp.getCodes(BENCH_EPOCH + n*30, -1, 3, codes);
+    }
+    uint32_t tmAlgo = micros() - tm;
+    spf("  %-6s : %8.0f  (%u us / %d codes)\n", TotpGenerator::algorithmName(algos[a]), total * 1e6 / tmAlgo, tmAlgo, total);
+  }
+}
+
+//--------------------------------------------------------------
+// URIパースの速度とヒープ確保　ランダムに壊したURIでも範囲外アクセスしないか確認する
+//--------------------------------------------------------------
+void benchmarkUriParse() {
+  const int loops = 1000;
+  const size_t uriLen = strlen(BENCH_URI);
+  char buff[256];
+  TotpParams tp;
+  multi_heap_info_t before, after;
+  bool debugOrig = debug;
+  debug = false;  // パース結果のデバッグ出力を止める
+
+  // 正常なURIを繰り返しパースする（ヒープの確保ブロック数の差を見る）
+  heap_caps_get_info(&before, MALLOC_CAP_DEFAULT);
+  uint32_t tm = micros();
+  int ok = 0;
+  for (int n=0; n<loops; n++) {
+    memcpy(buff, BENCH_URI, uriLen);
+    if (parseUriOTP(&tp, buff, uriLen)) ok ++;
+  }
+  tm = micros() - tm;
+  heap_caps_get_info(&after, MALLOC_CAP_DEFAULT);
+  sp("[URI parse]");
+  spf("  %d/%d parsed, %.1f us/parse\n", ok, loops, (float)tm / loops);
+  spf("  heap blocks delta %d, free bytes delta %d\n",
+    (int)after.allocated_blocks - (int)before.allocated_blocks, (int)after.total_free_bytes - (int)before.total_free_bytes);
+
+  // 変異を加えたURIでパースする（結果の文字列が配列内で終端していること）
+  const int mutations = 5000;
+  const char symbols[] = "%=&?:+";
+  int accepted = 0;
+  bool bounded = true;
+  for (int n=0; n<mutations; n++) {
+    size_t len = uriLen;
+    memcpy(buff, BENCH_URI, len);
+    int m = 1 + esp_random() % 8;
+    for (int k=0; k<m; k++) {
+      size_t pos = esp_random() % len;
+      switch (esp_random() % 3) {
+        case 0:   // 置換
+          buff[pos] = (char)(esp_random() & 0xFF);
+          break;
+        case 1:   // 削除
+          if (len > 1) { memmove(buff+pos, buff+pos+1, len-pos-1); len--; }
+          break;
+        case 2:   // 区切り文字の挿入
+          if (len < sizeof(buff)-1) { memmove(buff+pos+1, buff+pos, len-pos); buff[pos] = symbols[esp_random() % (sizeof(symbols)-1)]; len++; }
+          break;
+      }
+    }
+    TotpParams res;
+    if (parseUriOTP(&res, buff, len)) accepted ++;
+    if (strnlen(res.issuer, sizeof(res.issuer)) == sizeof(res.issuer)
+     || strnlen(res.account, sizeof(res.account)) == sizeof(res.account)
+     || strnlen(res.secret, sizeof(res.secret)) == sizeof(res.secret)) bounded = false;
+  }
+  debug = debugOrig;
+  spf("  mutated %d, accepted %d, bounded %s\n", mutations, accepted, tf(bounded).c_str());
+}
+
+//--------------------------------------------------------------
+// Google Authenticatorのエクスポートのデコード　記録済みのデータで結果を確認する
+//--------------------------------------------------------------
+void benchmarkMigration() {
+  const int loops = 100;
+  const size_t uriLen = strlen(BENCH_MIGRATION_URI);
+  char buff[512];
+  std::vector<TotpParams> tps;
+  tps.reserve(4);
+  MigrationBatch batch;
+  bool debugOrig = debug;
+  debug = false;
+
+  // デコード結果の確認
+  memcpy(buff, BENCH_MIGRATION_URI, uriLen);
+  bool res = parseMigrationUri(buff, uriLen, &tps, &batch);
+  bool same = (res && tps.size() == 2 && batch.skipped == 1 && batch.batchSize == 1 && batch.batchId == 123456789);
+  for (size_t i=0; same && i<tps.size(); i++) {
+    const TotpParams& a = tps[i];
+    const BenchMigrationExpect& b = BENCH_MIGRATION_EXPECT[i];
+    same = (strcmp(a.issuer, b.issuer) == 0 && strcmp(a.account, b.account) == 0 && strcmp(a.secret, b.secret) == 0
+         && a.algorithm == b.algorithm && a.digit == b.digit && a.period == b.period);
+  }
+
+  // 速度
+  uint32_t tm = micros();
+  for (int n=0; n<loops; n++) {
+    tps.clear();
+    memcpy(buff, BENCH_MIGRATION_URI, uriLen);
+    parseMigrationUri(buff, uriLen, &tps, &batch);
+  }
+  tm = micros() - tm;
+  for (TotpParams& tp : tps) memset(tp.secret, 0, sizeof(tp.secret));
+  debug = debugOrig;
+  sp("[Migration decode]");
+  spf("  recorded payload %s, %.1f us/decode (%d bytes)\n", (same ? "PASS" : "FAIL"), (float)tm / loops, uriLen);
+}
+
+//--------------------------------------------------------------
+// OTP一覧の取得時間　保存ファイル＋索引と旧形式(1アカウント1ファイル)の比較
+//   ベンチマーク用のファイルを作って計測し、最後に削除する
+//--------------------------------------------------------------
+void benchmarkVault() {
+  const String benchVault = "/bench_vault.bin";
+  const String benchDir = "/bench";
+  const int counts[3] = { 10, 100, 500 };
+  const int legacyMax = 100;  // 旧形式はFATのクラスタを1ファイル1つ使うので100件まで
+  bool debugOrig = debug;
+  debug = false;
+
+  sp("[OTP list] accounts : legacy files / vault index load / list from RAM (us)");
+  for (int c=0; c<3; c++) {
+    int cnt = counts[c];
+    TotpParams tp;
+    std::vector<TotpParams> records(cnt);
+    for (int i=0; i<cnt; i++) {
+      snprintf(records[i].issuer, sizeof(TotpParams::issuer), "bench");
+      snprintf(records[i].account, sizeof(TotpParams::account), "user%03d", i);
+    }
+
+    // 旧形式　ディレクトリを走査してファイルごとにサイズ確認と読み込み
+    uint32_t tmLegacy = 0;
+    if (cnt <= legacyMax) {
+      FFat.mkdir(benchDir);
+      for (int i=0; i<cnt; i++) saveFile(&records[i], sizeof(TotpParams), benchDir + "/otp-" + String(i) + ".bin");
+      uint32_t tm = micros();
+      std::vector<OtpIndex> list;
+      File root = FFat.open(benchDir);
+      File file = root.openNextFile();
+      while (file) {
+        String filename = benchDir + "/" + file.name();
+        file = root.openNextFile();
+        if (getFileSize(filename) != sizeof(TotpParams)) continue;
+        if (loadFile(&tp, sizeof(TotpParams), filename) == sizeof(TotpParams)) list.push_back(makeOtpIndex(list.size(), &tp));
+      }
+      root.close();
+      tmLegacy = micros() - tm;
+      for (int i=0; i<cnt; i++) FFat.remove(benchDir + "/otp-" + String(i) + ".bin");
+      FFat.rmdir(benchDir);
+    }
+
+    // 保存ファイル　起動時の索引の読み込みと、メニュー表示時の一覧取得
+    vaultCreate(benchVault);
+    uint16_t slots = 0;
+    vaultAppend(benchVault, records.data(), cnt, &slots);
+    VaultHeader header;
+    std::vector<OtpIndex> index;
+    uint16_t tombstones;
+    uint32_t tm = micros();
+    vaultReadIndex(benchVault, &header, &index, &tombstones);
+    uint32_t tmLoad = micros() - tm;
+    tm = micros();
+    std::vector<OtpIndex> list = index;
+    uint32_t tmList = micros() - tm;
+    FFat.remove(benchVault);
+
+    if (cnt <= legacyMax) {
+      spf("  %4d : %9u / %9u / %6u\n", cnt, tmLegacy, tmLoad, tmList);
+    } else {
+      spf("  %4d : %9s / %9u / %6u\n", cnt, "-", tmLoad, tmList);
+    }
+  }
+
+  // 選択メニューを開く時間（保存済みのOTP）　1回目は索引とメニューを作成、2回目以降は作成済みを使う
+  vaultInvalidate();
+  uint32_t tm = micros();
+  MenuDef* menu = getOtpMenu("bench", 0);
+  uint32_t tmFirst = micros() - tm;
+  tm = micros();
+  menu = getOtpMenu("bench", 0);
+  uint32_t tmCached = micros() - tm;
+  debug = debugOrig;
+  spf("[OTP menu] %d accounts : first %u us, cached %u us\n", menu->lists.size()-1, tmFirst, tmCached);
+}
+
+//--------------------------------------------------------------
+// OTPの秘密鍵の復号化の速度　従来方式(毎回鍵展開＋16byteずつ)、decrypt()、暗号化セッション(CBC/GCM)の比較
+//   セッションは実物を上書きしないよう、同じ処理をローカルのコンテキストで行う
+//--------------------------------------------------------------
+void benchmarkCrypto() {
+  const int records = 500;
+  const size_t seclen = sizeof(TotpParams::secret);
+  byte key[32], iv[16];
+  for (int i=0; i<sizeof(key); i++) key[i] = esp_random() & 0xFF;
+  for (int i=0; i<sizeof(iv); i++) iv[i] = esp_random() & 0xFF;
+  std::vector<TotpParams> encs(records);
+  byte plain[seclen], dec[seclen], ref[seclen];
+  for (int i=0; i<records; i++) {
+    memset(plain, 0, seclen);
+    snprintf(reinterpret_cast<char*>(plain), seclen, "%s%03d", BENCH_SECRET_B32, i);
+    encrypt(plain, seclen, iv, key, reinterpret_cast<byte*>(encs[i].secret));
+  }
+  bool same = true;
+
+  // 従来方式　レコードごとに鍵を展開し、16byteずつ処理する
+  uint32_t tm = micros();
+  for (int i=0; i<records; i++) {
+    byte ivCopy[16];
+    memcpy(ivCopy, iv, sizeof(ivCopy));
+    mbedtls_aes_context aes;
+    mbedtls_aes_init(&aes);
+    mbedtls_aes_setkey_dec(&aes, key, 256);
+    for (int j=0; j<seclen; j+=16) {
+      byte block[16];
+      mbedtls_aes_crypt_cbc(&aes, MBEDTLS_AES_DECRYPT, 16, ivCopy, reinterpret_cast<byte*>(encs[i].secret)+j, block);
+      memcpy(ref+j, block, 16);
+    }
+    mbedtls_aes_free(&aes);
+  }
+  uint32_t tmLegacy = micros() - tm;
+
+  // decrypt()　レコードごとに鍵を展開し、まとめて処理する
+  tm = micros();
+  for (int i=0; i<records; i++) decrypt(dec, reinterpret_cast<byte*>(encs[i].secret), seclen, iv, key);
+  uint32_t tmDecrypt = micros() - tm;
+  same &= (memcmp(dec, ref, seclen) == 0);
+
+  // 暗号化セッション　鍵の展開は1回だけ
+  tm = micros();
+  mbedtls_aes_context aes;
+  mbedtls_aes_init(&aes);
+  mbedtls_aes_setkey_dec(&aes, key, 256);
+  for (int i=0; i<records; i++) aesCryptCbc(&aes, MBEDTLS_AES_DECRYPT, iv, reinterpret_cast<byte*>(encs[i].secret), seclen, dec);
+  mbedtls_aes_free(&aes);
+  uint32_t tmSession = micros() - tm;
+  same &= (memcmp(dec, ref, seclen) == 0);
+
+  // 認証付き(version 2)　レコードごとのnonceと認証タグ、AADを検証して復号化する
+  mbedtls_gcm_context gcm;
+  mbedtls_gcm_init(&gcm);
+  mbedtls_gcm_setkey(&gcm, MBEDTLS_CIPHER_ID_AES, key, 256);
+  std::vector<TotpParams> gcms(records);
+  byte aad[OTP_RECORD_AAD_SIZE];
+  for (int i=0; i<records; i++) {
+    gcms[i].version = OTP_RECORD_GCM;
+    esp_fill_random(gcms[i].nonce, sizeof(TotpParams::nonce));
+    otpRecordAad(&gcms[i], aad);
+    mbedtls_gcm_crypt_and_tag(&gcm, MBEDTLS_GCM_ENCRYPT, seclen, gcms[i].nonce, GCM_NONCE_SIZE, aad, sizeof(aad),
+      ref, reinterpret_cast<byte*>(gcms[i].secret), GCM_TAG_SIZE, gcms[i].tag);
+  }
+  int verified = 0;
+  tm = micros();
+  for (int i=0; i<records; i++) {
+    otpRecordAad(&gcms[i], aad);
+    if (mbedtls_gcm_auth_decrypt(&gcm, seclen, gcms[i].nonce, GCM_NONCE_SIZE, aad, sizeof(aad), gcms[i].tag, GCM_TAG_SIZE,
+          reinterpret_cast<byte*>(gcms[i].secret), dec) == 0) verified ++;
+  }
+  uint32_t tmGcm = micros() - tm;
+  same &= (verified == records) && (memcmp(dec, ref, seclen) == 0);
+  gcms[0].period ^= 1;  // 改ざんしたレコードは検証に失敗すること
+  otpRecordAad(&gcms[0], aad);
+  same &= (mbedtls_gcm_auth_decrypt(&gcm, seclen, gcms[0].nonce, GCM_NONCE_SIZE, aad, sizeof(aad), gcms[0].tag, GCM_TAG_SIZE,
+             reinterpret_cast<byte*>(gcms[0].secret), dec) != 0);
+  mbedtls_gcm_free(&gcm);
+  memset(key, 0, sizeof(key));
+  memset(dec, 0, sizeof(dec));
+
+  spf("[AES] %d records x %d bytes, results %s\n", records, (int)seclen, (same ? "PASS" : "FAIL"));
+  spf("  legacy  : %7u us, %8.0f records/s\n", tmLegacy, records * 1e6f / tmLegacy);
+  spf("  decrypt : %7u us, %8.0f records/s\n", tmDecrypt, records * 1e6f / tmDecrypt);
+  spf("  session : %7u us, %8.0f records/s\n", tmSession, records * 1e6f / tmSession);
+  spf("  GCM     : %7u us, %8.0f records/s (verify + decrypt)\n", tmGcm, records * 1e6f / tmGcm);
+}
+
+//--------------------------------------------------------------
+// 画像データの大きさと描画時間　RGB565の配列と、パレット＋ランレングス圧縮の比較
+//   RGB565の配列は圧縮データを展開してRAMに置いたもの（フラッシュから読むより速いので、比較としては圧縮側に不利）
+//--------------------------------------------------------------
+void benchmarkImage() {
+  const int loops = 100;
+  const uint8_t nos[] = { ICON_qr_on, ICON_battery, IMAGE_nfc1, IMAGE_nfc0 };
+  const char* names[] = { "qr_on", "battery", "nfc1", "nfc0" };
+  M5Canvas canvas;
+  canvas.setColorDepth(16);
+  if (canvas.createSprite(ui.mwh.w, ui.mwh.h) == nullptr) {
+    sp("[IMG] createSprite failed");
+    return;
+  }
+
+  // 全画像の大きさ（圧縮データは展開して終端の位置を、パレットは使っている番号の最大値から求める）
+  uint32_t rawTotal = 0, rleTotal = 0;
+  uint16_t line[UI_IMAGE_MAX_WIDTH];
+  for (int no=0; ui.imageInfo(no) != nullptr; no++) {
+    const DinMeterUI::ImageInfo* img = ui.imageInfo(no);
+    rawTotal += img->width * img->height * 2;
+    if (img->rle == nullptr) {
+      rleTotal += img->width * img->height * 2;
+      continue;
+    }
+    const uint8_t* src = img->rle;
+    for (int y=0; y<img->height; y++) src = DinMeterUI::decodeImageRow(src, img->palette, line, img->width, false);
+    int colors = 0;
+    for (const uint8_t* p=img->rle; p<src; ) {
+      uint8_t hdr = *p++;
+      int cnt = (hdr & 0x80) ? 1 : (hdr & 0x7F) + 1;
+      for (int i=0; i<cnt; i++, p++) if (*p + 1 > colors) colors = *p + 1;
+    }
+    rleTotal += (src - img->rle) + colors * 2;
+  }
+
+  // 描画時間（同じ内容になることも確認する）
+  bool pass = true;
+  sp("[IMG] draw to sprite, us/image");
+  spf("  all images: raw %u bytes, rle+palette %u bytes (%.1f%%)\n", rawTotal, rleTotal, rleTotal * 100.0f / rawTotal);
+  for (size_t i=0; i<sizeof(nos); i++) {
+    const DinMeterUI::ImageInfo* img = ui.imageInfo(nos[i]);
+    int w = img->width, h = img->height;
+    std::vector<uint16_t> raw(w * h);
+    const uint8_t* src = img->rle;
+    for (int y=0; y<h; y++) src = DinMeterUI::decodeImageRow(src, img->palette, &raw[y * w], w, false);
+
+    canvas.fillSprite(TFT_BLACK);
+    uint32_t tm = micros();
+    for (int n=0; n<loops; n++) canvas.pushImage(0,0, w,h, raw.data());
+    uint32_t tmRaw = micros() - tm;
+    std::vector<uint16_t> ref((uint16_t*)canvas.getBuffer(), (uint16_t*)canvas.getBuffer() + ui.mwh.w * h);
+
+    canvas.fillSprite(TFT_BLACK);
+    tm = micros();
+    for (int n=0; n<loops; n++) ui.drawImage(&canvas, 0,0, nos[i]);
+    uint32_t tmRle = micros() - tm;
+    bool same = (memcmp(ref.data(), canvas.getBuffer(), ref.size() * 2) == 0);
+    pass &= same;
+
+    spf("  %-8s %3dx%-3d %s raw %5d bytes %6.1f us, rle %5d bytes %6.1f us\n", names[i], w, h, (same ? "PASS" : "FAIL"),
+      w * h * 2, (float)tmRaw / loops, (int)(src - img->rle), (float)tmRle / loops);
+  }
+  canvas.deleteSprite();
+  spf("  results %s\n", (pass ? "PASS" : "FAIL"));
+}
@@ -8,23 +8,52 @@
 */
 #pragma once
 #include "NfcEasyWriter.h"
+#include <vector>
 
 // 各種定数
 const String FN_SECRETENC = "/secret_enc.bin";  // 暗号化した秘密鍵
 const String FN_SSL_KEY = "/ssl_private.der";   // Webサーバーの秘密鍵
 const String FN_SSL_CERT = "/ssl_cert.crt";     // Webサーバーの証明書
+const String FN_OTPVAULT = "/otp_vault.bin";    // OTPの保存ファイル
+const String FN_OTPVAULT_TMP = "/otp_vault.tmp"; // OTPの保存ファイル（詰め直し用の一時ファイル）
+const String FN_PROVISION_LOG = "/nfc_provision.log"; // NFCカードの一括作成の記録
 #define BEEP_SHORT   1
 #define BEEP_LONG    2
 #define BEEP_DOUBLE  3
 #define BEEP_ERROR   4
+#define I2C_CLOCK_QRCODE  100000U  // M5Unit-QRと通信するときのI2Cクロック（Standard-mode）
+#define I2C_CLOCK_RFID    400000U  // M5Unit-RFID2と通信するときのI2Cクロック（Fast-mode）
 #define SECRET_NFC_PARTITION_ADDR  0  // NFCに格納する先頭アドレス(仮想アドレスで指定)
 #define SECRET_SAVE_SIZE  40    // 秘密鍵ファイルのサイズ（秘密鍵32+マジックナンバー4+RFUI 4）
+#define SECRET_NFC_SLOT_SIZE  48  // NFCの1スロットのサイズ（ヘッダ8+秘密鍵ファイル40、Classicの1セクタ分）
+#define SECRET_NFC_AREA_SIZE  (SECRET_NFC_SLOT_SIZE * 2)  // NFCに使用する領域のサイズ（A/Bの2スロット）
+#define SECRET_NFC_NDEF_ADDR  32  // [Ultralight] NDEFコンテナのデータ領域の先頭アドレス（NDEFヘッダの次の16バイト境界）
+#define SECRET_NFC_NDEF_END   (SECRET_NFC_NDEF_ADDR + SECRET_NFC_AREA_SIZE + 4)  // [Ultralight] Terminator TLVまでの大きさ
+const char NdefSecretType[] = "akibabara.com:m5auth";  // NDEFコンテナの外部タイプ
+const byte NdefSecretInfo[4] = { 1, SECRET_NFC_SLOT_SIZE, 2, 0 };  // NDEFコンテナのpayload（バージョン, スロットサイズ, スロット数, RFU）
 const byte SecretMagic[4] = { 0x9E, 0x36, 0xAE, 1 }; // 秘密鍵ファイルのマジックナンバー[3] + バージョン
+#define SHARD_MAX  8  // 秘密鍵を分割保存するときの最大枚数
+const byte VaultMagic[4] = { 0x9E, 0x36, 0xAF, 1 };  // OTPの保存ファイルのマジックナンバー[3] + バージョン
 
 // メニューの項目
 enum Itype : uint8_t {
   none, back, setting, goRestart, goPowerdown, subtitle
 };
+struct ItemDef {  // メニューアイテムの構造体
+  uint8_t type;
+  uint8_t icon;
+  String name;
+  bool (*function)();
+  String description;
+};
+struct MenuDef {  // メニューの構造体
+  String title;
+  int select;
+  int selected;
+  int idx;
+  int cur;
+  std::vector<ItemDef> lists;
+};
 // 秘密鍵の保存先
 enum SecretStore : uint8_t {
   CONF_SECRET_NONE,
@@ -44,7 +73,8 @@ struct ConfigInfo {
   bool        keyJis;      // JIS配列変換モード
   bool        develop;     // 開発者モード
   uint16_t    autoKeyOff;  // OTP送信後の自動スリープ(秒)
-  byte        rfui[32];    // 予約
+  uint16_t    unlockTimeout; // NFCから読み込んだ秘密鍵を無操作で消去するまでの秒数（0=電源オフまで）
+  byte        rfui[30];    // 予約
 };
 
 // 状態表示用の情報
@@ -56,6 +86,7 @@ struct StatusInfo {
   bool     unitQRready = false;   // UNIT-QRCODEの接続状態
   bool     unitRFIDready = false; // UNIT-RFID 2の接続状態
   byte     iv[16] = {0};          // AES暗号化の初期ベクトル 128bit
+  byte     bsecret[32] = {0};     // 秘密鍵暗号化用の秘密鍵 256bit（起動時に1回だけ生成）
   byte     secret[32] = {0};      // 秘密鍵 256bit
 };
 
@@ -70,10 +101,31 @@ struct Tms {
 struct SecretDef {
   byte magic[4] = {0};
   byte secretEnc[32] = {0};
-  byte rfui[4] = {0};    // 予約
+  byte rfui[4] = {0};    // 分割保存の情報（SecretRfui、分割していない秘密鍵は全て0）
+};
+
+// SecretDef::rfuiの使い方（分割保存の場合）
+enum SecretRfui : uint8_t {
+  SRFUI_SHARD_X = 0,  // 分割片の番号 1～n（0=分割していない）
+  SRFUI_SHARD_K,      // 復元に必要な枚数
+  SRFUI_SHARD_N,      // 分割した枚数
+  SRFUI_SHARD_ID,     // 分割の識別子
+};
+
+// 集めた分割片（分割保存の秘密鍵の復元用）
+struct KeyShardSet {
+  uint8_t count = 0;            // 集めた数
+  uint8_t k = 0;                // 復元に必要な枚数
+  uint8_t id = 0;               // 分割の識別子
+  uint8_t x[SHARD_MAX] = {0};   // 分割片の番号
+  byte    y[SHARD_MAX][32];     // 分割片
 };
 
 // TOTP URIのパース結果、FatFS保存形式
+#define OTP_RECORD_CBC  1   // version 1: secretをAES-CBC（共通のIV）で暗号化、改ざん検出なし
+#define OTP_RECORD_GCM  2   // version 2: secretをAES-GCM（レコードごとのnonce）で暗号化、他の項目も含めて認証
+#define GCM_NONCE_SIZE  12
+#define GCM_TAG_SIZE    16
 struct TotpParams {
   uint8_t version = 1;
   char    issuer[32] = {0};
@@ -82,11 +134,24 @@ struct TotpParams {
   uint8_t algorithm = 1;
   uint8_t digit = 6;
   uint8_t period = 30;
-  byte    rfui[28] = {0};    // 予約
+  byte    nonce[GCM_NONCE_SIZE] = {0};  // version 2: レコードごとのnonce
+  byte    tag[GCM_TAG_SIZE] = {0};      // version 2: 認証タグ
+};
+// Google Authenticatorのエクスポート（otpauth-migration://）のバッチ情報
+#define QR_DECODE_MAX  2953   // M5Unit-QRで読み取れる最大の長さ（QRコード バージョン40-Lのバイトモード）
+#define MIGRATION_BATCH_MAX  32   // 1回のエクスポートの最大QRコード枚数
+struct MigrationBatch {
+  int32_t  batchId = 0;     // エクスポートごとのID（複数枚の組み合わせの確認用）
+  uint8_t  batchSize = 1;   // QRコードの枚数
+  uint8_t  batchIndex = 0;  // 何枚目か（0から）
+  uint16_t skipped = 0;     // 非対応で読み飛ばしたアカウント数
 };
-struct TotpParamsList {
-  String filename;
-  TotpParams tp;
+// OTPの索引（保存ファイル内の位置と表示用の名前）
+struct OtpIndex {
+  uint16_t slot;
+  uint8_t  period;
+  char     issuer[32];
+  char     account[32];
 };
 
 //==============================================================
@@ -104,6 +169,7 @@ bool funcPoweroff();        // 電源オフ
 
 // 機能メニュー
 bool funcAddOtp();      // OTPを追加する
+bool importMigrationSequence(String title, uint8_t* buff, size_t buffSize, size_t len, bool needNfc); // OTPを一括で追加する
 bool funcDelOtp();      // OTPを削除する
 bool funcExportOtp();   // OTPのエクスポート
 bool functRtc();        // NTPで日時を同期してRTCに設定する
@@ -112,6 +178,8 @@ bool funcFormatFatfs(); // フォーマット FatFS
 bool funcFormatNfc();   // フォーマット NFC
 bool funcKeyMove();     // 秘密鍵を移動する
 bool funcKeyDuplicate();// 秘密鍵を複製する(NFC)
+bool funcKeySplit();    // 秘密鍵を分割して複数のNFCに保存する(k-of-n)
+bool funcKeyProvision();// 予備のNFCカードを連続で作成する
 bool funcHexDump();     // ストレージのHEXダンプ
 
 // 設定メニュー
@@ -120,12 +188,14 @@ bool funcAutoEnter();   // 最後にEnterを自動送信するかどうか
 bool funcAuthMode();    // 認証方式を設定する
 bool funcAutoSleepAc(); // オートスリープ時間 無操作時
 bool funcAutoSleepPw(); // オートスリープ時間 PW送信後
+bool funcUnlockTimeout(); // 秘密鍵の自動消去時間 無操作時
 bool funcDevelop();     // 開発者モードの有効化
 bool funcSetQuiet();    // 静音モードの設定
 bool funcSetJiskey();   // JIS配列モードの設定
 
 // その他
 bool funcDevelopSendAscii();    // BLEで全ASCIIコードを送信する（キー刻印との不一致確認用） 
+bool funcDevelopBenchmark();    // 処理速度を計測してシリアルに出力する
 bool funcRegenerateOreoreSSL(); // SSL証明書を削除して再生成する 
 
 
@@ -134,22 +204,34 @@ bool funcRegenerateOreoreSSL(); // SSL証明書を削除して再生成する
 //==============================================================
 
 // URIの処理
-String urlDecode(String str);   // URLデコード
-bool parseUriOTP(TotpParams* tp, String uri);   // OTPのURIをパースする
+size_t urlDecodeInPlace(char* buf, size_t len, bool plusAsSpace=true);   // URLデコード（バッファ上で直接デコード）
+bool parseUriOTP(TotpParams* tp, char* uri, size_t len);   // OTPのURIをパースする（uriは書き換えられる）
+size_t base32Encode(const uint8_t* data, size_t len, char* out, size_t outSize);   // Base32エンコード
+bool parseMigrationUri(char* uri, size_t len, std::vector<TotpParams>* tps, MigrationBatch* batch);   // Google Authenticatorのエクスポートをパースする
 
 // OTP生成
-String getTotp(TotpParams* tp, time_t epoch);   // 指定時刻のワンタイムパスワードを取得する
+bool getTotp(TotpParams* tp, time_t epoch, char* code, size_t codeSize);   // 指定時刻のワンタイムパスワードを取得する
 
 // ファイル操作関連
-String makeOtpFilename(TotpParams* tp);    // OTPの保存ファイル名を作成する
-bool saveOtpFile(String filename, TotpParams* tp);    // FatFSにOTPを保存する
-bool loadOtpFile(String filename, TotpParams* tp, bool decryptSecret); // FatFSからOTPを読み込む
-std::vector<String> listOtpFiles();   // FatFSのOTPファイル名一覧を取得する
-int listAllOtpFiles(std::vector<TotpParamsList> *tps, bool decryptSecret);  // FatFSのOTP情報を全て取得する
+std::vector<String> listOtpFiles();   // FatFSの旧形式のOTPファイル名一覧を取得する
+
+//==============================================================
+// otpvault.h OTPの保存ファイル
+//==============================================================
+
+bool vaultBegin();    // 保存ファイルを開く（索引は最初に使うときに読み込む）
+void vaultInvalidate();   // 索引とメニューを破棄する（保存ファイルが外部で変更された場合）
+const std::vector<OtpIndex>& getOtpIndex();   // OTPの一覧を取得する（メモリ上の索引を返す）
+MenuDef* getOtpMenu(String title, int select);   // OTPの選択メニューを取得する
+bool loadOtpRecord(uint16_t slot, TotpParams* tp, bool decryptSecret);  // OTPを読み込む
+int saveOtpRecord(TotpParams* tp);   // OTPを1件保存する
+bool saveOtpRecords(std::vector<TotpParams>* tps, int* added, int* duplicated);  // 複数のOTPをまとめて保存する
+bool deleteOtpRecord(uint16_t slot);   // OTPを削除する
 
 
 //==============================================================
 // utility.h ユーティリティ系
+// （ファイル操作と暗号化の実体は coreutil.h、NFCへの秘密鍵ファイルの保存と読み込みは nfcstore.h）
 //==============================================================
 
 // ユーザーインターフェース関連1
@@ -162,6 +244,7 @@ void progressbar(int per, int pbx=-1, int pby=-1, int pbw=-1, int pbh=-1);  // 
 // ユーザーインターフェース関連2
 bool nfcMountSequence(String title, uint32_t waitms=0); // ダイアログ付き NFCマウント
 void nfcUnmountSequence(String title, bool dialog);     // ダイアログ付き NFCアンマウント
+size_t qrScanSequence(String title, String message, uint8_t* buff, size_t size); // ダイアログ付き QRコードスキャン
 
 // Wi-Fi関連
 bool wifiConnect();     // Wi-Fi接続
@@ -169,14 +252,18 @@ void wifiDisconnect();  // Wi-Fi切断
 
 // 外部接続デバイス関連
 void qrcodeUnitInitI2C(uint32_t timeout=0);   // Unit-QR(I2C接続)を初期化する
+void qrcodeBusUse();    // I2CバスのクロックをUnit-QRに合わせる
 void qrBufferClear();   // M5Unit-QR読み取り前にゴミデータが入ってたらクリアする
 
 // ファイルシステム関連(NFC含む)
 bool nfcChangeProtect(bool protect, bool formatAll=false);  // NFCのプロテクトを変更する
 bool saveFile(void *data, size_t dataSize, String filename);  // バイナリファイルを保存する(FatFS)
+bool appendTextFile(String text, String filename);  // テキストファイルに1行追記する(FatFS)
 bool saveNfc(void *data, size_t dataSize, uint16_t vaddr, ProtectMode mode=PRT_AUTO);  // バイナリファイルを保存する(NFC)
 size_t loadFile(void *data, size_t dataSize, String filename);  // バイナリファイルを読み込む(FatFS)
 size_t loadNfc(void *buffer, size_t bufferSize, uint16_t vaddr, ProtectMode mode=PRT_AUTO);  // バイナリファイルを読み込む(NFC)
+bool saveNfcSlot(void *data, size_t dataSize, uint16_t vaddr, ProtectMode mode=PRT_AUTO);  // A/Bスロットに保存して確認する(NFC)
+size_t loadNfcSlot(void *buffer, size_t bufferSize, uint16_t vaddr, ProtectMode mode=PRT_AUTO);  // A/Bスロットの新しい方を読み込む(NFC)
 bool deleteFile(String filename);   // バイナリファイルを削除する(FatFS)
 int getFileSize(String filename);   // ファイルサイズを取得する(FatFS)（存在しなければ-1）
 
@@ -184,13 +271,33 @@ int getFileSize(String filename);   // ファイルサイズを取得する(FatF
 bool sha256(String input, byte* output, size_t outputSize);   // SHA256でハッシュ化する  output:32byte=256bit
 bool getIV(uint8_t* iv, size_t ivSize, String addText);   // IVを取得(生成)する  output:16byte=128bit
 bool getBSecret(uint8_t* bsecret, size_t bsecretSize, String addText);  // 秘密鍵暗号化用の秘密鍵を生成する  32byte=256bit
+bool deviceKeysBegin();   // 端末固有の鍵(IV, 秘密鍵暗号化用の秘密鍵)を生成してメモリ上に保存する（起動時に1回）
 size_t encrypt(byte* data, size_t dataSize, const byte* iv, const byte* key, byte* encryptedData);  // AES 256bitで暗号化
 size_t decrypt(byte* decryptedData, const byte* encryptedData, size_t encryptedSize, const byte* iv, const byte* key);  // AES 256bitで複合化
+bool cryptoSessionBegin(const byte* key);  // 暗号化セッションを開始する（鍵スケジュールを展開）
+void cryptoSessionEnd();  // 暗号化セッションを終了する（鍵スケジュールを消去）
+size_t sessionEncrypt(const byte* data, size_t dataSize, const byte* iv, byte* encryptedData);  // 暗号化セッションで暗号化
+size_t sessionDecrypt(byte* decryptedData, const byte* encryptedData, size_t encryptedSize, const byte* iv);  // 暗号化セッションで複合化
+bool sessionSeal(const byte* nonce, const byte* aad, size_t aadSize, const byte* data, size_t dataSize, byte* encryptedData, byte* tag);  // 暗号化セッションで認証付き暗号化（GCM）
+bool sessionOpen(const byte* nonce, const byte* aad, size_t aadSize, const byte* encryptedData, size_t encryptedSize, const byte* tag, byte* decryptedData);  // 暗号化セッションで検証＋複合化（GCM）
 
 // 秘密鍵の操作関連
+bool readSecretDef(SecretStore device, SecretDef* sdef);  // 秘密鍵ファイルを読み込む（ストレージ→バッファ）
+size_t decryptSecretDef(const SecretDef* sdef, byte* output);  // 秘密鍵ファイルの中身を複合化する
+bool loadSecretDef(const SecretDef* sdef);  // 秘密鍵ファイルの中身を複合化してメモリに格納する
 bool loadSecret(SecretStore device);    // 読み込み（ストレージ→メモリ）
+bool makeSecretDef(SecretDef* sdef);    // メモリ上の秘密鍵を暗号化して秘密鍵ファイルの中身を作る
+size_t loadSecretNfc(SecretDef* sdef);  // 秘密鍵ファイルをマウント中のNFCカードから読み込む
+bool protectSlotsNfcCL(uint16_t vaddr, uint16_t size);  // [Classic] A/Bスロットの範囲のプロテクトが足りなければかけ直す
+bool migrateSecretNfcUL(SecretDef* sdef);  // [Ultralight] 秘密鍵ファイルを保存してNDEFコンテナに移行する（旧形式を壊さない順に書く）
+bool saveSecretNfc(SecretDef* sdef);    // 秘密鍵ファイルをマウント中のNFCカードに保存する（ULはNDEFコンテナに入れる）
 bool saveSecret(SecretStore device);    // 書き込み（メモリ→ストレージ）
 bool deleteSecret(SecretStore device, ProtectMode mode=PRT_AUTO);  // 削除（メモリ or ストレージ）
+bool unlockSecret(SecretStore device);  // 解錠する（読み込んで解錠セッションを開始する）
+void lockSecret();          // 施錠する（メモリ上の秘密鍵と鍵スケジュールを消去する）
+void unlockSessionTouch();  // 解錠セッション 操作があったことを記録する
+void unlockSessionCheck();  // 解錠セッション 無操作でタイムアウトしたら施錠する
+bool unlockSequence(String title);  // ダイアログ付き 解錠（NFCから秘密鍵を読み込む）
 
 // システム関連
 void restart();   // ESP32をリセット
@@ -229,3 +336,28 @@ String urlEncode(String inputText);   // URLエンコード
 // void handleUpload(HTTPRequest * req, HTTPResponse * res);   // アップロード
 // void handleDelete(HTTPRequest * req, HTTPResponse * res);   // 削除
 
+
+//==============================================================
+// keyshard.h 秘密鍵の分割保存（k-of-n）
+//==============================================================
+
+uint8_t gf256Mul(uint8_t a, uint8_t b);   // GF(2^8)の掛け算
+uint8_t gf256Inv(uint8_t a);   // GF(2^8)の逆数
+bool shardSplit(const byte* secret, uint8_t k, uint8_t n, byte (*shares)[32]);  // 秘密鍵をn個の分割片にする
+bool shardCombine(const uint8_t* xs, const byte (*ys)[32], uint8_t k, byte* secret);  // k個の分割片から秘密鍵を復元する
+void shardClear(KeyShardSet* set);   // 集めた分割片を消去する
+int shardCollect(KeyShardSet* set);  // マウント中のNFCから読み込んで解錠する（分割片なら集める）　残り枚数を返す
+bool saveSecretShard(const byte* share, uint8_t x, uint8_t k, uint8_t n, uint8_t id);  // 分割片をNFCに保存する
+
+
+//==============================================================
+// benchmark.h 開発者向けベンチマーク
+//==============================================================
+
+void runBenchmarks();   // 全てのベンチマークを実行する
+void benchmarkTotp();   // TOTP生成の速度
+void benchmarkUriParse();   // URIパースの速度とヒープ確保
+void benchmarkMigration();  // エクスポートのデコードの確認と速度
+void benchmarkVault();      // OTP一覧の取得時間
+void benchmarkCrypto();     // OTPの秘密鍵の復号化の速度
+void benchmarkImage();      // 画像データの大きさと描画時間（RGB565と圧縮の比較）
@@ -0,0 +1,247 @@
+/*
+  coreutil.h
+  ハードウェアに依存しないユーティリティ（FatFSのファイル操作、暗号化）
+
+  M5やNFC、画面を使わないので、PCでもシム(test/shims)を使ってビルドできる
+  utility.hから分けたもので、プロトタイプはcommon.hのutility.hの欄にある
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#pragma once
+#include "common.h"
+
+#include <FFat.h>
+#include "mbedtls/md.h"
+#include "mbedtls/aes.h"
+#include "mbedtls/gcm.h"
+
+//--------------------------------------------------------------
+// PASS/FAIL
+//--------------------------------------------------------------
+String tf(bool res) {
+  return res ? "PASS" : "FAIL";
+}
+
+//--------------------------------------------------------------
+// バイナリファイルを保存する(FatFS)
+//--------------------------------------------------------------
+bool saveFile(void *data, size_t dataSize, String filename) {
+  // 書き込み
+  File file = FFat.open(filename, FILE_WRITE);
+  if (!file) {
+    if (debug) sp("saveFile open failed "+filename);
+    return false;
+  }
+  size_t wlen = file.write(reinterpret_cast<const uint8_t *>(data), dataSize);
+  file.close();
+  // チェック
+  if (wlen != dataSize) {
+    if (debug) sp("saveFile write failed "+filename);
+    return false;
+  }
+  if (debug) spf("Write %u bytes to file: %s\n", (unsigned)wlen, filename.c_str());
+  return true;
+}
+
+//--------------------------------------------------------------
+// テキストファイルに1行追記する(FatFS)
+//--------------------------------------------------------------
+bool appendTextFile(String text, String filename) {
+  File file = FFat.open(filename, FILE_APPEND);
+  if (!file) {
+    if (debug) sp("appendTextFile open failed "+filename);
+    return false;
+  }
+  size_t wlen = file.println(text);
+  file.close();
+  return (wlen > 0);
+}
+
+//--------------------------------------------------------------
+// バイナリファイルを読み込む(FatFS)
+//--------------------------------------------------------------
+size_t loadFile(void *data, size_t dataSize, String filename) {
+  File file = FFat.open(filename, FILE_READ);
+  if (!file) {
+    if (debug) sp("loadFile open failed "+filename);
+    return 0;
+  }
+  size_t rlen = file.read(reinterpret_cast<uint8_t *>(data), dataSize);
+  file.close();
+  if (debug) spf("Read %u bytes from file: %s\n", (unsigned)rlen, filename.c_str());
+  return rlen;
+}
+
+//--------------------------------------------------------------
+// バイナリファイルを削除する(FatFS)
+//--------------------------------------------------------------
+bool deleteFile(String filename) {
+  bool res = FFat.remove(filename);
+  if (debug) spf("Delete %s file: %s\n", tf(res).c_str(), filename.c_str());
+  return res;
+}
+
+//--------------------------------------------------------------
+// ファイルサイズを取得する（存在しなければ-1）
+//--------------------------------------------------------------
+int getFileSize(String filename) {
+  int fileSize = -1;
+  File file = FFat.open(filename, FILE_READ);
+  if (file) {
+    fileSize = (int) file.size();
+  }
+  file.close();
+  return fileSize;
+}
+
+//--------------------------------------------------------------
+// SHA256でハッシュ化する  output:32byte=256bit
+//--------------------------------------------------------------
+bool sha256(String input, byte* output, size_t outputSize) {
+  if (input == nullptr || output == nullptr || outputSize < 32) return false;
+
+  mbedtls_md_context_t ctx;
+  mbedtls_md_init(&ctx);
+  const mbedtls_md_info_t* mdInfo = mbedtls_md_info_from_type(MBEDTLS_MD_SHA256);
+  if (mdInfo == nullptr) {
+    mbedtls_md_free(&ctx);
+    return false;
+  }
+  if (mbedtls_md_setup(&ctx, mdInfo, 0) != 0) {
+    mbedtls_md_free(&ctx);
+    return false;
+  }
+  mbedtls_md_starts(&ctx);
+  mbedtls_md_update(&ctx, (const unsigned char*)input.c_str(), input.length());
+  mbedtls_md_finish(&ctx, output);
+  mbedtls_md_free(&ctx);
+  return true;
+}
+
+//--------------------------------------------------------------
+// AES 256bit CBCでまとめて処理する
+//   バッファ全体を1回で渡す（ハードウェアAESならDMAで処理される）
+//   暗号化の場合、16byteに満たない端数は0埋めして1ブロックにする
+//--------------------------------------------------------------
+size_t aesCryptCbc(mbedtls_aes_context* aes, int mode, const byte* iv, const byte* input, size_t size, byte* output) {
+  byte ivCopy[16];
+  memcpy(ivCopy, iv, sizeof(ivCopy));
+  size_t full = size & ~(size_t)15;
+  if (mode == MBEDTLS_AES_DECRYPT && full != size) return 0;
+  if (full > 0 && mbedtls_aes_crypt_cbc(aes, mode, full, ivCopy, input, output) != 0) return 0;
+  if (full < size) {
+    byte block[16] = {0};
+    memcpy(block, input+full, size-full);
+    int ret = mbedtls_aes_crypt_cbc(aes, mode, 16, ivCopy, block, output+full);
+    memset(block, 0, sizeof(block));
+    if (ret != 0) return 0;
+    full += 16;
+  }
+  return full;
+}
+
+//--------------------------------------------------------------
+// AES 256bitで暗号化する
+//--------------------------------------------------------------
+size_t encrypt(byte* data, size_t dataSize, const byte* iv, const byte* key, byte* encryptedData) {
+  if (data == nullptr || iv == nullptr || key == nullptr || encryptedData == nullptr) return 0;
+  size_t encsize = 0;
+  mbedtls_aes_context aes;
+  mbedtls_aes_init(&aes);
+  if (mbedtls_aes_setkey_enc(&aes, key, 256) == 0) {
+    encsize = aesCryptCbc(&aes, MBEDTLS_AES_ENCRYPT, iv, data, dataSize, encryptedData);
+  }
+  mbedtls_aes_free(&aes);
+  return encsize;
+}
+
+//--------------------------------------------------------------
+// AES 256bitで復号化する
+//--------------------------------------------------------------
+size_t decrypt(byte* decryptedData, const byte* encryptedData, size_t encryptedSize, const byte* iv, const byte* key) {
+  if (decryptedData == nullptr || encryptedData == nullptr || iv == nullptr || key == nullptr)  return 0;
+  size_t decsize = 0;
+  mbedtls_aes_context aes;
+  mbedtls_aes_init(&aes);
+  if (mbedtls_aes_setkey_dec(&aes, key, 256) == 0) {
+    decsize = aesCryptCbc(&aes, MBEDTLS_AES_DECRYPT, iv, encryptedData, encryptedSize, decryptedData);
+  }
+  mbedtls_aes_free(&aes);
+  return decsize;
+}
+
+//--------------------------------------------------------------
+// 暗号化セッション
+//   アンロック時に秘密鍵(status.secret)の鍵スケジュールを一度だけ展開して保持し、
+//   ロック時(メモリ上の秘密鍵の削除時)に消去する。OTPの秘密鍵の暗号化/復号化はこれを使う
+//   AES-GCMの鍵はCBCと共用しないよう、秘密鍵からHMAC-SHA256で派生させる
+//--------------------------------------------------------------
+struct CryptoSession {
+  mbedtls_aes_context enc;    // 暗号化用の鍵スケジュール（CBC）
+  mbedtls_aes_context dec;    // 復号化用の鍵スケジュール（CBC）
+  mbedtls_gcm_context gcm;    // 認証付き暗号化用（GCM）
+  bool ready = false;
+};
+DRAM_ATTR CryptoSession cryptoSession;   // 鍵スケジュールは内部RAMに置く（PSRAMには置かない）
+const char GCM_KEY_LABEL[] = "M5Authenticator OTP record v2";   // GCMの鍵の派生用ラベル
+
+// 開始する（鍵スケジュールを展開する）
+bool cryptoSessionBegin(const byte* key) {
+  cryptoSessionEnd();
+  mbedtls_aes_init(&cryptoSession.enc);
+  mbedtls_aes_init(&cryptoSession.dec);
+  mbedtls_gcm_init(&cryptoSession.gcm);
+  byte gcmKey[32];
+  bool res = (mbedtls_aes_setkey_enc(&cryptoSession.enc, key, 256) == 0)
+          && (mbedtls_aes_setkey_dec(&cryptoSession.dec, key, 256) == 0)
+          && (mbedtls_md_hmac(mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), key, 32,
+                reinterpret_cast<const byte*>(GCM_KEY_LABEL), strlen(GCM_KEY_LABEL), gcmKey) == 0)
+          && (mbedtls_gcm_setkey(&cryptoSession.gcm, MBEDTLS_CIPHER_ID_AES, gcmKey, 256) == 0);
+  memset(gcmKey, 0, sizeof(gcmKey));
+  if (!res) {
+    mbedtls_aes_free(&cryptoSession.enc);
+    mbedtls_aes_free(&cryptoSession.dec);
+    mbedtls_gcm_free(&cryptoSession.gcm);
+    if (debug) sp("cryptoSessionBegin: setkey failed!");
+    return false;
+  }
+  cryptoSession.ready = true;
+  return true;
+}
+
+// 終了する（鍵スケジュールを消去する）
+void cryptoSessionEnd() {
+  if (!cryptoSession.ready) return;
+  mbedtls_aes_free(&cryptoSession.enc);   // mbedtls_*_free()はコンテキストを0で消去する
+  mbedtls_aes_free(&cryptoSession.dec);
+  mbedtls_gcm_free(&cryptoSession.gcm);
+  cryptoSession.ready = false;
+}
+
+// 暗号化する
+size_t sessionEncrypt(const byte* data, size_t dataSize, const byte* iv, byte* encryptedData) {
+  if (!cryptoSession.ready || data == nullptr || iv == nullptr || encryptedData == nullptr) return 0;
+  return aesCryptCbc(&cryptoSession.enc, MBEDTLS_AES_ENCRYPT, iv, data, dataSize, encryptedData);
+}
+
+// 復号化する
+size_t sessionDecrypt(byte* decryptedData, const byte* encryptedData, size_t encryptedSize, const byte* iv) {
+  if (!cryptoSession.ready || decryptedData == nullptr || encryptedData == nullptr || iv == nullptr) return 0;
+  return aesCryptCbc(&cryptoSession.dec, MBEDTLS_AES_DECRYPT, iv, encryptedData, encryptedSize, decryptedData);
+}
+
+// 認証付きで暗号化する（AES-GCM）　nonceは12byte、tagは16byte
+bool sessionSeal(const byte* nonce, const byte* aad, size_t aadSize, const byte* data, size_t dataSize, byte* encryptedData, byte* tag) {
+  if (!cryptoSession.ready || nonce == nullptr || data == nullptr || encryptedData == nullptr || tag == nullptr) return false;
+  return mbedtls_gcm_crypt_and_tag(&cryptoSession.gcm, MBEDTLS_GCM_ENCRYPT, dataSize, nonce, GCM_NONCE_SIZE,
+           aad, aadSize, data, encryptedData, GCM_TAG_SIZE, tag) == 0;
+}
+
+// 認証タグを検証して復号化する（AES-GCM）　改ざんされていればfalse
+bool sessionOpen(const byte* nonce, const byte* aad, size_t aadSize, const byte* encryptedData, size_t encryptedSize, const byte* tag, byte* decryptedData) {
+  if (!cryptoSession.ready || nonce == nullptr || encryptedData == nullptr || tag == nullptr || decryptedData == nullptr) return false;
+  return mbedtls_gcm_auth_decrypt(&cryptoSession.gcm, encryptedSize, nonce, GCM_NONCE_SIZE,
+           aad, aadSize, tag, GCM_TAG_SIZE, encryptedData, decryptedData) == 0;
+}
@@ -16,6 +16,7 @@
 #include <BleKeyboard.h>
 #include <FFat.h>
 #include <WiFi.h>
+#include "mbedtls/platform_util.h"
 
 // メインで定義した変数を使用するためのもの
 #include "DinMeterUI.h"
@@ -53,6 +54,7 @@ bool funcInitialSetup() {
   FFat.end();
   res = FFat.format();
   if (res) res = FFat.begin();
+  if (res) vaultBegin();  // 空の保存ファイルを作り直す
   if (debug) spp("Format FatFS", tf(res));
   // 結果表示
   if (res) {
@@ -100,7 +102,8 @@ bool funcInitialSetup() {
     if (res) {
       uint16_t freeSize = nfc.getVCapacities();   // 使用可能な容量
       if (debug) spp("NFC Card mounted. freesize", freeSize);
-      res = (freeSize >= SECRET_NFC_PARTITION_ADDR + SECRET_SAVE_SIZE);
+      uint16_t needSize = (nfc.isUltralight()) ? SECRET_NFC_NDEF_END : SECRET_NFC_PARTITION_ADDR + SECRET_NFC_AREA_SIZE;
+      res = (freeSize >= needSize);
       if (debug) spp("NFC Capacity", tf(res));
     }
     if (!res) {
@@ -170,8 +173,8 @@ bool funcOtpShow() {
   }
 
   // OTP一覧の取得  
-  std::vector<TotpParamsList> tps;
-  int cnt = listAllOtpFiles(&tps, false);
+  const std::vector<OtpIndex>& tps = getOtpIndex();
+  int cnt = tps.size();
   if (cnt < 1) {
     message = "エラー! 保存されているデータはありません";
   }
@@ -188,37 +191,21 @@ bool funcOtpShow() {
     return false;
   }
 
-  // メニュー変数の作成
-  MenuDef menu = {
-    .title = title,
-    .select = 1,
-    .selected = -1,
-    .idx = 0,
-    .cur = 1,
-  };
-  menu.lists.push_back({ 0, 0, "戻る", nullptr, "" });
-  for (int i=0; i<cnt; i++) {
-    String text = String(tps[i].tp.issuer) + " " + String(tps[i].tp.account);
-    menu.lists.push_back({ 0, 0, text, nullptr, "" });
-  }
+  // メニュー変数の作成（作成済みのメニューを使う）
+  MenuDef* menu = getOtpMenu(title, 1);
 
   // 一覧から選択
   int seltp = -1;
   String description = "サイトを選択してください";
-  int boxnum = (menu.lists.size() < 4) ? menu.lists.size() : 4;
-  selected = ui.selectMenuList(&menu, -1, boxnum, description, 20);  // リスト形式のメニューを選択する
+  int boxnum = (menu->lists.size() < 4) ? menu->lists.size() : 4;
+  selected = ui.selectMenuList(menu, -1, boxnum, description, 20);  // リスト形式のメニューを選択する
   if (selected > 0) {
     seltp = selected - 1;
   }
   if (seltp < 0) return false;
 
   // 秘密鍵が読み込まれてない場合は読み込む
-  if (needNfc) {
-    if (nfcMountSequence(title, 100)) {  // ダイアログ付き NFCマウント
-      if (loadSecret(conf.saveSecret)) status.unlock = true;
-    }
-    nfcUnmountSequence(title, false);  // ダイアログなし NFCアンマウント
-  }
+  if (needNfc) unlockSequence(title);  // ダイアログ付き 解錠
   if (!status.unlock) {
     message = "エラー! 秘密鍵が正常に読み込めませんでした";
     ui.selectNotice("OK", title, message, 72, false); // ダイアログ表示
@@ -227,16 +214,32 @@ bool funcOtpShow() {
 
   // OTPファイルを読み込む
   TotpParams tp;
-  res = loadOtpFile(tps[seltp].filename, &tp, true);
-  if (debug) spp("loadOtpFile",tf(res));
+  res = loadOtpRecord(tps[seltp].slot, &tp, true);
+  if (debug) spp("loadOtpRecord",tf(res));
+  if (!res) return false;
+
+  // TOTPの生成準備（秘密鍵のデコードとHMACの鍵スケジュールはここで一度だけ行う）
+  TotpGenerator totp;
+  res = totp.begin(tp.secret, tp.period, tp.digit, tp.algorithm);
+  memset(tp.secret, 0, sizeof(tp.secret));
+  if (debug) spp("TotpGenerator",tf(res));
   if (!res) return false;
 
-  // canvasの作成
-  M5Canvas canvas(ui._dst);
-  canvas.setColorDepth(16);
-  canvas.createSprite(ui.mwh.w-4, ui.mwh.h-32);
-  canvas.setTextColor(TFT_WHITE);
-  int cw = canvas.width();
+  // canvasの準備（メインパネルのバックバッファのボタンより上に描く）
+  M5Canvas& canvas = *ui.panelCanvas(UI_PANEL_MAIN);
+  const int ox = 2;   // 描画範囲の左端
+  const int cw = ui.mwh.w-4;
+  const int ch = ui.mwh.h-32;
+
+  // 表示する部品（変化した部品だけ描き直して、その矩形だけ出力する）
+  ui.widgetsBegin(UI_PANEL_MAIN);
+  const int wTitle = ui.widgetAdd(ox,0, cw,16, ui.PCOL_TITLE);   // 発行者とアカウント
+  const int wYmd   = ui.widgetAdd(ox,17, cw,16);   // 日時
+  const int wCode  = ui.widgetAdd(ox,33, cw,51);   // コード
+  const int wPrev  = ui.widgetAdd(ox,84, cw/2-20,16);   // 前のコード
+  const int wBar   = ui.widgetAdd(ox+cw/2-20,84, 41,16);   // プログレスバー
+  const int wNext  = ui.widgetAdd(ox+cw/2+21,84, cw-cw/2-21,16);   // 次のコード
+  ui.resetPushStats();
   
   // メニュー変数の作成2
   LABEL_OTP_SHOW:
@@ -251,9 +254,30 @@ bool funcOtpShow() {
     },
   };
 
+  // 表示するテキスト（描画ループ内ではヒープを確保しない）
+  char title2[sizeof(TotpParams::issuer)+sizeof(TotpParams::account)+1];
+  snprintf(title2, sizeof(title2), "%s %s", tps[seltp].issuer, tps[seltp].account);
+  char code[TOTP_CODE_BUFSIZE];
+  char prev[TOTP_CODE_BUFSIZE+2], next[TOTP_CODE_BUFSIZE+2];
+  code[0] = '\0';
+
+  // 桁数に合わせてフォントを決める（8桁以上は48pxフォントでは収まらない）
+  const lgfx::IFont* codeFont = &fonts::Font6;  // 48px
+  const lgfx::IFont* subFont = &fonts::Font2;   // 16px
+  bool subMark = true;
+  {
+    char sample[TOTP_CODE_BUFSIZE];
+    memset(sample, '8', tp.digit);
+    sample[tp.digit] = '\0';
+    if (canvas.textWidth(sample, codeFont) > cw) codeFont = &fonts::Font4;  // 26px
+    snprintf(next, sizeof(next), "> %s", sample);
+    int subw = cw / 2 - 22;  // プログレスバーの左右の幅
+    if (canvas.textWidth(next, subFont) > subw) subFont = &fonts::Font0;  // 8px
+    if (canvas.textWidth(next, subFont) > subw) subMark = false;
+  }
+
   // ワンタイムパスワード表示
   bool init = true;
-  String code;
   int lastselno = -1, cntDwn = 999999;
   int cntDwnDef = (conf.autoKeyOff == 0) ? 999998 : conf.autoKeyOff;
   bool btned = false;
@@ -263,45 +287,64 @@ bool funcOtpShow() {
     if (menu2.select != lastselno) {
       menu2.cur = menu2.select;
       ui.drawMainPanel_dialog(&menu2, menu2.select, "", 72);   // UI中央描画
+      ui.widgetsInvalidate();   // パネル全体を描き直したので、全部品を描き直す
       lastselno = menu2.select;
     }
     // ワンタイムパスワード生成
     bool sync = (init || tms.epoch % tp.period == 0);
     tms = getMultiDateTime(sync);  // 現在時刻の取得
-    code = getTotp(&tp, tms.epoch);
-    String code0 = getTotp(&tp, tms.epoch - tp.period);
-    String code2 = getTotp(&tp, tms.epoch + tp.period);
+    char codes[3][TOTP_CODE_BUFSIZE];
+    totp.getCodes(tms.epoch, -1, 3, codes);  // 前/現在/次のコードをまとめて生成
+    memcpy(code, codes[1], sizeof(code));
+    snprintf(prev, sizeof(prev), (subMark ? "%s <" : "%s"), codes[0]);
+    snprintf(next, sizeof(next), (subMark ? "> %s" : "%s"), codes[2]);
     int remain = tp.period - tms.epoch % tp.period;
     init = false;
-    // ワンタイムパスワード表示
-    canvas.fillSprite(TFT_BLACK);
-    canvas.fillRect(0,0, cw,16, ui.PCOL_TITLE);
-    canvas.setTextColor(TFT_BLACK);
-    canvas.drawString(String(tps[seltp].tp.issuer)+" "+String(tps[seltp].tp.account), 3,0, &fonts::Font2);  // 16px
-    canvas.setTextDatum(TC_DATUM);
-    canvas.setTextColor(TFT_WHITE);
-    canvas.drawString(tms.ymd, cw/2,17, &fonts::Font2);  // 16px
-    canvas.setTextColor((remain < 5) ? ui.rgb565(0xFF8080) : TFT_WHITE);
-    canvas.drawString(code, cw/2,39, &fonts::Font6);  // 48px
-    canvas.setTextColor(TFT_WHITE);
-    canvas.setTextDatum(TR_DATUM);
+    // ワンタイムパスワード表示（変化した部品だけ描き直す）
+    if (ui.widgetBegin(wTitle, ui.widgetHash(title2))) {
+      canvas.setTextColor(TFT_BLACK);
+      canvas.drawString(title2, ox+3,0, &fonts::Font2);  // 16px
+      ui.widgetEnd(wTitle);
+    }
+    if (ui.widgetBegin(wYmd, ui.widgetHash(tms.ymd.c_str()))) {
+      canvas.setTextDatum(TC_DATUM);
+      canvas.setTextColor(TFT_WHITE);
+      canvas.drawString(tms.ymd, ox+cw/2,17, &fonts::Font2);  // 16px
+      canvas.setTextDatum(TL_DATUM);
+      ui.widgetEnd(wYmd);
+    }
+    uint16_t codeColor = (remain < 5) ? ui.rgb565(0xFF8080) : TFT_WHITE;
+    if (ui.widgetBegin(wCode, ui.widgetHash(&codeColor, sizeof(codeColor), ui.widgetHash(code)))) {
+      canvas.setTextColor(codeColor);
+      canvas.setTextDatum((codeFont == &fonts::Font6) ? TC_DATUM : MC_DATUM);
+      canvas.drawString(code, ox+cw/2, (codeFont == &fonts::Font6) ? 39 : 62, codeFont);
+      canvas.setTextDatum(TL_DATUM);
+      ui.widgetEnd(wCode);
+    }
     int y = 84;
-    canvas.drawString("> "+code2, cw-3,y, &fonts::Font2);  // 16px
-    canvas.setTextDatum(TL_DATUM);
-    canvas.drawString(code0+" <", 2,y, &fonts::Font2);  // 16px
+    canvas.setTextColor(TFT_WHITE);
+    if (ui.widgetBegin(wNext, ui.widgetHash(next))) {
+      canvas.setTextDatum(TR_DATUM);
+      canvas.drawString(next, ox+cw-3,y, subFont);
+      canvas.setTextDatum(TL_DATUM);
+      ui.widgetEnd(wNext);
+    }
+    if (ui.widgetBegin(wPrev, ui.widgetHash(prev))) {
+      canvas.drawString(prev, ox+2,y, subFont);
+      ui.widgetEnd(wPrev);
+    }
     // プログレスバーの表示
-    int x = cw / 2 - 20;
+    int x = ox + cw / 2 - 20;
     int per = (remain * 100) / tp.period;
     int pw = map(per, 0,100, 0,40);
-    canvas.fillRect(x,y+2, 40-pw,12, TFT_RED);
-    canvas.fillRect(x+(40-pw),y+2, pw,12, TFT_GREEN);
-    canvas.drawRect(x,y+1, 41,14, ui.rgb565(0x666666));
-    // canvasの出力
-    ui.lockCanvas();
-    ui._dst->startWrite(); 
-    canvas.pushSprite(ui.mxy.x+2, ui.mxy.y);
-    ui._dst->endWrite();
-    ui.unlockCanvas();
+    if (ui.widgetBegin(wBar, pw)) {
+      canvas.fillRect(x,y+2, 40-pw,12, TFT_RED);
+      canvas.fillRect(x+(40-pw),y+2, pw,12, TFT_GREEN);
+      canvas.drawRect(x,y+1, 41,14, ui.rgb565(0x666666));
+      ui.widgetEnd(wBar);
+    }
+    // canvasの出力（描き直した部品の矩形だけ）
+    ui.widgetsPush();
     // ボタン押し待ち＆ロータリーエンコーダー選択（UI関数を使用せずに描画する）
     int encpos = DinMeter.Encoder.read();
     static int lastpos = encpos;
@@ -349,7 +392,7 @@ bool funcOtpShow() {
         bleKeyboard.print(code);    // BLEキー送信
         delay(100);
         if (conf.autoEnter) bleKeyboard.write(KEY_RETURN);
-        if (debug) sp("BLE Send Key: "+code);
+        if (debug) spf("BLE Send Key: %s\n", code);
       } else {
         if (debug) sp("Error! BLE not connected");
       }
@@ -357,6 +400,7 @@ bool funcOtpShow() {
       funcPoweroff(); // 電源オフ
     }
   } //while(1)
+  if (debug) ui.printPushStats(ui.mwh.w * ch * 2);  // 毎回ボタンより上を全部出力した場合と比べる
 
   return true;
 }
@@ -463,12 +507,15 @@ bool funcClock() {
   tickerUpdateUISkip = true;  // ステータスUIの自動更新を停止
   ui.selectNotice("", title, "", 24, true); // 枠のみ表示
 
-  // canvasの作成
-  M5Canvas canvas(ui._dst);
-  canvas.setColorDepth(16);
-  // canvas.createSprite(ui.m5wh.w, ui.m5wh.h);
-  canvas.createSprite(ui.mwh.w, ui.mwh.h-th);
-  canvas.setTextColor(TFT_WHITE);
+  // canvasの準備（メインパネルのバックバッファのタイトルより下に描く）
+  M5Canvas& canvas = *ui.panelCanvas(UI_PANEL_MAIN);
+
+  // 表示する部品（変化した部品だけ描き直して、その矩形だけ出力する）
+  ui.widgetsBegin(UI_PANEL_MAIN);
+  const int wDate = ui.widgetAdd(0,th, ui.mwh.w,28);   // 日付
+  const int wTime = ui.widgetAdd(0,th+28, 156,56);    // 時：分
+  const int wSec  = ui.widgetAdd(156,th+56, ui.mwh.w-156,24);  // 秒
+  ui.resetPushStats();
 
   // ループ
   while (!abort) {
@@ -477,22 +524,25 @@ bool funcClock() {
     // 日付
     tms = getMultiDateTime(sync);  // 現在時刻の取得
     if (sync) delay(100);   // おまじない
-    canvas.fillSprite(TFT_BLACK);
     sprintf(buff, "%04d / %02d / %02d", tms.tm->tm_year+1900, tms.tm->tm_mon+1, tms.tm->tm_mday);
-    canvas.drawString(buff, 43,5, &fonts::Font2);  // 日付 16px
-    canvas.setTextDatum(TR_DATUM);
+    if (ui.widgetBegin(wDate, ui.widgetHash(buff))) {
+      canvas.drawString(buff, 43,th+5, &fonts::Font2);  // 日付 16px
+      ui.widgetEnd(wDate);
+    }
     sprintf(buff, "%d : %02d", tms.tm->tm_hour, tms.tm->tm_min);
-    canvas.drawString(buff, 153,35, &fonts::Font6);  // 時刻 48px
-    canvas.setTextDatum(TL_DATUM);
+    if (ui.widgetBegin(wTime, ui.widgetHash(buff))) {
+      canvas.setTextDatum(TR_DATUM);
+      canvas.drawString(buff, 153,th+35, &fonts::Font6);  // 時刻 48px
+      canvas.setTextDatum(TL_DATUM);
+      ui.widgetEnd(wTime);
+    }
     sprintf(buff, ": %02d", tms.tm->tm_sec);
-    canvas.drawString(buff, 158,60, &fonts::Font2);  // 秒 16px
-    // canvasの出力
-    ui.lockCanvas();
-    ui._dst->startWrite(); 
-    // canvas.pushSprite(0,0);
-    canvas.pushSprite(ui.mxy.x, ui.mxy.y+th);
-    ui._dst->endWrite();
-    ui.unlockCanvas();
+    if (ui.widgetBegin(wSec, ui.widgetHash(buff))) {
+      canvas.drawString(buff, 158,th+60, &fonts::Font2);  // 秒 16px
+      ui.widgetEnd(wSec);
+    }
+    // canvasの出力（描き直した部品の矩形だけ）
+    ui.widgetsPush();
     // ボタン押し待ち
     while (millis() < tm) {
       M5.update();
@@ -504,6 +554,7 @@ bool funcClock() {
     }
     if (abort) break;
   }
+  if (debug) ui.printPushStats(ui.mwh.w * (ui.mwh.h-th) * 2);  // 毎回タイトルより下を全部出力した場合と比べる
   tickerUpdateUISkip = false;  // ステータスUIの自動更新を再開
   return true;
 }
@@ -512,6 +563,9 @@ bool funcClock() {
 // 【メイン】電源オフ
 // --------------------------------------------------------------------------------------
 bool funcPoweroff() {
+  // 秘密鍵をメモリから消去する
+  lockSecret();
+
   // BLE切断
   bleKeyboard.end();  // 実際は何も実装されてない
 
@@ -519,7 +573,9 @@ bool funcPoweroff() {
   if (debug) sp("byebye");
   DinMeter.Rtc.clearIRQ();
   DinMeter.Rtc.disableIRQ();
+  ui.lockCanvas();  // 描画タスクの出力が終わってから消す
   DinMeter.Display.fillScreen(TFT_BLACK);
+  ui.unlockCanvas();
   while (M5.BtnA.isPressed()) {
     M5.update();
     delay(100);
@@ -552,8 +608,9 @@ bool funcAddOtp() {
   const std::vector<String> yesno = { "NO", "YES" };
   String message, message2;
   int selected;
-  bool res, abort = false, success = false;
-  uint8_t buff[512] = {0};
+  bool res, success = false;
+  std::vector<uint8_t> qrbuff(QR_DECODE_MAX + 1, 0);   // エクスポートは数百文字を超えるので、読み取れる最大の長さを確保する
+  uint8_t* buff = qrbuff.data();
   size_t len;
 
   // M5Unit-QRが未初期化だったら初期化 I2Cモード
@@ -576,43 +633,21 @@ bool funcAddOtp() {
     return false;
   } 
 
-  // 画面枠とボタンの表示
+  // QRスキャン
   message = "QRコードをスキャンしてください";
-  ui.selectNotice("CANCEL", title, message, 64, !abort); // 枠のみ表示
+  len = qrScanSequence(title, message, buff, qrbuff.size());
+  if (len == 0) return false;
 
-  // スキャン開始
-  qrBufferClear();  // 読み取り前にゴミデータが入ってたら取り出す
-  if (debug) sp("Barcode scaning...");
-  qr.setDecodeTrigger(1);   // QRスキャン開始
-
-  // QRスキャン
-  while (!abort) {
-    M5.update();
-    if (m5BtnAwasReleased()) {  // ボタン押したら中断
-      qr.setDecodeTrigger(0);   // QRスキャン終了
-      abort = true;
-      break;
-    }
-    if (qr.getDecodeReadyStatus() == 1) {   // スキャン完了
-      // 読んだ値を取得
-      len = qr.getDecodeLength();
-      if (len > sizeof(buff)-1) len = sizeof(buff)-1;
-      qr.getDecodeData(buff, len);
-      if (debug) {
-        spp("scaned len", len);
-        spp("scaned data", (const char*)buff);
-      }
-      break;
-    }
-    delay(10);
+  // Google Authenticatorのエクスポートの場合は一括追加する
+  if (len > 20 && strncasecmp((const char*)buff, "otpauth-migration://", 20) == 0) {
+    return importMigrationSequence(title, buff, qrbuff.size(), len, needNfc);
   }
-  if (abort) return false;
 
   // URLをパースする
   TotpParams tp;
-  res = parseUriOTP(&tp, String((const char*)buff));   // OTPのURIをパースする
+  res = parseUriOTP(&tp, (char*)buff, len);   // OTPのURIをパースする
   if (debug) spp("parseUriOTP", tf(res));
-  if (!res || tp.digit != 6) {    // 6桁以外のTOTPはライブラリ側が対応していないので
+  if (!res) {
     message = "エラー! このQRコード非対応です";
     ui.selectNotice("OK", title, message, 72, false); // ダイアログ表示
     return false;
@@ -626,34 +661,35 @@ bool funcAddOtp() {
     return false;
   }
 
-  // canvasの作成
-  M5Canvas canvas(ui._dst);
-  canvas.setColorDepth(16);
-  canvas.createSprite(140, 45);
-  canvas.setTextColor(TFT_WHITE);
-  
   // ワンタイムパスワード表示
   bool init = true;
   message = (String)"発行者 "+tp.issuer+"\n";
   message = message + "アカウント "+tp.account+"\n";
   ui.selectNotice("NEXT", title, message, 72, true); // ダイアログ表示
+
+  // canvasの準備（ダイアログを描いたメインパネルのバックバッファに上書きする）
+  M5Canvas& canvas = *ui.panelCanvas(UI_PANEL_MAIN);
+  const int ox = 20, oy = 56;   // 描画範囲の左上（140x45）
   while (1) {
     uint32_t tm = millis();
     // ワンタイムパスワード生成
     bool sync = (init || tms.epoch % tp.period == 0);
     tms = getMultiDateTime(sync);  // 現在時刻の取得
-    String code = getTotp(&tp, tms.epoch);
+    char code[TOTP_CODE_BUFSIZE];
+    if (!getTotp(&tp, tms.epoch, code, sizeof(code))) code[0] = '\0';
     init = false;
-    // ワンタイムパスワード表示
-    canvas.fillSprite(TFT_BLACK);
-    canvas.drawString(code, 25,0, &fonts::Font4);  // 26px
-    canvas.drawString(tms.ymd, 0,28, &fonts::Font2);  // 16px
+    // ワンタイムパスワード表示（描き終わるまでバックバッファをロックする）
+    ui.lockPanel();
+    canvas.setClipRect(ox,oy, 140,45);
+    canvas.fillRect(ox,oy, 140,45, TFT_BLACK);
+    canvas.setTextDatum(TC_DATUM);
+    canvas.drawString(code, ox+70,oy, &fonts::Font4);  // 26px
+    canvas.setTextDatum(TL_DATUM);
+    canvas.drawString(tms.ymd, ox,oy+28, &fonts::Font2);  // 16px
+    canvas.clearClipRect();
+    ui.unlockPanel();
     // canvasの出力
-    ui.lockCanvas();
-    ui._dst->startWrite(); 
-    canvas.pushSprite(ui.mxy.x+20, ui.mxy.y+56);
-    ui._dst->endWrite();
-    ui.unlockCanvas();
+    ui.pushPanel(UI_PANEL_MAIN, oy, 45);
     // ボタン押し待ち
     uint32_t sa = (millis() - tm);
     if (sa <= 1000) {
@@ -668,35 +704,127 @@ bool funcAddOtp() {
   if (selected != 1) return false;
 
   // 秘密鍵が読み込まれてない場合は読み込む
-  if (needNfc) {
-    if (nfcMountSequence(title, 100)) {  // ダイアログ付き NFCマウント
-      if (loadSecret(conf.saveSecret)) status.unlock = true;
-    }
-    nfcUnmountSequence(title, false);  // ダイアログなし NFCアンマウント
-  }
+  if (needNfc) unlockSequence(title);  // ダイアログ付き 解錠
 
   // OTPデータの保存
-  String filename;
+  int slot = -1;
   if (status.unlock) {
-    filename = makeOtpFilename(&tp);
-    if (debug) spp("filename",filename);
-    // if (filename.length() < 20) return false;
-    success = saveOtpFile(filename, &tp);   // FatFSにOTPを保存する
-    if (debug) spp("saveOtp",tf(success));
+    slot = saveOtpRecord(&tp);   // 保存ファイルにOTPを追加する
+    success = (slot >= 0);
+    if (debug) spp("saveOtpRecord",slot);
     if (!success) message = "エラー! OTPの保存に失敗しました";
   } else {
     message = "エラー! 秘密鍵が正常に読み込めませんでした";
   }
+  memset(tp.secret, 0, sizeof(tp.secret));
 
   // 最終表示
   if (success) {
-    nextOtpFilename = filename;   // メニューを抜けたらOTP表示画面へ遷移するための情報
+    nextOtpSlot = slot;   // メニューを抜けたらOTP表示画面へ遷移するための情報
   } else {
     ui.selectNotice("OK", title, message, 72, false); // ダイアログ表示
   }
   return success;
 }
 
+// --------------------------------------------------------------------------------------
+// 【設定】 OTPの追加　Google Authenticatorのエクスポートから一括で追加する
+//   buffには1枚目のQRコードが入っている。複数枚ある場合は続けてスキャンする
+// --------------------------------------------------------------------------------------
+bool importMigrationSequence(String title, uint8_t* buff, size_t buffSize, size_t len, bool needNfc) {
+  const std::vector<String> yesno = { "NO", "YES" };
+  String message;
+  std::vector<TotpParams> tps;
+  uint32_t received = 0;  // 読み込み済みのQRコード（ビットごと）
+  int32_t batchId = 0;
+  uint8_t batchSize = 0;
+  int skipped = 0;
+  bool success = false;
+
+  // 平文の秘密鍵を消去する
+  auto wipe = [&tps]() {
+    for (TotpParams& tp : tps) memset(tp.secret, 0, sizeof(tp.secret));
+    tps.clear();
+  };
+
+  // 全てのQRコードを読み込む
+  while (1) {
+    MigrationBatch batch;
+    size_t before = tps.size();
+    bool res = parseMigrationUri((char*)buff, len, &tps, &batch);
+    memset(buff, 0, buffSize);
+    if (debug) spp("parseMigrationUri", tf(res));
+    if (!res) {
+      message = "エラー! このQRコード非対応です";
+    } else if (batchSize != 0 && (batch.batchId != batchId || batch.batchSize != batchSize)) {
+      message = "エラー! 別のエクスポートのQRコードです";
+    } else if (received & (1UL << batch.batchIndex)) {
+      message = "このQRコードは読み込み済みです";
+    } else {
+      batchId = batch.batchId;
+      batchSize = batch.batchSize;
+      received |= (1UL << batch.batchIndex);
+      skipped += batch.skipped;
+      message = "";
+    }
+    // 読めなかったQRコードの分は取り消す
+    if (message.length() > 0) {
+      for (size_t i=before; i<tps.size(); i++) memset(tps[i].secret, 0, sizeof(TotpParams::secret));
+      tps.resize(before);
+      ui.selectNotice("OK", title, message, 72, false); // ダイアログ表示
+      if (batchSize == 0) return false;
+    }
+    int count = __builtin_popcount(received);
+    if (count == batchSize) break;
+    // 次のQRコード
+    message = String(count) + "/" + String(batchSize) + "枚 読み込み済み\n次のQRコードをスキャンしてください";
+    len = qrScanSequence(title, message, buff, buffSize);
+    if (len == 0) {
+      wipe();
+      return false;
+    }
+  }
+  if (tps.size() == 0) {
+    message = "エラー! 追加できるサイトがありません";
+    if (skipped > 0) message = message + "\n(非対応 " + String(skipped) + "件)";
+    ui.selectNotice("OK", title, message, 72, false); // ダイアログ表示
+    return false;
+  }
+
+  // 確認
+  message = String(tps.size()) + "件のサイトを追加しますか?\n";
+  if (skipped > 0) message = message + "(非対応 " + String(skipped) + "件は除外)\n";
+  if (needNfc) message = message + "\nNFCカードを用意してください";
+  int selected = ui.selectDialog(yesno, 0, title, message, 72); // ダイアログ表示
+  if (selected != 1) {
+    wipe();
+    return false;
+  }
+
+  // 秘密鍵が読み込まれてない場合は読み込む（全件で1回だけ）
+  if (needNfc) unlockSequence(title);  // ダイアログ付き 解錠
+
+  // OTPデータをまとめて保存
+  int added = 0, duplicated = 0;
+  if (status.unlock) {
+    success = saveOtpRecords(&tps, &added, &duplicated);   // 保存ファイルにまとめて追加する
+    if (debug) spp("saveOtpRecords",tf(success));
+    if (success) {
+      message = String(added) + "件のサイトを追加しました";
+      if (duplicated > 0) message = message + "\n(登録済み " + String(duplicated) + "件)";
+    } else {
+      message = "エラー! OTPの保存に失敗しました\n追加は取り消されました";
+    }
+  } else {
+    message = "エラー! 秘密鍵が正常に読み込めませんでした";
+  }
+  wipe();
+
+  // 最終表示
+  ui.selectNotice("OK", title, message, 72, false); // ダイアログ表示
+  return success;
+}
+
 // --------------------------------------------------------------------------------------
 // 【設定】 OTPの削除
 // --------------------------------------------------------------------------------------
@@ -708,32 +836,21 @@ bool funcDelOtp() {
   bool res;
 
   // OTP一覧の取得  
-  std::vector<TotpParamsList> tps;
-  int cnt = listAllOtpFiles(&tps, false);
+  const std::vector<OtpIndex>& tps = getOtpIndex();
+  int cnt = tps.size();
   if (cnt < 1) {
     message = "エラー! 保存されているデータはありません";
     ui.selectNotice("OK", title, message, 72, false); // ダイアログ表示
     return false;
   }
 
-  // メニュー変数の作成
-  MenuDef menu = {
-    .title = title,
-    .select = 0,
-    .selected = -1,
-    .idx = 0,
-    .cur = 0,
-  };
-  menu.lists.push_back({ 0, 0, "戻る", nullptr, "" });
-  for (int i=0; i<cnt; i++) {
-    String text = String(tps[i].tp.issuer) + " " + String(tps[i].tp.account);
-    menu.lists.push_back({ 0, 0, text, nullptr, "" });
-  }
+  // メニュー変数の作成（作成済みのメニューを使う）
+  MenuDef* menu = getOtpMenu(title, 0);
 
   // 一覧から選択
   String description = "サイトを選択してください";
-  int boxnum = (menu.lists.size() < 4) ? menu.lists.size() : 4;
-  selected = ui.selectMenuList(&menu, -1, boxnum, description, 20);  // リスト形式のメニューを選択する
+  int boxnum = (menu->lists.size() < 4) ? menu->lists.size() : 4;
+  selected = ui.selectMenuList(menu, -1, boxnum, description, 20);  // リスト形式のメニューを選択する
 
   // 削除
   res = false;
@@ -741,17 +858,16 @@ bool funcDelOtp() {
     // 確認
     int delno = selected - 1;
     message = "以下のサイトを削除しますか?\n";
-    message = (String)"発行者 "+tps[delno].tp.issuer+"\n";
-    message = message + "アカウント "+tps[delno].tp.account+"\n";
+    message = (String)"発行者 "+tps[delno].issuer+"\n";
+    message = message + "アカウント "+tps[delno].account+"\n";
     selected = ui.selectDialog(yesno, 0, title, message, 72); // ダイアログ表示
     if (selected != 1) return false;
     message = "本当に削除してよろしいですか?\n";
     selected = ui.selectDialog(yesno, 0, title, message, 72); // ダイアログ表示
     if (selected != 1) return false;
     // 削除実行
-    if (debug) sp("File Delete: "+tps[delno].filename);
-    res = deleteFile(tps[delno].filename);
-    if (debug) spp("deleteFile",tf(res));
+    res = deleteOtpRecord(tps[delno].slot);
+    if (debug) spp("deleteOtpRecord",tf(res));
   }
 
   return res;
@@ -773,8 +889,8 @@ bool funcExportOtp() {
   }
 
   // OTP一覧の取得  
-  std::vector<TotpParamsList> tps;
-  int cnt = listAllOtpFiles(&tps, false);
+  const std::vector<OtpIndex>& tps = getOtpIndex();
+  int cnt = tps.size();
   if (cnt < 1) {
     message = "エラー! 保存されているデータはありません";
   }
@@ -785,37 +901,21 @@ bool funcExportOtp() {
     return false;
   }
 
-  // メニュー変数の作成
-  MenuDef menu = {
-    .title = title,
-    .select = 0,
-    .selected = -1,
-    .idx = 0,
-    .cur = 0,
-  };
-  menu.lists.push_back({ 0, 0, "戻る", nullptr, "" });
-  for (int i=0; i<cnt; i++) {
-    String text = String(tps[i].tp.issuer) + " " + String(tps[i].tp.account);
-    menu.lists.push_back({ 0, 0, text, nullptr, "" });
-  }
+  // メニュー変数の作成（作成済みのメニューを使う）
+  MenuDef* menu = getOtpMenu(title, 0);
 
   // 一覧から選択
   int seltp = -1;
   String description = "サイトを選択してください";
-  int boxnum = (menu.lists.size() < 4) ? menu.lists.size() : 4;
-  selected = ui.selectMenuList(&menu, -1, boxnum, description, 20);  // リスト形式のメニューを選択する
+  int boxnum = (menu->lists.size() < 4) ? menu->lists.size() : 4;
+  selected = ui.selectMenuList(menu, -1, boxnum, description, 20);  // リスト形式のメニューを選択する
   if (selected > 0) {
     seltp = selected - 1;
   }
   if (seltp < 0) return false;
 
   // 秘密鍵が読み込まれてない場合は読み込む
-  if (needNfc) {
-    if (nfcMountSequence(title, 100)) {  // ダイアログ付き NFCマウント
-      if (loadSecret(conf.saveSecret)) status.unlock = true;
-    }
-    nfcUnmountSequence(title, false);  // ダイアログなし NFCアンマウント
-  }
+  if (needNfc) unlockSequence(title);  // ダイアログ付き 解錠
   if (!status.unlock) {
     message = "エラー! 秘密鍵が正常に読み込めませんでした";
     ui.selectNotice("OK", title, message, 72, false); // ダイアログ表示
@@ -824,8 +924,8 @@ bool funcExportOtp() {
 
   // OTPファイルを読み込む
   TotpParams tp;
-  res = loadOtpFile(tps[seltp].filename, &tp, true);
-  if (debug) spp("loadOtpFile",tf(res));
+  res = loadOtpRecord(tps[seltp].slot, &tp, true);
+  if (debug) spp("loadOtpRecord",tf(res));
   if (!res) return false;
   
   // URL作成
@@ -843,6 +943,9 @@ bool funcExportOtp() {
   if (strlen(tp.issuer) > 0) {
     url = url + "&issuer=" + urlEncode(tp.issuer);
   }
+  if (tp.algorithm != TOTP_ALGO_SHA1) {
+    url = url + "&algorithm=" + TotpGenerator::algorithmName(tp.algorithm);
+  }
   if (tp.period > 0) {
     url = url + "&period=" + String(tp.period);
   }
@@ -982,11 +1085,9 @@ bool functAdjustTime() {
   // 画面枠とボタンの表示
   ui.selectNotice("NEXT", title, "", 24, true); // 枠のみ表示
 
-  // canvasの作成
-  M5Canvas canvas(ui._dst);
-  canvas.setColorDepth(16);
-  canvas.createSprite(ui.mwh.w-20, 50);
-  canvas.setTextColor(TFT_WHITE);
+  // canvasの準備（メインパネルのバックバッファに上書きする）
+  M5Canvas& canvas = *ui.panelCanvas(UI_PANEL_MAIN);
+  const int ox = 10, oy = 40;   // 描画範囲の左上（メインパネル幅-20 x 50）
 
   // 現在時刻の取得
   Tms tms = getMultiDateTime(true);
@@ -1003,9 +1104,11 @@ bool functAdjustTime() {
   for (int hcur=0; hcur<6; hcur++) {
     btn = false;
     while (1) {
-      // 日時表示
-      canvas.fillSprite(TFT_BLACK);
-      canvas.setCursor(0, 0);
+      // 日時表示（描き終わるまでバックバッファをロックする）
+      ui.lockPanel();
+      canvas.setClipRect(ox,oy, ui.mwh.w-20,50);
+      canvas.fillRect(ox,oy, ui.mwh.w-20,50, TFT_BLACK);
+      canvas.setCursor(ox, oy);
       canvas.setFont(&fonts::Font4);  // 26px
       for (int i=0; i<6; i++) {
         sprintf(buff, ((i==0) ? "20%02d" : "%02d"), dt[i]);
@@ -1014,14 +1117,12 @@ bool functAdjustTime() {
         message = (i<=1) ? " / " : ((i>=3&&i<=4) ? " : " : "");
         canvas.setTextColor(TFT_WHITE);
         canvas.print(message);
-        if (i == 2) canvas.print("\n");
+        if (i == 2) canvas.setCursor(ox, oy + canvas.fontHeight());  // 改行
       }
+      canvas.clearClipRect();
+      ui.unlockPanel();
       // canvasの出力
-      ui.lockCanvas();
-      ui._dst->startWrite(); 
-      canvas.pushSprite(ui.mxy.x+10, ui.mxy.y+40);
-      ui._dst->endWrite();
-      ui.unlockCanvas();
+      ui.pushPanel(UI_PANEL_MAIN, oy, 50);
       // ロータリーエンコーダー操作
       while (1) {
         M5.update();
@@ -1198,6 +1299,48 @@ bool funcAutoSleepPw() {
   return success;
 }
 
+// --------------------------------------------------------------------------------------
+// 【設定】無操作時 NFCから読み込んだ秘密鍵をメモリから消去する秒数を設定する
+// --------------------------------------------------------------------------------------
+bool funcUnlockTimeout() {
+  bool success = false;
+  String message;
+  int boxnum, selected, orig = -1;
+
+  // メニュー変数の作成
+  MenuDef menu = {
+    .title = "秘密鍵の自動消去",
+    .select = 0,
+    .selected = -1,
+    .idx = 0,
+    .cur = 0,
+  };
+  menu.lists.push_back({ 0, 0, "戻る", nullptr, "" });
+  menu.lists.push_back({ 0, 0, "電源オフまで", nullptr, "" });
+  const uint16_t nums[] = { 30, 60, 120, 300, 600, 1800, 3600 };
+  size_t numsSize = sizeof(nums) / sizeof(nums[0]);
+  for (int i=0; i<numsSize; i++) {
+    menu.lists.push_back({ 0, 0, String(nums[i])+String(" 秒"), nullptr, "" });
+    if (nums[i] == conf.unlockTimeout) orig = i + 2;
+  }
+  if (conf.unlockTimeout == 0) orig = 1;
+
+  // リストの選択
+  message = "無操作時にNFCから読み込んだ秘密鍵を消去する秒数を設定します";
+  boxnum = (menu.lists.size() < 3) ? menu.lists.size() : 3;
+  selected = ui.selectMenuList(&menu, orig, boxnum, message, 35);  // リスト形式のメニューを選択する
+
+  // 設定の保存
+  if (selected > 0 && selected < numsSize+2) {
+    uint16_t timeoutNew = (selected == 1) ? 0 : nums[selected-2];
+    if (timeoutNew != conf.unlockTimeout) {
+      conf.unlockTimeout = timeoutNew;
+      success = cf.saveConfig(conf);
+    }
+  }
+  return success;
+}
+
 // --------------------------------------------------------------------------------------
 // 【設定】 フォーマット FatFS
 // --------------------------------------------------------------------------------------
@@ -1231,6 +1374,7 @@ bool funcFormatFatfs() {
   res = FFat.format();
   if (res) res = FFat.begin();
   else if (debug) sp("format error!");
+  if (res) vaultBegin();  // 空の保存ファイルを作り直す
   if (debug) spp("FFat.format", tf(res));
   // 結果表示
   message = (String) (res ? "フォーマット成功" : "フォーマット失敗") + "\n";
@@ -1330,7 +1474,7 @@ bool funcKeyMove() {
 
     // 秘密鍵が未ロードなら読み込む（NFC→メモリ）
     if (!status.unlock && conf.saveSecret == CONF_SECRET_NFC) {
-      if (loadSecret(conf.saveSecret)) status.unlock = true;
+      unlockSecret(conf.saveSecret);
     }
     if (!status.unlock) {
       message = "エラー! 秘密鍵が読み込めませんでした";
@@ -1443,9 +1587,8 @@ bool funcKeyDuplicate() {
     }
 
     // 秘密鍵を読み込む（NFC→メモリ）
-    status.unlock = false;
-    deleteSecret(CONF_SECRET_MEMORY);
-    if (loadSecret(CONF_SECRET_NFC)) status.unlock = true;
+    lockSecret();
+    unlockSecret(CONF_SECRET_NFC);
     if (!status.unlock) {
       message = "エラー! NFCから秘密鍵が読み込めませんでした";
       abort = true;
@@ -1502,6 +1645,207 @@ bool funcKeyDuplicate() {
   return true;
 }
 
+// --------------------------------------------------------------------------------------
+// 【設定】予備のNFCカードを連続で作成する
+//   秘密鍵の読み込みと暗号化は最初に1回だけ行い、かざしたカードをプロテクト→書き込み→確認する
+//   カードごとのダイアログはなく、結果はUIDと一緒にFatFSとシリアルに記録する。ボタンで終了
+// --------------------------------------------------------------------------------------
+bool funcKeyProvision() {
+  String title = "NFCカードの一括作成";
+  String message = "";
+  const std::vector<String> yesno = { "NO", "YES" };
+  uint8_t selected;
+
+  // 事前チェック
+  if (!status.unitRFIDready || conf.saveSecret != CONF_SECRET_NFC) {
+    message = "エラー! まずはじめに、秘密鍵はNFCカードに保存してください";
+    ui.selectNotice("OK", title, message, 72, false); // ダイアログ表示
+    return false;
+  }
+
+  // 確認
+  message = "【警告!!】\nかざしたNFCカードは確認なしで全てのデータが消去されます。よろしいですか?";
+  selected = ui.selectDialog(yesno, 0, title, message, 72); // ダイアログ表示
+  if (selected != 1) return false;
+
+  // 秘密鍵を読み込んで、書き込む内容を作っておく
+  SecretDef sdef;
+  if (!unlockSequence(title) || !makeSecretDef(&sdef)) {
+    message = "エラー! 秘密鍵が正常に読み込めませんでした";
+    ui.selectNotice("OK", title, message, 72, false); // ダイアログ表示
+    return false;
+  }
+
+  // カードをかざすたびに書き込む
+  uint32_t done = 0, failed = 0;
+  uint32_t tmStart = millis();
+  String lastResult = "";
+  bool refresh = true;
+  autoSleepEnable = false;
+  beep(BEEP_DOUBLE);
+  nfc.init();
+  while (1) {
+    // 進捗の表示
+    if (refresh) {
+      float minutes = (millis() - tmStart) / 60000.0;
+      float cpm = (minutes > 0) ? done / minutes : 0;
+      message = "成功 " + String(done) + "枚  失敗 " + String(failed) + "枚  " + String(cpm, 1) + "枚/分\n" + lastResult;
+      ui.selectNotice("END", title, message, 72, true); // 枠のみ表示
+      refresh = false;
+    }
+    if (waitPressButton(20)) break;   // ボタン押し待ち (20ms待機)
+    if (!nfc.detectCard() || !nfc.mountCard(500, PRT_AUTO, false)) continue;
+
+    // プロテクト → 書き込み → 書き込んだスロットを読み返して確認
+    String uid = nfc.getUidString();
+    bool res = nfcChangeProtect(true, false);   // Protect On, Format Quick
+    if (res) res = saveSecretNfc(&sdef);
+    nfc.unmountCard();  // HALTにするので、外すまで同じカードは検出されない
+    beep(res ? BEEP_SHORT : BEEP_ERROR);
+    if (res) done++; else failed++;
+
+    // 記録
+    String line = getMultiDateTime().ymd + "," + uid + "," + (res ? "OK" : "NG");
+    appendTextFile(line, FN_PROVISION_LOG);
+    sp("Provision " + line);
+    lastResult = uid + (res ? " 成功" : " 失敗");
+    unlockSessionTouch();
+    refresh = true;
+  }
+  autoSleepEnable = true;
+
+  // 結果表示
+  message = "成功 " + String(done) + "枚  失敗 " + String(failed) + "枚\n記録: " + FN_PROVISION_LOG;
+  ui.selectNotice("OK", title, message, 72, false); // ダイアログ表示
+  return (done > 0);
+}
+
+// --------------------------------------------------------------------------------------
+// 【設定】秘密鍵を分割して複数のNFCカードに保存する(k-of-n)
+// --------------------------------------------------------------------------------------
+bool funcKeySplit() {
+  String title = "NFCの秘密鍵を分割";
+  String message = "";
+  const std::vector<String> yesno = { "NO", "YES" };
+  const std::vector<String> kinds = { "<<", "2/2", "2/3", "3/5" };  // 復元に必要な枚数/分割する枚数
+  const uint8_t ks[] = { 0, 2, 2, 3 };
+  const uint8_t ns[] = { 0, 2, 3, 5 };
+  int selected;
+  bool res;
+
+  // 事前チェック
+  if (!status.unitRFIDready || conf.saveSecret != CONF_SECRET_NFC) {
+    message = "エラー! まずはじめに、秘密鍵はNFCカードに保存してください";
+    ui.selectNotice("OK", title, message, 72, false); // ダイアログ表示
+    return false;
+  }
+
+  // 枚数の選択
+  message = "復元に必要な枚数/分割する枚数を選んでください";
+  selected = ui.selectDialog(kinds, 2, title, message, 72); // ダイアログ表示
+  if (selected < 1) return false;
+  uint8_t k = ks[selected];
+  uint8_t n = ns[selected];
+
+  // 確認
+  message = "【警告!!】\n" + String(n) + "枚のNFCカードは全てのデータが消去されます。よろしいですか?";
+  selected = ui.selectDialog(yesno, 0, title, message, 72); // ダイアログ表示
+  if (selected != 1) return false;
+
+  // 秘密鍵が読み込まれてない場合は読み込む
+  if (!unlockSequence(title)) {
+    message = "エラー! 秘密鍵が正常に読み込めませんでした";
+    ui.selectNotice("OK", title, message, 72, false); // ダイアログ表示
+    return false;
+  }
+
+  // 秘密鍵を分割する
+  byte shares[SHARD_MAX][32];
+  uint8_t id = esp_random() & 0xFF;
+  if (!shardSplit(status.secret, k, n, shares)) {
+    mbedtls_platform_zeroize(shares, sizeof(shares));
+    message = "エラー! 秘密鍵を分割できませんでした";
+    ui.selectNotice("OK", title, message, 72, false); // ダイアログ表示
+    return false;
+  }
+
+  // トランザクションの開始　1枚ずつNFCマウントして書き込む
+  bool abort = false;
+  String uids[SHARD_MAX];
+  message = "";
+  for (int i=0; i<n; i++) {
+    // 確認
+    message = String(i+1) + "/" + String(n) + " 枚目のNFCカードを用意してください";
+    ui.selectNotice("OK", title, message, 72, false); // ダイアログ表示
+
+    // NFCのマウント
+    res = nfcMountSequence(title, 500);  // ダイアログ付き NFCマウント
+    if (!res) {
+      message = "エラー! NFCカードが認識できませんでした";
+      abort = true;
+      break;
+    }
+
+    // 同じカードに2つの分割片を書かないようにする
+    uids[i] = nfc.getUidString();
+    bool dup = false;
+    for (int j=0; j<i; j++) dup |= (uids[j] == uids[i]);
+    if (dup) {
+      nfcUnmountSequence(title, false);  // NFCのアンマウント（ダイアログなし）
+      message = "このNFCカードは書き込み済みです。別のカードを用意してください";
+      ui.selectNotice("OK", title, message, 72, false); // ダイアログ表示
+      i--;
+      continue;
+    }
+
+    // 分割する前の秘密鍵が入っているカードは最後に書く（途中で中断しても、秘密鍵がカードに残るように）
+    SecretDef sdef;
+    bool hasSecret = readSecretDef(CONF_SECRET_NFC, &sdef);
+    bool fullKey = hasSecret && sdef.rfui[SRFUI_SHARD_X] == 0;
+    mbedtls_platform_zeroize(&sdef, sizeof(sdef));
+    if (fullKey && i < n-1) {
+      nfcUnmountSequence(title, false);  // NFCのアンマウント（ダイアログなし）
+      message = "このNFCカードには分割する前の秘密鍵が入っています。最後に書き込むので、別のカードを用意してください";
+      ui.selectNotice("OK", title, message, 72, false); // ダイアログ表示
+      i--;
+      continue;
+    }
+
+    // NFCをプロテクトモードに書き換える
+    //   秘密鍵ファイルが読めたカードはプロテクト済みなので、消去せずにA/Bスロットの古い方に書く
+    res = hasSecret || nfcChangeProtect(true, false);   // Protect On, Format Quick
+    if (debug) spp("NFC Protect", tf(res));
+    if (!res) {
+      message = "エラー! このNFCカードは書込みできません";
+      abort = true;
+      break;
+    }
+
+    // 分割片の保存（メモリ→NFC）
+    res = saveSecretShard(shares[i], i+1, k, n, id);
+    if (!res) {
+      message = "エラー! NFCに秘密鍵を書き込めませんでした";
+      abort = true;
+      break;
+    }
+    nfcUnmountSequence(title, false);  // NFCのアンマウント（ダイアログなし）
+  }
+  mbedtls_platform_zeroize(shares, sizeof(shares));
+
+  // トランザクションの終了
+  if (abort) {
+    nfcUnmountSequence(title, false);  // NFCのアンマウント（ダイアログなし）
+    message += "\n最初からやり直してください";
+    ui.selectNotice("OK", title, message, 72, false); // ダイアログ表示
+    return false;
+  }
+
+  // 結果表示
+  message = "秘密鍵の分割が成功しました\n次回から" + String(k) + "枚のNFCカードをかざして解錠します";
+  ui.selectNotice("OK", title, message, 72, false); // ダイアログ表示
+  return true;
+}
+
 // --------------------------------------------------------------------------------------
 // 【設定】 開発者モードの有効化
 // --------------------------------------------------------------------------------------
@@ -1571,8 +1915,9 @@ bool funcHexDump() {
         if (selected == 1) {  // 通常のNFCダンプ
           nfc.dumpAll();
         } else if (selected == 2) {  // プロテクトのかかったNFCをダンプする
-          PhyAddr pa1 = nfc.addr2PhysicalAddr(SECRET_NFC_PARTITION_ADDR, nfc._cardType);
-          PhyAddr pa2 = nfc.addr2PhysicalAddr(SECRET_NFC_PARTITION_ADDR + SECRET_SAVE_SIZE - 1, nfc._cardType);
+          uint16_t vaddr = (nfc.isUltralight()) ? SECRET_NFC_NDEF_ADDR : SECRET_NFC_PARTITION_ADDR;  // ULはNDEFコンテナのデータ領域
+          PhyAddr pa1 = nfc.addr2PhysicalAddr(vaddr, nfc._cardType);
+          PhyAddr pa2 = nfc.addr2PhysicalAddr(vaddr + SECRET_NFC_AREA_SIZE - 1, nfc._cardType);
           nfc.dumpAll(true, pa1.blockAddr, pa2.blockAddr);
         }
         nfcUnmountSequence(menu.title, false);  // ダイアログなし NFCアンマウント
@@ -1711,6 +2056,24 @@ bool funcDevelopSendAscii() {
   return true;
 }
 
+// --------------------------------------------------------------------------------------
+// 【デバッグ】処理速度を計測してシリアルに出力する
+// --------------------------------------------------------------------------------------
+bool funcDevelopBenchmark() {
+  const String title = "DEBUG ベンチマーク";
+  const std::vector<String> yesno = { "NO", "YES" };
+  if (!conf.develop) return false;
+  // 確認
+  String message = "実行しますか? 結果はシリアルコンソールに出力されます";
+  int selected = ui.selectDialog(yesno, 0, title, message, 72); // ダイアログ表示
+  if (selected != 1) return false;
+  // 実行
+  ui.selectNotice("wait...", title, "計測中です。そのままお待ちください。", 72, true); // ダイアログ表示　のみ
+  runBenchmarks();
+  ui.selectNotice("OK", title, "計測が完了しました", 72, false); // ダイアログ表示
+  return true;
+}
+
 // --------------------------------------------------------------------------------------
 // 【デバッグ】SSL証明書を削除して再生成する 
 // --------------------------------------------------------------------------------------
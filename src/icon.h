@@ -35,542 +35,31 @@ struct ImageInfo {  // 画像データの構造体
   const uint16_t posX;
   const uint16_t posY;
   const unsigned short transparent;
+  const uint8_t* rle;
+  const uint16_t* palette;
 };
 */
 
-// オンライン画像変換サイト by lang-ship.com
-// https://lang-ship.com/tools/image2data/
-
-const uint16_t imgBin_ble_off[576] PROGMEM = {
-  0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xEA10,// row 0, 24 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 1, 48 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x924A,0x924A,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 2, 72 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x936B,0xB373,0xD252,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 3, 96 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xB373,0xB373,0xB373,0xF252,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 4, 120 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x1132,0xF252,0xD129,0x9019,0x9019,0x9019,0xB373,0xB373,0xB373,0xB373,0xD252,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 5, 144 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0xF252,0xB373,0x736B,0xD129,0x9019,0x9019,0xB373,0xB373,0x924A,0xB373,0xB373,0xD252,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 6, 168 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0xD129,0x736B,0xB373,0x736B,0xD129,0x9019,0xB373,0xB373,0x9019,0xB24A,0xB373,0xB373,0x313A,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 7, 192 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0xD129,0x736B,0xB373,0x736B,0xD129,0xB373,0xB373,0xD129,0x736B,0xB373,0x736B,0xB129,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 8, 216 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xD129,0x736B,0xB373,0x736B,0xB373,0xB373,0x736B,0xB373,0x736B,0xD129,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 9, 240 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xD129,0x7363,0xB373,0xB373,0xB373,0xB373,0x736B,0xF129,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 10, 264 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xD129,0x7363,0xB373,0xB373,0x736B,0xD129,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 11, 288 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xD129,0x7363,0xB373,0xB373,0x736B,0xD129,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 12, 312 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xD129,0x7363,0xB373,0xB373,0xB373,0xB373,0x736B,0xD129,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 13, 336 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xD129,0x736B,0xB373,0x736B,0xB373,0xB373,0x736B,0xB373,0x736B,0xD129,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 14, 360 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0xD129,0x736B,0xB373,0x736B,0xD129,0xB373,0xB373,0xD129,0x736B,0xB373,0x736B,0xB129,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 15, 384 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0xD129,0x736B,0xB373,0x736B,0xD129,0x9019,0xB373,0xB373,0x9019,0xB24A,0xB373,0xB373,0x313A,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 16, 408 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0xF252,0xB373,0x736B,0xD129,0x9019,0x9019,0xB373,0xB373,0x924A,0xB373,0xB373,0xD252,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 17, 432 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x1132,0xF252,0xD129,0x9019,0x9019,0x9019,0xB373,0xB373,0xB373,0xB373,0xD252,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 18, 456 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xB373,0xB373,0xB373,0xF252,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 19, 480 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x936B,0xB373,0xD252,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 20, 504 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x924A,0x924A,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 21, 528 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 22, 552 pixels
-  0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,// row 23, 576 pixels
-};
-
-const uint16_t imgBin_ble_on[576] PROGMEM = {
-  0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xEA10,// row 0, 24 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 1, 48 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xB694,0xB694,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 2, 72 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xFCDE,0x1CE7,0x57A5,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 3, 96 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x1CE7,0x77AD,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 4, 120 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x5363,0x77AD,0xB24A,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x57A5,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 5, 144 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x77AD,0x1CE7,0x9AD6,0xB24A,0x9019,0x9019,0x1CE7,0x1CE7,0x958C,0x1CE7,0x1CE7,0x57A5,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 6, 168 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0xB24A,0x9AD6,0x1CE7,0x9AD6,0xB24A,0x9019,0x1CE7,0x1CE7,0x9019,0xF69C,0x1CE7,0x1CE7,0xB473,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 7, 192 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0xB24A,0x9AD6,0x1CE7,0x9AD6,0xB24A,0x1CE7,0x1CE7,0xB24A,0x9AD6,0x1CE7,0x9AD6,0x5142,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 8, 216 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xB24A,0x9AD6,0x1CE7,0x9AD6,0x1CE7,0x1CE7,0x9AD6,0x1CE7,0x9AD6,0xD252,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 9, 240 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xB24A,0x9AD6,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x9BD6,0xD252,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 10, 264 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xB24A,0x9AD6,0x1CE7,0x1CE7,0x9BD6,0xD252,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 11, 288 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xB24A,0x9AD6,0x1CE7,0x1CE7,0x9BD6,0xD252,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 12, 312 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xB24A,0x9AD6,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x9BD6,0xD252,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 13, 336 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xB24A,0x9AD6,0x1CE7,0x9AD6,0x1CE7,0x1CE7,0x9AD6,0x1CE7,0x9AD6,0xB24A,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 14, 360 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0xB24A,0x9AD6,0x1CE7,0x9AD6,0xB24A,0x1CE7,0x1CE7,0xB24A,0x9AD6,0x1CE7,0x9AD6,0x5142,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 15, 384 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0xB24A,0x9AD6,0x1CE7,0x9AD6,0xB24A,0x9019,0x1CE7,0x1CE7,0x9019,0xF69C,0x1CE7,0x1CE7,0xB473,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 16, 408 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x77AD,0x1CE7,0x9AD6,0xB24A,0x9019,0x9019,0x1CE7,0x1CE7,0x958C,0x1CE7,0x1CE7,0x57A5,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 17, 432 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x5363,0x77AD,0xB24A,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x57A5,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 18, 456 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x1CE7,0x77AD,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 19, 480 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xFCDE,0x1CE7,0x57AD,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 20, 504 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9594,0xB694,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 21, 528 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 22, 552 pixels
-  0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,// row 23, 576 pixels
-};
-
-const uint16_t imgBin_lock_off[576] PROGMEM = {
-  0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xEA10,// row 0, 24 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x7142,0x5363,0x936B,0x936B,0x5363,0x7142,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 1, 48 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xF252,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xF252,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 2, 72 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x7142,0xB373,0x936B,0xD252,0xF129,0xF129,0xD252,0xB36B,0xB373,0x7142,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 3, 96 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x5363,0xB373,0xD252,0x9019,0x9019,0x9019,0x9019,0xD252,0xB373,0x5363,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 4, 120 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x936B,0xB373,0xD129,0x9019,0x9019,0x9019,0x9019,0xD129,0xB373,0x936B,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 5, 144 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xB373,0xB373,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xB373,0xB373,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 6, 168 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xB373,0xB373,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xB373,0xB373,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 7, 192 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x7142,0x936B,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0x936B,0x7142,0x9019,0x9019,0x9019,0xEA10,// row 8, 216 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x936B,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0x736B,0x9019,0x9019,0x9019,0xEA10,// row 9, 240 pixels
-  0xFB42,0x9019,0x9019,0x9019,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0x9019,0x9019,0x9019,0xEA10,// row 10, 264 pixels
-  0xFB42,0x9019,0x9019,0x9019,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0x9019,0x9019,0x9019,0xEA10,// row 11, 288 pixels
-  0xFB42,0x9019,0x9019,0x9019,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0x9019,0x9019,0x9019,0xEA10,// row 12, 312 pixels
-  0xFB42,0x9019,0x9019,0x9019,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0x3363,0xF131,0xF131,0x3363,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0x9019,0x9019,0x9019,0xEA10,// row 13, 336 pixels
-  0xFB42,0x9019,0x9019,0x9019,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xF131,0x9019,0x9019,0xF131,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0x9019,0x9019,0x9019,0xEA10,// row 14, 360 pixels
-  0xFB42,0x9019,0x9019,0x9019,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xF131,0x9019,0x9019,0xF131,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0x9019,0x9019,0x9019,0xEA10,// row 15, 384 pixels
-  0xFB42,0x9019,0x9019,0x9019,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0x3363,0xF131,0xF131,0x3363,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0x9019,0x9019,0x9019,0xEA10,// row 16, 408 pixels
-  0xFB42,0x9019,0x9019,0x9019,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0x9019,0x9019,0x9019,0xEA10,// row 17, 432 pixels
-  0xFB42,0x9019,0x9019,0x9019,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0x9019,0x9019,0x9019,0xEA10,// row 18, 456 pixels
-  0xFB42,0x9019,0x9019,0x9019,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0x9019,0x9019,0x9019,0xEA10,// row 19, 480 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x936B,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0x736B,0x9019,0x9019,0x9019,0xEA10,// row 20, 504 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x7142,0x736B,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0xB373,0x736B,0x7142,0x9019,0x9019,0x9019,0xEA10,// row 21, 528 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 22, 552 pixels
-  0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,// row 23, 576 pixels
-};
-
-const uint16_t imgBin_unlock_on[576] PROGMEM = {
-  0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xEA10,// row 0, 24 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x147C,0x39C6,0xDBDE,0xFBDE,0x5AC6,0x5584,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 1, 48 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x37A5,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x77AD,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 2, 72 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x3484,0x1CE7,0x1CE7,0x16A5,0xB24A,0xD252,0x17A5,0x1CE7,0x1CE7,0x5584,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 3, 96 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x39C6,0x1CE7,0x37A5,0x9019,0x9019,0x9019,0x9019,0x37A5,0x1CE7,0x39C6,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 4, 120 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xF9BD,0xBBD6,0x7142,0x9019,0x9019,0x9019,0x9019,0xD252,0x1CE7,0xFBDE,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 5, 144 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 6, 168 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 7, 192 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x5584,0xBBD6,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0xBBD6,0x3584,0x9019,0x9019,0x9019,0xEA10,// row 8, 216 pixels
-  0xFB42,0x9019,0x9019,0x9019,0xBBD6,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0xBBD6,0x9019,0x9019,0x9019,0xEA10,// row 9, 240 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0xD473,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xF47B,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0xEA10,// row 10, 264 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0xEA10,// row 11, 288 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0xEA10,// row 12, 312 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x5584,0xBBD6,0xBBD6,0x3584,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0xEA10,// row 13, 336 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0x9019,0xBBD6,0x1CE7,0x1CE7,0xBBD6,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0xEA10,// row 14, 360 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0x9019,0xBBD6,0x1CE7,0x1CE7,0xBBD6,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0xEA10,// row 15, 384 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x3584,0xBBD6,0xBBD6,0x3584,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0xEA10,// row 16, 408 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0xEA10,// row 17, 432 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0xEA10,// row 18, 456 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0xF47B,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xF47B,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0xEA10,// row 19, 480 pixels
-  0xFB42,0x9019,0x9019,0x9019,0xBBD6,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0xBBD6,0x9019,0x9019,0x9019,0xEA10,// row 20, 504 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x3584,0xBBD6,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0xBBD6,0x3584,0x9019,0x9019,0x9019,0xEA10,// row 21, 528 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 22, 552 pixels
-  0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,// row 23, 576 pixels
-};
-
-
-const uint16_t imgBin_qr_off[576] PROGMEM = {
-  0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xEA10,// row 0, 24 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 1, 48 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 2, 72 pixels
-  0xFB42,0x9019,0x946B,0xB473,0xB473,0xB473,0xB473,0xB473,0xB473,0x313A,0xB129,0xB473,0x5363,0x9019,0xF252,0xB473,0xB473,0xB473,0xB473,0xB473,0xB473,0x135B,0x9019,0xEA10,// row 3, 96 pixels
-  0xFB42,0x9019,0xF47B,0x147C,0xB473,0xB473,0xB473,0xF47B,0x157C,0x513A,0xD129,0xD473,0x736B,0x9019,0x3363,0x157C,0xD473,0xB473,0xB473,0xD473,0x157C,0x5363,0x9019,0xEA10,// row 4, 120 pixels
-  0xFB42,0x9019,0xF47B,0xD473,0x9019,0x9019,0x9019,0x3363,0x157C,0x513A,0x9019,0x9019,0x9019,0x9019,0x3363,0x157C,0x7142,0x9019,0x9019,0xF131,0x157C,0x5363,0x9019,0xEA10,// row 5, 144 pixels
-  0xFB42,0x9019,0xF47B,0xD473,0x9019,0x9019,0x9019,0x3363,0x157C,0x513A,0xB121,0x5363,0x125B,0x9019,0x3363,0x157C,0x7142,0x9019,0x9019,0xF131,0x157C,0x5363,0x9019,0xEA10,// row 6, 168 pixels
-  0xFB42,0x9019,0xF47B,0xD473,0x9019,0x9019,0x9019,0x3363,0x157C,0x513A,0xD129,0x157C,0xB473,0x9019,0x3363,0x157C,0x7142,0x9019,0x9019,0xF131,0x157C,0x5363,0x9019,0xEA10,// row 7, 192 pixels
-  0xFB42,0x9019,0xF47B,0x157C,0xF47B,0xF47B,0xF47B,0x147C,0x157C,0x513A,0xD129,0x157C,0xB473,0x9019,0x3363,0x157C,0xF47B,0xF47B,0xF47B,0xF47B,0x157C,0x5363,0x9019,0xEA10,// row 8, 216 pixels
-  0xFB42,0x9019,0x5363,0x736B,0x736B,0x736B,0x736B,0x736B,0x736B,0x1132,0xD129,0x157C,0xB473,0x9019,0xB24A,0x736B,0x736B,0x736B,0x736B,0x736B,0x736B,0xD252,0x9019,0xEA10,// row 9, 240 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xD129,0x157C,0xB473,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 10, 264 pixels
-  0xFB42,0x9019,0x946B,0x936B,0x9019,0xB24A,0xB473,0xB24A,0x9019,0x736B,0xB473,0x7242,0xF252,0xB473,0xF252,0x9019,0x5363,0xB473,0xB121,0x313A,0xB473,0x135B,0x9019,0xEA10,// row 11, 288 pixels
-  0xFB42,0x9019,0xB473,0x946B,0x9019,0xB24A,0xD473,0xD252,0x9019,0x946B,0xD473,0x313A,0xF25A,0x157C,0x5363,0x313A,0x936B,0xD473,0x1132,0x7242,0xD473,0x335B,0x9019,0xEA10,// row 12, 312 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xB121,0x157C,0x157C,0x157C,0x157C,0x157C,0xB252,0x9019,0x147C,0xF47B,0x9019,0x9019,0x9019,0xEA10,// row 13, 336 pixels
-  0xFB42,0x9019,0x335B,0x335B,0x335B,0x335B,0x335B,0x335B,0x335B,0xF129,0x9021,0x125B,0x7363,0x157C,0xB46B,0x135B,0x313A,0x9019,0x147C,0xF47B,0x335B,0xB24A,0x9019,0xEA10,// row 14, 360 pixels
-  0xFB42,0x9019,0x147C,0x157C,0x157C,0x157C,0x157C,0x157C,0x157C,0x313A,0x9019,0x9019,0xB24A,0x157C,0x335B,0x9019,0x9019,0x9019,0x147C,0x157C,0x157C,0x5363,0x9019,0xEA10,// row 15, 384 pixels
-  0xFB42,0x9019,0x147C,0xB473,0xD129,0xD129,0xD129,0x5363,0x157C,0x313A,0xD129,0xF47B,0xF47B,0x157C,0x335B,0x9019,0x736B,0xF47B,0x157C,0xF47B,0x1132,0xD129,0x9019,0xEA10,// row 16, 408 pixels
-  0xFB42,0x9019,0x147C,0xB473,0x9019,0x9019,0x9019,0x5363,0x157C,0x313A,0xD129,0x157C,0xF47B,0x736B,0x135B,0xB24A,0x7363,0x946B,0x946B,0x736B,0x9019,0x9019,0x9019,0xEA10,// row 17, 432 pixels
-  0xFB42,0x9019,0x147C,0xB473,0x9019,0x9019,0x9019,0x5363,0x157C,0x313A,0xD129,0x157C,0xB473,0x9019,0x135B,0x157C,0xB252,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 18, 456 pixels
-  0xFB42,0x9019,0x147C,0xF47B,0x736B,0x736B,0x736B,0xD473,0x157C,0x313A,0xD129,0x157C,0xB473,0x9019,0x135B,0x157C,0xB473,0x936B,0xF131,0x1132,0x936B,0xF25A,0x9019,0xEA10,// row 19, 480 pixels
-  0xFB42,0x9019,0xF47B,0xF47B,0xF47B,0xF47B,0xF47B,0xF47B,0xF47B,0x113A,0xD129,0xD473,0x736B,0x9019,0xF252,0xD473,0xD473,0xD473,0x1132,0x313A,0xF47B,0x5363,0x9019,0xEA10,// row 20, 504 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 21, 528 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 22, 552 pixels
-  0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,// row 23, 576 pixels
-};
-
-const uint16_t imgBin_qr_on[576] PROGMEM = {
-  0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xEA10,// row 0, 24 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 1, 48 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 2, 72 pixels
-  0xFB42,0x9019,0xFCDE,0x3DE7,0x3DE7,0x3DE7,0x3DE7,0x3DE7,0x3DE7,0x936B,0x5142,0x3DE7,0x5BCE,0x9019,0x78AD,0x1DE7,0x1DE7,0x1DE7,0x1DE7,0x1DE7,0x1DE7,0xB9B5,0x9019,0xEA10,// row 3, 96 pixels
-  0xFB42,0x9019,0xDFFF,0xDFFF,0x3DE7,0x3DE7,0x3DE7,0xBEF7,0xFFFF,0xF47B,0x7142,0x7EEF,0x9BD6,0x9019,0x1AC6,0xFFFF,0x7EEF,0x3DE7,0x3DE7,0x5DEF,0xFFFF,0x7BCE,0x9019,0xEA10,// row 4, 120 pixels
-  0xFB42,0x9019,0xDFFF,0x5DEF,0x9019,0x9019,0x9019,0x1AC6,0xFFFF,0xF47B,0x9019,0x9019,0x9019,0x9019,0x1AC6,0xFFFF,0x5584,0x9019,0x9019,0x335B,0xFFFF,0x7BCE,0x9019,0xEA10,// row 5, 144 pixels
-  0xFB42,0x9019,0xDFFF,0x5DEF,0x9019,0x9019,0x9019,0x1AC6,0xFFFF,0xF47B,0x313A,0x5BCE,0xB9B5,0x9019,0x1AC6,0xFFFF,0x5584,0x9019,0x9019,0x335B,0xFFFF,0x7BCE,0x9019,0xEA10,// row 6, 168 pixels
-  0xFB42,0x9019,0xDFFF,0x5DEF,0x9019,0x9019,0x9019,0x1AC6,0xFFFF,0xF47B,0x924A,0xFFFF,0x1DE7,0x9019,0x1AC6,0xFFFF,0x5584,0x9019,0x9019,0x335B,0xFFFF,0x7BCE,0x9019,0xEA10,// row 7, 192 pixels
-  0xFB42,0x9019,0xDFFF,0xFFFF,0xBFF7,0xBFF7,0xBFF7,0xDFFF,0xFFFF,0xF47B,0x924A,0xFFFF,0x1DE7,0x9019,0x1AC6,0xFFFF,0xDFFF,0xBFF7,0xBFF7,0xBFF7,0xFFFF,0x7BCE,0x9019,0xEA10,// row 8, 216 pixels
-  0xFB42,0x9019,0x7BCE,0x9BD6,0x9BD6,0x9BD6,0x9BD6,0x9BD6,0x9BD6,0x5363,0x924A,0xFFFF,0x1DE7,0x9019,0x179D,0x9BD6,0x9BD6,0x9BD6,0x9BD6,0x9BD6,0x9BD6,0x58AD,0x9019,0xEA10,// row 9, 240 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x924A,0xFFFF,0x1DE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 10, 264 pixels
-  0xFB42,0x9019,0xFCDE,0xBCD6,0x9019,0xD694,0x1DE7,0x179D,0x9019,0xBBD6,0x1DE7,0x5584,0x78AD,0x1DE7,0x78AD,0x9019,0x5ACE,0x3DE7,0x513A,0xB473,0x1DE7,0xB9B5,0x9019,0xEA10,// row 11, 288 pixels
-  0xFB42,0x9019,0x3DE7,0xFCDE,0x9019,0x179D,0x7EEF,0x37A5,0x9019,0xFCDE,0x5DEF,0xD473,0x98AD,0xFFFF,0x7BCE,0xD473,0xDCDE,0x7EEF,0x5363,0x758C,0x7EEF,0xF9BD,0x9019,0xEA10,// row 12, 312 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xF131,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0x179D,0x9019,0xDFFF,0x9EF7,0x9019,0x9019,0x9019,0xEA10,// row 13, 336 pixels
-  0xFB42,0x9019,0xF9BD,0x1ABE,0x1ABE,0x1ABE,0x1ABE,0x1ABE,0x1ABE,0xD252,0xB129,0xB9B5,0x9BCE,0xFFFF,0x1CDF,0xB9B5,0xB473,0x9019,0xDFFF,0xDFFF,0x1ABE,0xD69C,0x9019,0xEA10,// row 14, 360 pixels
-  0xFB42,0x9019,0xDFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0x946B,0x9019,0x9019,0xD694,0xFFFF,0x1ABE,0x9019,0x9019,0x9019,0xDFFF,0xFFFF,0xFFFF,0x7BCE,0x9019,0xEA10,// row 15, 384 pixels
-  0xFB42,0x9019,0xDFFF,0x3DE7,0x924A,0x924A,0x924A,0x7BCE,0xFFFF,0x946B,0x7242,0xBFF7,0xDFFF,0xFFFF,0x1ABE,0x9019,0xBBD6,0x9EF7,0xFFFF,0xBEF7,0x5363,0xB252,0x9019,0xEA10,// row 16, 408 pixels
-  0xFB42,0x9019,0xDFFF,0x3DE7,0x9019,0x9019,0x9019,0x3AC6,0xFFFF,0x946B,0x924A,0xFFFF,0xBFF7,0xBBD6,0xD9BD,0xD69C,0x9BCE,0xFCDE,0xFCDE,0x9BD6,0x9019,0x9019,0x9019,0xEA10,// row 17, 432 pixels
-  0xFB42,0x9019,0xDFFF,0x3DE7,0x9019,0x9019,0x9019,0x3AC6,0xFFFF,0x946B,0x924A,0xFFFF,0x1DE7,0x9019,0xF9BD,0xFFFF,0x179D,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 18, 456 pixels
-  0xFB42,0x9019,0xDFFF,0xBFF7,0xBBD6,0xBBD6,0xBBD6,0x7EEF,0xFFFF,0x946B,0x924A,0xFFFF,0x1DE7,0x9019,0xF9BD,0xFFFF,0x5DE7,0xDCDE,0x335B,0x7363,0xDCDE,0x98B5,0x9019,0xEA10,// row 19, 480 pixels
-  0xFB42,0x9019,0x9EF7,0xBEF7,0xBEF7,0xBEF7,0xBEF7,0xBEF7,0xBEF7,0x736B,0x7142,0x7EEF,0x9BD6,0x9019,0x78AD,0x7EEF,0x7EEF,0x7EEF,0x7363,0xD473,0xDFFF,0x5BCE,0x9019,0xEA10,// row 20, 504 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 21, 528 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 22, 552 pixels
-  0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,// row 23, 576 pixels
-};
-
-const uint16_t imgBin_rfid_off[576] PROGMEM = {
-  0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xEA10,// row 0, 24 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 1, 48 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 2, 72 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 3, 96 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 4, 120 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 5, 144 pixels
-  0xFB42,0x9019,0x9019,0x125B,0xD473,0xF47B,0xF47B,0xF47B,0xF47B,0xF47B,0xF47B,0xF47B,0xF47B,0xF47B,0xF47B,0xF47B,0xF47B,0xF47B,0xF47B,0xD473,0x736B,0xB121,0x9019,0xEA10,// row 6, 168 pixels
-  0xFB42,0x9019,0x9019,0x157C,0xF47B,0x125B,0xF252,0xF252,0xF252,0xF252,0xF252,0xF252,0xF252,0xF252,0xF252,0xF252,0xF252,0xF252,0xF252,0xB473,0x157C,0x7142,0x9019,0xEA10,// row 7, 192 pixels
-  0xFB42,0x9019,0x9019,0x157C,0x7363,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xF252,0x157C,0x7142,0x9019,0xEA10,// row 8, 216 pixels
-  0xFB42,0x9019,0x9019,0xB24A,0x5142,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xF252,0x157C,0x7142,0x9019,0xEA10,// row 9, 240 pixels
-  0xFB42,0x9019,0x9019,0xF131,0x1132,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xF252,0x157C,0x7142,0x9019,0xEA10,// row 10, 264 pixels
-  0xFB42,0x9019,0x9019,0xF47B,0x157C,0xF47B,0x736B,0x7242,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xF252,0x157C,0x7142,0x9019,0xEA10,// row 11, 288 pixels
-  0xFB42,0x9019,0x9019,0xF131,0x924A,0x135B,0xD473,0x157C,0x946B,0x1132,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xF252,0x157C,0x7142,0x9019,0xEA10,// row 12, 312 pixels
-  0xFB42,0x9019,0x9019,0xB252,0xD252,0xF131,0x9019,0xD252,0xF47B,0xF47B,0x313A,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xF252,0x157C,0x7142,0x9019,0xEA10,// row 13, 336 pixels
-  0xFB42,0x9019,0x9019,0xB473,0x157C,0x157C,0x5363,0xB121,0x313A,0xF47B,0xD473,0xD129,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xF252,0x157C,0x7142,0x9019,0xEA10,// row 14, 360 pixels
-  0xFB42,0x9019,0x9019,0x9019,0xD129,0x335B,0x157C,0xB473,0xB121,0xB24A,0x157C,0x335B,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xF252,0x157C,0x7142,0x9019,0xEA10,// row 15, 384 pixels
-  0xFB42,0x9019,0x9019,0xB473,0xF252,0x9019,0xF25A,0x157C,0xF25A,0x9019,0xD473,0xF47B,0x9019,0x9019,0x313A,0x5142,0x5142,0x5142,0x5142,0x7363,0x157C,0x7142,0x9019,0xEA10,// row 16, 408 pixels
-  0xFB42,0x9019,0x9019,0x157C,0x157C,0xB24A,0x9021,0xF47B,0x936B,0x9019,0x5363,0x157C,0xB121,0x1132,0x157C,0x157C,0x157C,0x157C,0x157C,0x157C,0xF47B,0xF131,0x9019,0xEA10,// row 17, 432 pixels
-  0xFB42,0x9019,0x9019,0x5142,0x5142,0xF131,0x9019,0xF131,0xD129,0x9019,0xB121,0x1132,0x9019,0x9019,0x313A,0x5142,0x5142,0x5142,0x5142,0x5142,0xB121,0x9019,0x9019,0xEA10,// row 18, 456 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 19, 480 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 20, 504 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 21, 528 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 22, 552 pixels
-  0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,// row 23, 576 pixels
-};
-
-const uint16_t imgBin_rfid_on[576] PROGMEM = {
-  0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xEA10,// row 0, 24 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 1, 48 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 2, 72 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 3, 96 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 4, 120 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 5, 144 pixels
-  0xFB42,0x9019,0x9019,0xB9B5,0x7EEF,0x9EF7,0x9EF7,0x9EF7,0x9EF7,0x9EF7,0x9EF7,0x9EF7,0x9EF7,0x9EF7,0x9EF7,0x9EF7,0x9EF7,0x9EF7,0x9EF7,0x9EF7,0x9BD6,0x1132,0x9019,0xEA10,// row 6, 168 pixels
-  0xFB42,0x9019,0x9019,0xFFFF,0xBFF7,0xB9B5,0x78AD,0x78AD,0x78AD,0x78AD,0x78AD,0x78AD,0x78AD,0x78AD,0x78AD,0x78AD,0x78AD,0x78AD,0x78AD,0x3DE7,0xFFFF,0x3584,0x9019,0xEA10,// row 7, 192 pixels
-  0xFB42,0x9019,0x9019,0xFFFF,0x9BD6,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x78AD,0xFFFF,0x3584,0x9019,0xEA10,// row 8, 216 pixels
-  0xFB42,0x9019,0x9019,0xF79C,0xF47B,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x78AD,0xFFFF,0x3584,0x9019,0xEA10,// row 9, 240 pixels
-  0xFB42,0x9019,0x9019,0x335B,0x3363,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x78AD,0xFFFF,0x3584,0x9019,0xEA10,// row 10, 264 pixels
-  0xFB42,0x9019,0x9019,0xBEF7,0xFFFF,0xBFF7,0x9BD6,0x758C,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x78AD,0xFFFF,0x3584,0x9019,0xEA10,// row 11, 288 pixels
-  0xFB42,0x9019,0x9019,0x335B,0x968C,0xF9BD,0x7EEF,0xFFFF,0xFCDE,0x3363,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x78AD,0xFFFF,0x3584,0x9019,0xEA10,// row 12, 312 pixels
-  0xFB42,0x9019,0x9019,0x179D,0x37A5,0xF252,0x9019,0x37A5,0xDFFF,0x9EF7,0xB473,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x78AD,0xFFFF,0x3584,0x9019,0xEA10,// row 13, 336 pixels
-  0xFB42,0x9019,0x9019,0x1DE7,0xFFFF,0xFFFF,0x5ACE,0x513A,0xB473,0xBFF7,0x7EEF,0x7242,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x78AD,0xFFFF,0x3584,0x9019,0xEA10,// row 14, 360 pixels
-  0xFB42,0x9019,0x9019,0x9019,0xB252,0xF9BD,0xFFFF,0x1DE7,0xF131,0xD694,0xFFFF,0x1ABE,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x78AD,0xFFFF,0x3584,0x9019,0xEA10,// row 15, 384 pixels
-  0xFB42,0x9019,0x9019,0x3DE7,0x78AD,0x9019,0x98B5,0xFFFF,0x98AD,0x9019,0x5EEF,0x9EF7,0x9019,0x9019,0xB473,0x1584,0x1584,0x1584,0x1584,0x9BCE,0xFFFF,0x3584,0x9019,0xEA10,// row 16, 408 pixels
-  0xFB42,0x9019,0x9019,0xFFFF,0xFFFF,0xF79C,0xD129,0xBEF7,0xDCDE,0x9019,0x3AC6,0xFFFF,0x313A,0x5363,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0xFFFF,0x9EF7,0xF252,0x9019,0xEA10,// row 17, 432 pixels
-  0xFB42,0x9019,0x9019,0x1584,0x1584,0x135B,0x9019,0xF252,0x7242,0x9019,0xF131,0x3363,0x9019,0x9019,0x946B,0x1584,0x1584,0x1584,0x1584,0x157C,0x1132,0x9019,0x9019,0xEA10,// row 18, 456 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 19, 480 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 20, 504 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 21, 528 pixels
-  0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 22, 552 pixels
-  0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,// row 23, 576 pixels
-};
-
-const uint16_t imgBin_battery[576] PROGMEM = {
-0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xFB42,0xEA10,// row 0, 24 pixels
-0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 1, 48 pixels
-0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 2, 72 pixels
-0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 3, 96 pixels
-0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 4, 120 pixels
-0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 5, 144 pixels
-0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 6, 168 pixels
-0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 7, 192 pixels
-0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 8, 216 pixels
-0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 9, 240 pixels
-0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 10, 264 pixels
-0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 11, 288 pixels
-0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 12, 312 pixels
-0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 13, 336 pixels
-0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 14, 360 pixels
-0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 15, 384 pixels
-0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 16, 408 pixels
-0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 17, 432 pixels
-0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 18, 456 pixels
-0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 19, 480 pixels
-0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 20, 504 pixels
-0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 21, 528 pixels
-0xFB42,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0x9019,0xEA10,// row 22, 552 pixels
-0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,0xEA10,// row 23, 576 pixels
-};
-
-const uint16_t imgBin_key[576] PROGMEM = {
-0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0x2312,// row 0, 24 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x4834,0x728D,0x99CE,0x99CE,0x728D,0x4834,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 1, 48 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x8A4C,0x99CE,0x1CE7,0x1CE7,0x99CE,0xCD64,0x8B4C,0x8A4C,0x4834,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 2, 72 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x8B4C,0xFBDE,0x1CE7,0x1CE7,0x1CE7,0xFBDE,0xFBDE,0x99CE,0x728D,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 3, 96 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x8B4C,0xFBDE,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x99CE,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 4, 120 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x8B4C,0xFBDE,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x99CE,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 5, 144 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x8B4C,0xFBDE,0x1CE7,0x1CE7,0x1CE7,0xFBDE,0xFBDE,0x99CE,0x728D,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 6, 168 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x8B4C,0xFBDE,0x1CE7,0x1CE7,0xFBDE,0xCD64,0x8B4C,0x8A4C,0x4834,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 7, 192 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x8B4C,0xFBDE,0x1CE7,0x1CE7,0xFBDE,0x8B4C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 8, 216 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x8B4C,0xFBDE,0x1CE7,0x1CE7,0xFBDE,0x8B4C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 9, 240 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2724,0xAC5C,0xFBDE,0x1CE7,0x1CE7,0xFBDE,0xAC54,0x4724,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 10, 264 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x482C,0xAC54,0xB4A5,0xFBDE,0x1CE7,0x1CE7,0xFBDE,0xB39D,0xAB54,0x482C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 11, 288 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x482C,0xEE6C,0x78C6,0xFBDE,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0xFBDE,0x78C6,0xCE64,0x482C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 12, 312 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0xAC5C,0x78C6,0x1BDF,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1BDF,0x78C6,0xAB54,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 13, 336 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0xB49D,0xFBDE,0x1CE7,0x1CE7,0x1BDF,0xFBDE,0xFBDE,0x1BDF,0x1CE7,0x1CE7,0xFBDE,0x939D,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 14, 360 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x78C6,0x1CE7,0x1CE7,0x1BDF,0x57BE,0x0F75,0x0F75,0x58BE,0x1BDF,0x1CE7,0x1CE7,0x78C6,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 15, 384 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0xDAD6,0x1CE7,0x1CE7,0xFBDE,0x0F75,0x4834,0x4834,0x0F75,0xFBDE,0x1CE7,0x1CE7,0xDAD6,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 16, 408 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0xDAD6,0x1CE7,0x1CE7,0xFBDE,0x0F75,0x4834,0x4834,0x0F75,0xFBDE,0x1CE7,0x1CE7,0xDAD6,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 17, 432 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x78C6,0x1CE7,0x1CE7,0x1BDF,0x57BE,0x0F75,0x0F75,0x57BE,0x1BDF,0x1CE7,0x1CE7,0x78C6,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 18, 456 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0xB49D,0xFBDE,0x1CE7,0x1CE7,0x1BDF,0xFBDE,0xFBDE,0x1BDF,0x1CE7,0x1CE7,0xFBDE,0xB49D,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 19, 480 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0xAC54,0x78C6,0x1BDF,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1BDF,0x78C6,0xAC54,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 20, 504 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x482C,0xEE74,0x78C6,0xFBDE,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0xFBDE,0x78C6,0xEE6C,0x472C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 21, 528 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x482C,0xAC54,0xB39D,0x78C6,0xDAD6,0xBAD6,0x78C6,0xB49D,0xAC54,0x472C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 22, 552 pixels
-0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,// row 23, 576 pixels
-};
-
-const uint16_t imgBin_setting[576] PROGMEM = { 
-0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0x2312,// row 0, 24 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 1, 48 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0xB4A5,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0xB4A5,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 2, 72 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x57BE,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x37BE,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 3, 96 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x99CE,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x99CE,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 4, 120 pixels
-0xF16E,0x271C,0x271C,0x4724,0x99C6,0x78C6,0x728D,0x8B54,0x16B6,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x16B6,0x8B54,0x728D,0x78C6,0x99C6,0x4724,0x271C,0x271C,0x2312,// row 5, 144 pixels
-0xF16E,0x271C,0x271C,0x9295,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x9295,0x271C,0x271C,0x2312,// row 6, 168 pixels
-0xF16E,0x271C,0x6944,0xDBDE,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0xFBDE,0x6944,0x271C,0x2312,// row 7, 192 pixels
-0xF16E,0x271C,0xF5AD,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0xDAD6,0x37B6,0x37B6,0xDAD6,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0xF5AD,0x271C,0x2312,// row 8, 216 pixels
-0xF16E,0x271C,0x7295,0x1BDF,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x37BE,0x4934,0x271C,0x271C,0x4934,0x37BE,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1BDF,0x7295,0x271C,0x2312,// row 9, 240 pixels
-0xF16E,0x271C,0x271C,0x0F75,0xDAD6,0x1CE7,0x1CE7,0x1CE7,0xDAD6,0x4934,0x271C,0x271C,0x271C,0x271C,0x4934,0xDAD6,0x1CE7,0x1CE7,0x1CE7,0xDAD6,0x0F75,0x271C,0x271C,0x2312,// row 10, 264 pixels
-0xF16E,0x271C,0x271C,0x271C,0xD4A5,0x1CE7,0x1CE7,0x1CE7,0x36B6,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x36B6,0x1CE7,0x1CE7,0x1CE7,0xD4A5,0x271C,0x271C,0x271C,0x2312,// row 11, 288 pixels
-0xF16E,0x271C,0x271C,0x271C,0xD4A5,0x1CE7,0x1CE7,0x1CE7,0x37B6,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x36B6,0x1CE7,0x1CE7,0x1CE7,0xD4A5,0x271C,0x271C,0x271C,0x2312,// row 12, 312 pixels
-0xF16E,0x271C,0x271C,0x0F75,0xDAD6,0x1CE7,0x1CE7,0x1CE7,0xDAD6,0x4934,0x271C,0x271C,0x271C,0x271C,0x4934,0xDAD6,0x1CE7,0x1CE7,0x1CE7,0xDAD6,0x0F75,0x271C,0x271C,0x2312,// row 13, 336 pixels
-0xF16E,0x271C,0x7295,0x1BDF,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x37BE,0x4934,0x271C,0x271C,0x4934,0x37BE,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1BDF,0x7295,0x271C,0x2312,// row 14, 360 pixels
-0xF16E,0x271C,0xF5AD,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0xDAD6,0x36B6,0x36B6,0xDAD6,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0xF5AD,0x271C,0x2312,// row 15, 384 pixels
-0xF16E,0x271C,0x6944,0xDBDE,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0xFBDE,0x6944,0x271C,0x2312,// row 16, 408 pixels
-0xF16E,0x271C,0x271C,0x9295,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x9295,0x271C,0x271C,0x2312,// row 17, 432 pixels
-0xF16E,0x271C,0x271C,0x4724,0x99C6,0x78C6,0x728D,0x8B54,0x16B6,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x16B6,0x8B54,0x728D,0x78C6,0x99C6,0x4724,0x271C,0x271C,0x2312,// row 18, 456 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x99CE,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x99CE,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 19, 480 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x57BE,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x37BE,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 20, 504 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0xB4A5,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0xB49D,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 21, 528 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 22, 552 pixels
-0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,// row 23, 576 pixels
-};
-
-const uint16_t imgBin_barcode[576] PROGMEM = {
-0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0x2312,// row 0, 24 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 1, 48 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 2, 72 pixels
-0xF16E,0x271C,0x271C,0x271C,0x471C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 3, 96 pixels
-0xF16E,0x271C,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0xFFFF,0xFFFF,0x271C,0x271C,0x271C,0x2312,// row 4, 120 pixels
-0xF16E,0x271C,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0xFFFF,0xFFFF,0x271C,0x271C,0x271C,0x2312,// row 5, 144 pixels
-0xF16E,0x271C,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0xFFFF,0xFFFF,0x271C,0x271C,0x271C,0x2312,// row 6, 168 pixels
-0xF16E,0x271C,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0xFFFF,0xFFFF,0x271C,0x271C,0x271C,0x2312,// row 7, 192 pixels
-0xF16E,0x271C,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0xFFFF,0xFFFF,0x271C,0x271C,0x271C,0x2312,// row 8, 216 pixels
-0xF16E,0x271C,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0xFFFF,0xFFFF,0x271C,0x271C,0x271C,0x2312,// row 9, 240 pixels
-0xF16E,0x271C,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0xFFFF,0xFFFF,0x271C,0x271C,0x271C,0x2312,// row 10, 264 pixels
-0xF16E,0x271C,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0xFFFF,0xFFFF,0x271C,0x271C,0x271C,0x2312,// row 11, 288 pixels
-0xF16E,0x271C,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0xFFFF,0xFFFF,0x271C,0x271C,0x271C,0x2312,// row 12, 312 pixels
-0xF16E,0x271C,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0xFFFF,0xFFFF,0x271C,0x271C,0x271C,0x2312,// row 13, 336 pixels
-0xF16E,0x271C,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0xFFFF,0xFFFF,0x271C,0x271C,0x271C,0x2312,// row 14, 360 pixels
-0xF16E,0x271C,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0xFFFF,0xFFFF,0x271C,0x271C,0x271C,0x2312,// row 15, 384 pixels
-0xF16E,0x271C,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0xFFFF,0xFFFF,0x271C,0x271C,0x271C,0x2312,// row 16, 408 pixels
-0xF16E,0x271C,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0xFFFF,0xFFFF,0x271C,0x271C,0x271C,0x2312,// row 17, 432 pixels
-0xF16E,0x271C,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0xFFFF,0xFFFF,0x271C,0x271C,0x271C,0x2312,// row 18, 456 pixels
-0xF16E,0x271C,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0x271C,0x271C,0xFFFF,0xFFFF,0x271C,0xFFFF,0x271C,0xFFFF,0xFFFF,0x271C,0x271C,0x271C,0x2312,// row 19, 480 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 20, 504 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 21, 528 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 22, 552 pixels
-0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,// row 23, 576 pixels
-};
-
-const uint16_t imgBin_power[576] PROGMEM = {
-0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0x2312,// row 0, 24 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 1, 48 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 2, 72 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x99CE,0x99CE,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 3, 96 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x1CE7,0x1CE7,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 4, 120 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0xEE6C,0x5185,0x271C,0x271C,0x271C,0x271C,0x1CE7,0x1CE7,0x271C,0x271C,0x271C,0x271C,0x5185,0xEE6C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 5, 144 pixels
-0xF16E,0x271C,0x271C,0x271C,0xAD5C,0xFBDE,0x1CE7,0x8B54,0x271C,0x271C,0x271C,0x1CE7,0x1CE7,0x271C,0x271C,0x271C,0x8B4C,0x1CE7,0xFBDE,0xAC5C,0x271C,0x271C,0x271C,0x2312,// row 6, 168 pixels
-0xF16E,0x271C,0x271C,0x271C,0x99CE,0x1CE7,0x57BE,0x271C,0x271C,0x271C,0x271C,0x1CE7,0x1CE7,0x271C,0x271C,0x271C,0x271C,0x57BE,0x1CE7,0x99CE,0x271C,0x271C,0x271C,0x2312,// row 7, 192 pixels
-0xF16E,0x271C,0x271C,0x307D,0x1CE7,0xFBDE,0x6A44,0x271C,0x271C,0x271C,0x271C,0x1CE7,0x1CE7,0x271C,0x271C,0x271C,0x271C,0x6A44,0xFBDE,0x1CE7,0x307D,0x271C,0x271C,0x2312,// row 8, 216 pixels
-0xF16E,0x271C,0x271C,0x37B6,0x1CE7,0xD4A5,0x271C,0x271C,0x271C,0x271C,0x271C,0x1CE7,0x1CE7,0x271C,0x271C,0x271C,0x271C,0x271C,0xD4A5,0x1CE7,0x36B6,0x271C,0x271C,0x2312,// row 9, 240 pixels
-0xF16E,0x271C,0x271C,0xBAD6,0x1CE7,0xEE6C,0x271C,0x271C,0x271C,0x271C,0x271C,0x1CE7,0x1CE7,0x271C,0x271C,0x271C,0x271C,0x271C,0xEE6C,0x1CE7,0xBAD6,0x271C,0x271C,0x2312,// row 10, 264 pixels
-0xF16E,0x271C,0x271C,0x1BDF,0x1CE7,0x6944,0x271C,0x271C,0x271C,0x271C,0x271C,0x1CE7,0x1CE7,0x271C,0x271C,0x271C,0x271C,0x271C,0x693C,0x1CE7,0xFBDE,0x271C,0x271C,0x2312,// row 11, 288 pixels
-0xF16E,0x271C,0x271C,0xFBDE,0x1CE7,0x6A44,0x271C,0x271C,0x271C,0x271C,0x271C,0x99CE,0x99CE,0x271C,0x271C,0x271C,0x271C,0x271C,0x6A44,0x1CE7,0xFBDE,0x271C,0x271C,0x2312,// row 12, 312 pixels
-0xF16E,0x271C,0x271C,0xDAD6,0x1CE7,0xEE6C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x0F75,0x1CE7,0xBAD6,0x271C,0x271C,0x2312,// row 13, 336 pixels
-0xF16E,0x271C,0x271C,0x36B6,0x1CE7,0xD5A5,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0xF5AD,0x1CE7,0x36B6,0x271C,0x271C,0x2312,// row 14, 360 pixels
-0xF16E,0x271C,0x271C,0x107D,0x1CE7,0xFBDE,0x6944,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x8B4C,0xFBDE,0x1CE7,0x307D,0x271C,0x271C,0x2312,// row 15, 384 pixels
-0xF16E,0x271C,0x271C,0x271C,0x78C6,0x1CE7,0x58BE,0x4724,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x4834,0x78C6,0x1CE7,0x78C6,0x271C,0x271C,0x271C,0x2312,// row 16, 408 pixels
-0xF16E,0x271C,0x271C,0x271C,0xAC5C,0xFBDE,0x1CE7,0x57BE,0x6944,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x8B4C,0x78C6,0x1CE7,0xFBDE,0xCD64,0x271C,0x271C,0x271C,0x2312,// row 17, 432 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0xEF74,0xFBDE,0x1CE7,0xFBDE,0xF5A5,0xEE74,0x6A44,0x6A44,0x0F75,0xF5AD,0xFBDE,0x1CE7,0xFBDE,0x0F75,0x271C,0x271C,0x271C,0x271C,0x2312,// row 18, 456 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0xAC5C,0x78C6,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x99C6,0xAC5C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 19, 480 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x0F7D,0x36B6,0xBACE,0xFBDE,0xFBDE,0xBAD6,0x16B6,0x307D,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 20, 504 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 21, 528 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 22, 552 pixels
-0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,// row 23, 576 pixels
-};
-
-const uint16_t imgBin_clock[576] PROGMEM = {
-0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0xF16E,0x2312,// row 0, 24 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 1, 48 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x107D,0x78C6,0x0F75,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x0F75,0x78C6,0x107D,0x271C,0x271C,0x271C,0x271C,0x2312,// row 2, 72 pixels
-0xF16E,0x271C,0x271C,0x271C,0x9395,0x1CE7,0x1CE7,0xB49D,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0xB49D,0x1CE7,0x1CE7,0x9395,0x271C,0x271C,0x271C,0x2312,// row 3, 96 pixels
-0xF16E,0x271C,0x482C,0x16AE,0x1CE7,0x1CE7,0x16AE,0x482C,0x307D,0x36B6,0xBAD6,0xFBDE,0xFBDE,0xDAD6,0x36B6,0x307D,0x482C,0x16AE,0x1CE7,0x1CE7,0x16AE,0x482C,0x271C,0x2312,// row 4, 120 pixels
-0xF16E,0x271C,0xB49D,0x1CE7,0x1CE7,0x9395,0xCD64,0x99CE,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x99CE,0xCD64,0x9395,0x1CE7,0x1CE7,0xB39D,0x271C,0x2312,// row 5, 144 pixels
-0xF16E,0x271C,0x0F75,0x78C6,0x107D,0x107D,0xFBDE,0x1CE7,0xFBDE,0xD5A5,0xEE6C,0x693C,0x693C,0xEE6C,0xD5A5,0xFBDE,0x1CE7,0xFBDE,0x107D,0x107D,0x78C6,0x0F75,0x271C,0x2312,// row 6, 168 pixels
-0xF16E,0x271C,0x271C,0x271C,0xCD64,0xFBDE,0x1CE7,0x58BE,0x6A44,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x6944,0x58BE,0x1CE7,0xFBDE,0xCD64,0x271C,0x271C,0x271C,0x2312,// row 7, 192 pixels
-0xF16E,0x271C,0x271C,0x271C,0x99CE,0x1CE7,0x58BE,0x4724,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x472C,0x58BE,0x1CE7,0x99C6,0x271C,0x271C,0x271C,0x2312,// row 8, 216 pixels
-0xF16E,0x271C,0x271C,0x307D,0x1CE7,0xFBDE,0x6A44,0x271C,0x271C,0x271C,0x271C,0x99CE,0x99CE,0x271C,0x271C,0x271C,0x271C,0x6A44,0xFBDE,0x1CE7,0x307D,0x271C,0x271C,0x2312,// row 9, 240 pixels
-0xF16E,0x271C,0x271C,0x36B6,0x1CE7,0xD5A5,0x271C,0x271C,0x271C,0x271C,0x271C,0x1CE7,0x1CE7,0x271C,0x271C,0x271C,0x271C,0x271C,0xF5A5,0x1CE7,0x37B6,0x271C,0x271C,0x2312,// row 10, 264 pixels
-0xF16E,0x271C,0x271C,0xBAD6,0x1CE7,0xEE6C,0x271C,0x271C,0x271C,0x271C,0x271C,0x1CE7,0x1CE7,0x271C,0x271C,0x271C,0x271C,0x271C,0xEE6C,0x1CE7,0xDAD6,0x271C,0x271C,0x2312,// row 11, 288 pixels
-0xF16E,0x271C,0x271C,0xFBDE,0x1CE7,0x6A44,0x271C,0x271C,0x99CE,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x99CE,0x271C,0x271C,0x6A44,0x1CE7,0xFBDE,0x271C,0x271C,0x2312,// row 12, 312 pixels
-0xF16E,0x271C,0x271C,0xFBDE,0x1CE7,0x6A44,0x271C,0x271C,0x99CE,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x99CE,0x271C,0x271C,0x6944,0x1CE7,0xFBDE,0x271C,0x271C,0x2312,// row 13, 336 pixels
-0xF16E,0x271C,0x271C,0xBAD6,0x1CE7,0xEE6C,0x271C,0x271C,0x271C,0x271C,0x271C,0x1CE7,0x1CE7,0x271C,0x271C,0x271C,0x271C,0x271C,0xEE6C,0x1CE7,0xBAD6,0x271C,0x271C,0x2312,// row 14, 360 pixels
-0xF16E,0x271C,0x271C,0x36B6,0x1CE7,0xD5A5,0x271C,0x271C,0x271C,0x271C,0x271C,0x1CE7,0x1CE7,0x271C,0x271C,0x271C,0x271C,0x271C,0xF5AD,0x1CE7,0x37B6,0x271C,0x271C,0x2312,// row 15, 384 pixels
-0xF16E,0x271C,0x271C,0x307D,0x1CE7,0xFBDE,0x6944,0x271C,0x271C,0x271C,0x271C,0x99CE,0x99CE,0x271C,0x271C,0x271C,0x271C,0x6A44,0xFBDE,0x1CE7,0x307D,0x271C,0x271C,0x2312,// row 16, 408 pixels
-0xF16E,0x271C,0x271C,0x271C,0x99CE,0x1CE7,0x58BE,0x472C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x472C,0x58C6,0x1CE7,0x78C6,0x271C,0x271C,0x271C,0x2312,// row 17, 432 pixels
-0xF16E,0x271C,0x271C,0x271C,0xCD64,0xFBDE,0x1CE7,0x58BE,0x6A44,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x6A44,0x58BE,0x1CE7,0xFBDE,0xCD64,0x271C,0x271C,0x271C,0x2312,// row 18, 456 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x107D,0xFBDE,0x1CE7,0xFBDE,0xF5A5,0xEE6C,0x6944,0x6A44,0xEE6C,0xF5A5,0xFBDE,0x1CE7,0xFBDE,0x107D,0x271C,0x271C,0x271C,0x271C,0x2312,// row 19, 480 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0xCD64,0x99C6,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x1CE7,0x78C6,0xCD64,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 20, 504 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x307D,0x37B6,0xBAD6,0xFBDE,0xFBDE,0xBAD6,0x37B6,0x307D,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 21, 528 pixels
-0xF16E,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x271C,0x2312,// row 22, 552 pixels
-0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,0x2312,// row 23, 576 pixels
-};
-
-const unsigned short imgBin_putnfc1[6848] PROGMEM = {
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,// row 0, 107 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,// row 1, 214 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,// row 2, 321 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,// row 3, 428 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,// row 4, 535 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,// row 5, 642 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 6, 749 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 7, 856 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 8, 963 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 9, 1070 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 10, 1177 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E1F,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 11, 1284 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E1F,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E1F,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 12, 1391 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E1F,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 13, 1498 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 14, 1605 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 15, 1712 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xBE1F,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 16, 1819 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 17, 1926 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 18, 2033 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E1F,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 19, 2140 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 20, 2247 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E1F,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 21, 2354 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 22, 2461 pixels
-  0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E1F,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 23, 2568 pixels
-  0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 24, 2675 pixels
-  0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 25, 2782 pixels
-  0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E1F,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 26, 2889 pixels
-  0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 27, 2996 pixels
-  0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 28, 3103 pixels
-  0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 29, 3210 pixels
-  0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 30, 3317 pixels
-  0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 31, 3424 pixels
-  0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 32, 3531 pixels
-  0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 33, 3638 pixels
-  0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 34, 3745 pixels
-  0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 35, 3852 pixels
-  0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 36, 3959 pixels
-  0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 37, 4066 pixels
-  0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 38, 4173 pixels
-  0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E1F,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 39, 4280 pixels
-  0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E1F,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 40, 4387 pixels
-  0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E1F,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 41, 4494 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 42, 4601 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 43, 4708 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0xBE1F,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 44, 4815 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 45, 4922 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 46, 5029 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 47, 5136 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 48, 5243 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 49, 5350 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 50, 5457 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E1F,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 51, 5564 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 52, 5671 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 53, 5778 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 54, 5885 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E1F,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 55, 5992 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 56, 6099 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,// row 57, 6206 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,// row 58, 6313 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,// row 59, 6420 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xBE1F,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x9E17,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,// row 60, 6527 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,// row 61, 6634 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,// row 62, 6741 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,// row 63, 6848 pixels
-};
-
-const unsigned short imgBin_putnfc0[6848] PROGMEM = {
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,// row 0, 107 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,// row 1, 214 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,// row 2, 321 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,// row 3, 428 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,// row 4, 535 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,// row 5, 642 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 6, 749 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 7, 856 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 8, 963 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 9, 1070 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 10, 1177 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 11, 1284 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 12, 1391 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 13, 1498 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 14, 1605 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 15, 1712 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 16, 1819 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 17, 1926 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 18, 2033 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 19, 2140 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 20, 2247 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 21, 2354 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 22, 2461 pixels
-  0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 23, 2568 pixels
-  0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 24, 2675 pixels
-  0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 25, 2782 pixels
-  0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 26, 2889 pixels
-  0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 27, 2996 pixels
-  0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 28, 3103 pixels
-  0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 29, 3210 pixels
-  0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 30, 3317 pixels
-  0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 31, 3424 pixels
-  0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 32, 3531 pixels
-  0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 33, 3638 pixels
-  0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 34, 3745 pixels
-  0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 35, 3852 pixels
-  0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 36, 3959 pixels
-  0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 37, 4066 pixels
-  0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 38, 4173 pixels
-  0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 39, 4280 pixels
-  0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 40, 4387 pixels
-  0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 41, 4494 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 42, 4601 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 43, 4708 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 44, 4815 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 45, 4922 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 46, 5029 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 47, 5136 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 48, 5243 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 49, 5350 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 50, 5457 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 51, 5564 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 52, 5671 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 53, 5778 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 54, 5885 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 55, 5992 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 56, 6099 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,// row 57, 6206 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,// row 58, 6313 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,// row 59, 6420 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0xCB5A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,// row 60, 6527 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,// row 61, 6634 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,// row 62, 6741 pixels
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,// row 63, 6848 pixels
-};
-
+// 画像データは tools/icon_rle.py でパレット＋ランレングス圧縮したもの（元データは tools/icon_src.h）
+//   画像を追加するときは tools/icon_src.h に配列を追加して、icon_rle.h を作り直す
+#include "icon_rle.h"
 
 const DinMeterUI::ImageInfo imgInfo[] PROGMEM = {
-  {imgBin_ble_off, 24, 24, 576, 0, 0, 0x0020},
-  {imgBin_ble_on, 24, 24, 576, 0, 0, 0x0020},
-  {imgBin_lock_off, 24, 24, 576, 0, 0, 0x0020},
-  {imgBin_unlock_on, 24, 24, 576, 0, 0, 0x0020},
-  {imgBin_qr_off, 24, 24, 576, 0, 0, 0x0020},
-  {imgBin_qr_on, 24, 24, 576, 0, 0, 0x0020},
-  {imgBin_rfid_off, 24, 24, 576, 0, 0, 0x0020},
-  {imgBin_rfid_on, 24, 24, 576, 0, 0, 0x0020},
-  {imgBin_battery, 24, 24, 576, 0, 0, 0x0020},
-  {imgBin_key, 24, 24, 576, 0, 0, 0x0020},
-  {imgBin_setting, 24, 24, 576, 0, 0, 0x0020},
-  {imgBin_barcode, 24, 24, 576, 0, 0, 0x0020},
-  {imgBin_power, 24, 24, 576, 0, 0, 0x0020},
-  {imgBin_clock, 24, 24, 576, 0, 0, 0x0020},
-  {imgBin_putnfc1, 107, 64, 6848, 0, 0, 0x0020},
-  {imgBin_putnfc0, 107, 64, 6848, 0, 0, 0x0020},
+  {nullptr, 24, 24, 576, 0, 0, 0x0020, imgRle_ble_off, imgPal_ble_off},
+  {nullptr, 24, 24, 576, 0, 0, 0x0020, imgRle_ble_on, imgPal_ble_on},
+  {nullptr, 24, 24, 576, 0, 0, 0x0020, imgRle_lock_off, imgPal_lock_off},
+  {nullptr, 24, 24, 576, 0, 0, 0x0020, imgRle_unlock_on, imgPal_unlock_on},
+  {nullptr, 24, 24, 576, 0, 0, 0x0020, imgRle_qr_off, imgPal_qr_off},
+  {nullptr, 24, 24, 576, 0, 0, 0x0020, imgRle_qr_on, imgPal_qr_on},
+  {nullptr, 24, 24, 576, 0, 0, 0x0020, imgRle_rfid_off, imgPal_rfid_off},
+  {nullptr, 24, 24, 576, 0, 0, 0x0020, imgRle_rfid_on, imgPal_rfid_on},
+  {nullptr, 24, 24, 576, 0, 0, 0x0020, imgRle_battery, imgPal_battery},
+  {nullptr, 24, 24, 576, 0, 0, 0x0020, imgRle_key, imgPal_key},
+  {nullptr, 24, 24, 576, 0, 0, 0x0020, imgRle_setting, imgPal_setting},
+  {nullptr, 24, 24, 576, 0, 0, 0x0020, imgRle_barcode, imgPal_barcode},
+  {nullptr, 24, 24, 576, 0, 0, 0x0020, imgRle_power, imgPal_power},
+  {nullptr, 24, 24, 576, 0, 0, 0x0020, imgRle_clock, imgPal_clock},
+  {nullptr, 107, 64, 6848, 0, 0, 0x0020, imgRle_putnfc1, imgPal_putnfc1},
+  {nullptr, 107, 64, 6848, 0, 0, 0x0020, imgRle_putnfc0, imgPal_putnfc0},
 };
 
@@ -0,0 +1,457 @@
+/*
+  icon_rle.h
+  アイコン画像データ（パレット＋ランレングス圧縮）
+  tools/icon_rle.py で生成したファイルなので、直接編集しないこと
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#pragma once
+
+// ble_off  24x24, 16 colors, 1152 -> 384 bytes
+const uint16_t imgPal_ble_off[16] PROGMEM = {
+  0x9019,0xB373,0xEA10,0xFB42,0x736B,0xD129,0x924A,0xD252,0xF252,0x7363,0x936B,0x1132,0xB24A,0x313A,0xB129,0xF129,
+};
+const uint8_t imgRle_ble_off[352] PROGMEM = {
+  0x96,0x03,0x00,0x02,0x00,0x03,0x95,0x00,0x00,0x02,0x00,0x03,0x89,0x00,0x01,0x06,0x06,0x89,0x00,0x00,0x02,0x00,0x03,0x89,
+  0x00,0x02,0x0A,0x01,0x07,0x88,0x00,0x00,0x02,0x00,0x03,0x89,0x00,0x82,0x01,0x00,0x08,0x87,0x00,0x00,0x02,0x00,0x03,0x83,
+  0x00,0x02,0x0B,0x08,0x05,0x82,0x00,0x83,0x01,0x00,0x07,0x86,0x00,0x00,0x02,0x00,0x03,0x83,0x00,0x0B,0x08,0x01,0x04,0x05,
+  0x00,0x00,0x01,0x01,0x06,0x01,0x01,0x07,0x85,0x00,0x00,0x02,0x00,0x03,0x83,0x00,0x0C,0x05,0x04,0x01,0x04,0x05,0x00,0x01,
+  0x01,0x00,0x0C,0x01,0x01,0x0D,0x84,0x00,0x00,0x02,0x00,0x03,0x84,0x00,0x0B,0x05,0x04,0x01,0x04,0x05,0x01,0x01,0x05,0x04,
+  0x01,0x04,0x0E,0x84,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x09,0x05,0x04,0x01,0x04,0x01,0x01,0x04,0x01,0x04,0x05,0x85,0x00,
+  0x00,0x02,0x00,0x03,0x86,0x00,0x01,0x05,0x09,0x83,0x01,0x01,0x04,0x0F,0x86,0x00,0x00,0x02,0x00,0x03,0x87,0x00,0x05,0x05,
+  0x09,0x01,0x01,0x04,0x05,0x87,0x00,0x00,0x02,0x00,0x03,0x87,0x00,0x05,0x05,0x09,0x01,0x01,0x04,0x05,0x87,0x00,0x00,0x02,
+  0x00,0x03,0x86,0x00,0x01,0x05,0x09,0x83,0x01,0x01,0x04,0x05,0x86,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x09,0x05,0x04,0x01,
+  0x04,0x01,0x01,0x04,0x01,0x04,0x05,0x85,0x00,0x00,0x02,0x00,0x03,0x84,0x00,0x0B,0x05,0x04,0x01,0x04,0x05,0x01,0x01,0x05,
+  0x04,0x01,0x04,0x0E,0x84,0x00,0x00,0x02,0x00,0x03,0x83,0x00,0x0C,0x05,0x04,0x01,0x04,0x05,0x00,0x01,0x01,0x00,0x0C,0x01,
+  0x01,0x0D,0x84,0x00,0x00,0x02,0x00,0x03,0x83,0x00,0x0B,0x08,0x01,0x04,0x05,0x00,0x00,0x01,0x01,0x06,0x01,0x01,0x07,0x85,
+  0x00,0x00,0x02,0x00,0x03,0x83,0x00,0x02,0x0B,0x08,0x05,0x82,0x00,0x83,0x01,0x00,0x07,0x86,0x00,0x00,0x02,0x00,0x03,0x89,
+  0x00,0x82,0x01,0x00,0x08,0x87,0x00,0x00,0x02,0x00,0x03,0x89,0x00,0x02,0x0A,0x01,0x07,0x88,0x00,0x00,0x02,0x00,0x03,0x89,
+  0x00,0x01,0x06,0x06,0x89,0x00,0x00,0x02,0x00,0x03,0x95,0x00,0x00,0x02,0x97,0x02,
+};
+
+// ble_on  24x24, 19 colors, 1152 -> 390 bytes
+const uint16_t imgPal_ble_on[19] PROGMEM = {
+  0x9019,0x1CE7,0xEA10,0xFB42,0x9AD6,0xB24A,0x77AD,0x57A5,0xD252,0x9BD6,0xB694,0xFCDE,0x5363,0x958C,0xF69C,0xB473,
+  0x5142,0x57AD,0x9594,
+};
+const uint8_t imgRle_ble_on[352] PROGMEM = {
+  0x96,0x03,0x00,0x02,0x00,0x03,0x95,0x00,0x00,0x02,0x00,0x03,0x89,0x00,0x01,0x0A,0x0A,0x89,0x00,0x00,0x02,0x00,0x03,0x89,
+  0x00,0x02,0x0B,0x01,0x07,0x88,0x00,0x00,0x02,0x00,0x03,0x89,0x00,0x82,0x01,0x00,0x06,0x87,0x00,0x00,0x02,0x00,0x03,0x83,
+  0x00,0x02,0x0C,0x06,0x05,0x82,0x00,0x83,0x01,0x00,0x07,0x86,0x00,0x00,0x02,0x00,0x03,0x83,0x00,0x0B,0x06,0x01,0x04,0x05,
+  0x00,0x00,0x01,0x01,0x0D,0x01,0x01,0x07,0x85,0x00,0x00,0x02,0x00,0x03,0x83,0x00,0x0C,0x05,0x04,0x01,0x04,0x05,0x00,0x01,
+  0x01,0x00,0x0E,0x01,0x01,0x0F,0x84,0x00,0x00,0x02,0x00,0x03,0x84,0x00,0x0B,0x05,0x04,0x01,0x04,0x05,0x01,0x01,0x05,0x04,
+  0x01,0x04,0x10,0x84,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x09,0x05,0x04,0x01,0x04,0x01,0x01,0x04,0x01,0x04,0x08,0x85,0x00,
+  0x00,0x02,0x00,0x03,0x86,0x00,0x01,0x05,0x04,0x83,0x01,0x01,0x09,0x08,0x86,0x00,0x00,0x02,0x00,0x03,0x87,0x00,0x05,0x05,
+  0x04,0x01,0x01,0x09,0x08,0x87,0x00,0x00,0x02,0x00,0x03,0x87,0x00,0x05,0x05,0x04,0x01,0x01,0x09,0x08,0x87,0x00,0x00,0x02,
+  0x00,0x03,0x86,0x00,0x01,0x05,0x04,0x83,0x01,0x01,0x09,0x08,0x86,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x09,0x05,0x04,0x01,
+  0x04,0x01,0x01,0x04,0x01,0x04,0x05,0x85,0x00,0x00,0x02,0x00,0x03,0x84,0x00,0x0B,0x05,0x04,0x01,0x04,0x05,0x01,0x01,0x05,
+  0x04,0x01,0x04,0x10,0x84,0x00,0x00,0x02,0x00,0x03,0x83,0x00,0x0C,0x05,0x04,0x01,0x04,0x05,0x00,0x01,0x01,0x00,0x0E,0x01,
+  0x01,0x0F,0x84,0x00,0x00,0x02,0x00,0x03,0x83,0x00,0x0B,0x06,0x01,0x04,0x05,0x00,0x00,0x01,0x01,0x0D,0x01,0x01,0x07,0x85,
+  0x00,0x00,0x02,0x00,0x03,0x83,0x00,0x02,0x0C,0x06,0x05,0x82,0x00,0x83,0x01,0x00,0x07,0x86,0x00,0x00,0x02,0x00,0x03,0x89,
+  0x00,0x82,0x01,0x00,0x06,0x87,0x00,0x00,0x02,0x00,0x03,0x89,0x00,0x02,0x0B,0x01,0x11,0x88,0x00,0x00,0x02,0x00,0x03,0x89,
+  0x00,0x01,0x12,0x0A,0x89,0x00,0x00,0x02,0x00,0x03,0x95,0x00,0x00,0x02,0x97,0x02,
+};
+
+// lock_off  24x24, 15 colors, 1152 -> 346 bytes
+const uint16_t imgPal_lock_off[15] PROGMEM = {
+  0x9019,0xB373,0xEA10,0xFB42,0x936B,0x7142,0xF131,0x5363,0xD252,0x736B,0x3363,0xF252,0xF129,0xD129,0xB36B,
+};
+const uint8_t imgRle_lock_off[316] PROGMEM = {
+  0x96,0x03,0x00,0x02,0x00,0x03,0x87,0x00,0x05,0x05,0x07,0x04,0x04,0x07,0x05,0x87,0x00,0x00,0x02,0x00,0x03,0x86,0x00,0x00,
+  0x0B,0x85,0x01,0x00,0x0B,0x86,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x09,0x05,0x01,0x04,0x08,0x0C,0x0C,0x08,0x0E,0x01,0x05,
+  0x85,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x02,0x07,0x01,0x08,0x83,0x00,0x02,0x08,0x01,0x07,0x85,0x00,0x00,0x02,0x00,0x03,
+  0x85,0x00,0x02,0x04,0x01,0x0D,0x83,0x00,0x02,0x0D,0x01,0x04,0x85,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x01,0x01,0x01,0x85,
+  0x00,0x01,0x01,0x01,0x85,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x01,0x01,0x01,0x85,0x00,0x01,0x01,0x01,0x85,0x00,0x00,0x02,
+  0x00,0x03,0x82,0x00,0x01,0x05,0x04,0x8B,0x01,0x01,0x04,0x05,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x00,0x04,0x8D,0x01,
+  0x00,0x09,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x8F,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x8F,0x01,0x82,0x00,
+  0x00,0x02,0x00,0x03,0x82,0x00,0x8F,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x85,0x01,0x03,0x0A,0x06,0x06,0x0A,0x85,
+  0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x85,0x01,0x03,0x06,0x00,0x00,0x06,0x85,0x01,0x82,0x00,0x00,0x02,0x00,0x03,
+  0x82,0x00,0x85,0x01,0x03,0x06,0x00,0x00,0x06,0x85,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x85,0x01,0x03,0x0A,0x06,
+  0x06,0x0A,0x85,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x8F,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x8F,0x01,
+  0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x8F,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x00,0x04,0x8D,0x01,0x00,0x09,
+  0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x01,0x05,0x09,0x8B,0x01,0x01,0x09,0x05,0x82,0x00,0x00,0x02,0x00,0x03,0x95,0x00,
+  0x00,0x02,0x97,0x02,
+};
+
+// unlock_on  24x24, 23 colors, 1152 -> 416 bytes
+const uint16_t imgPal_unlock_on[23] PROGMEM = {
+  0x9019,0x1CE7,0xEA10,0xFB42,0xBBD6,0x3584,0x5584,0x39C6,0x37A5,0xF47B,0xFBDE,0xD252,0x147C,0xDBDE,0x5AC6,0x77AD,
+  0x3484,0x16A5,0xB24A,0x17A5,0xF9BD,0x7142,0xD473,
+};
+const uint8_t imgRle_unlock_on[370] PROGMEM = {
+  0x96,0x03,0x00,0x02,0x00,0x03,0x87,0x00,0x05,0x0C,0x07,0x0D,0x0A,0x0E,0x06,0x87,0x00,0x00,0x02,0x00,0x03,0x86,0x00,0x00,
+  0x08,0x85,0x01,0x00,0x0F,0x86,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x09,0x10,0x01,0x01,0x11,0x12,0x0B,0x13,0x01,0x01,0x06,
+  0x85,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x02,0x07,0x01,0x08,0x83,0x00,0x02,0x08,0x01,0x07,0x85,0x00,0x00,0x02,0x00,0x03,
+  0x85,0x00,0x02,0x14,0x04,0x15,0x83,0x00,0x02,0x0B,0x01,0x0A,0x85,0x00,0x00,0x02,0x00,0x03,0x8D,0x00,0x01,0x01,0x01,0x85,
+  0x00,0x00,0x02,0x00,0x03,0x8D,0x00,0x01,0x01,0x01,0x85,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x01,0x06,0x04,0x8B,0x01,0x01,
+  0x04,0x05,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x00,0x04,0x8D,0x01,0x00,0x04,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,
+  0x02,0x01,0x01,0x16,0x89,0x00,0x02,0x09,0x01,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x01,0x01,0x01,0x8B,0x00,0x01,
+  0x01,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x01,0x01,0x01,0x8B,0x00,0x01,0x01,0x01,0x82,0x00,0x00,0x02,0x00,0x03,
+  0x82,0x00,0x01,0x01,0x01,0x83,0x00,0x03,0x06,0x04,0x04,0x05,0x83,0x00,0x01,0x01,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,
+  0x00,0x01,0x01,0x01,0x83,0x00,0x03,0x04,0x01,0x01,0x04,0x83,0x00,0x01,0x01,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,
+  0x01,0x01,0x01,0x83,0x00,0x03,0x04,0x01,0x01,0x04,0x83,0x00,0x01,0x01,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x01,
+  0x01,0x01,0x83,0x00,0x03,0x05,0x04,0x04,0x05,0x83,0x00,0x01,0x01,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x01,0x01,
+  0x01,0x8B,0x00,0x01,0x01,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x01,0x01,0x01,0x8B,0x00,0x01,0x01,0x01,0x82,0x00,
+  0x00,0x02,0x00,0x03,0x82,0x00,0x02,0x01,0x01,0x09,0x89,0x00,0x02,0x09,0x01,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,
+  0x00,0x04,0x8D,0x01,0x00,0x04,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x01,0x05,0x04,0x8B,0x01,0x01,0x04,0x05,0x82,0x00,
+  0x00,0x02,0x00,0x03,0x95,0x00,0x00,0x02,0x97,0x02,
+};
+
+// qr_off  24x24, 35 colors, 1152 -> 501 bytes
+const uint16_t imgPal_qr_off[35] PROGMEM = {
+  0x9019,0xEA10,0x157C,0xFB42,0xB473,0xF47B,0x736B,0x5363,0xD473,0xD129,0x313A,0x335B,0x147C,0x3363,0xB24A,0x946B,
+  0x135B,0x513A,0x1132,0xF252,0xF131,0x936B,0x7142,0xB121,0x125B,0xD252,0x7242,0xF25A,0xB252,0x7363,0xB129,0xF129,
+  0x9021,0xB46B,0x113A,
+};
+const uint8_t imgRle_qr_off[431] PROGMEM = {
+  0x96,0x03,0x00,0x01,0x00,0x03,0x95,0x00,0x00,0x01,0x00,0x03,0x95,0x00,0x00,0x01,0x02,0x03,0x00,0x0F,0x85,0x04,0x05,0x0A,
+  0x1E,0x04,0x07,0x00,0x13,0x85,0x04,0x02,0x10,0x00,0x01,0x03,0x03,0x00,0x05,0x0C,0x82,0x04,0x10,0x05,0x02,0x11,0x09,0x08,
+  0x06,0x00,0x0D,0x02,0x08,0x04,0x04,0x08,0x02,0x07,0x00,0x01,0x03,0x03,0x00,0x05,0x08,0x82,0x00,0x02,0x0D,0x02,0x11,0x83,
+  0x00,0x09,0x0D,0x02,0x16,0x00,0x00,0x14,0x02,0x07,0x00,0x01,0x03,0x03,0x00,0x05,0x08,0x82,0x00,0x10,0x0D,0x02,0x11,0x17,
+  0x07,0x18,0x00,0x0D,0x02,0x16,0x00,0x00,0x14,0x02,0x07,0x00,0x01,0x03,0x03,0x00,0x05,0x08,0x82,0x00,0x10,0x0D,0x02,0x11,
+  0x09,0x02,0x04,0x00,0x0D,0x02,0x16,0x00,0x00,0x14,0x02,0x07,0x00,0x01,0x03,0x03,0x00,0x05,0x02,0x82,0x05,0x08,0x0C,0x02,
+  0x11,0x09,0x02,0x04,0x00,0x0D,0x02,0x83,0x05,0x03,0x02,0x07,0x00,0x01,0x02,0x03,0x00,0x07,0x85,0x06,0x05,0x12,0x09,0x02,
+  0x04,0x00,0x0E,0x85,0x06,0x02,0x19,0x00,0x01,0x00,0x03,0x88,0x00,0x02,0x09,0x02,0x04,0x89,0x00,0x00,0x01,0x17,0x03,0x00,
+  0x0F,0x15,0x00,0x0E,0x04,0x0E,0x00,0x06,0x04,0x1A,0x13,0x04,0x13,0x00,0x07,0x04,0x17,0x0A,0x04,0x10,0x00,0x01,0x17,0x03,
+  0x00,0x04,0x0F,0x00,0x0E,0x08,0x19,0x00,0x0F,0x08,0x0A,0x1B,0x02,0x07,0x0A,0x15,0x08,0x12,0x1A,0x08,0x0B,0x00,0x01,0x00,
+  0x03,0x88,0x00,0x00,0x17,0x84,0x02,0x03,0x1C,0x00,0x0C,0x05,0x82,0x00,0x00,0x01,0x01,0x03,0x00,0x86,0x0B,0x0E,0x1F,0x20,
+  0x18,0x1D,0x02,0x21,0x10,0x0A,0x00,0x0C,0x05,0x0B,0x0E,0x00,0x01,0x02,0x03,0x00,0x0C,0x85,0x02,0x05,0x0A,0x00,0x00,0x0E,
+  0x02,0x0B,0x82,0x00,0x05,0x0C,0x02,0x02,0x07,0x00,0x01,0x03,0x03,0x00,0x0C,0x04,0x82,0x09,0x10,0x07,0x02,0x0A,0x09,0x05,
+  0x05,0x02,0x0B,0x00,0x06,0x05,0x02,0x05,0x12,0x09,0x00,0x01,0x03,0x03,0x00,0x0C,0x04,0x82,0x00,0x0C,0x07,0x02,0x0A,0x09,
+  0x02,0x05,0x06,0x10,0x0E,0x1D,0x0F,0x0F,0x06,0x82,0x00,0x00,0x01,0x03,0x03,0x00,0x0C,0x04,0x82,0x00,0x09,0x07,0x02,0x0A,
+  0x09,0x02,0x04,0x00,0x10,0x02,0x1C,0x85,0x00,0x00,0x01,0x03,0x03,0x00,0x0C,0x05,0x82,0x06,0x10,0x08,0x02,0x0A,0x09,0x02,
+  0x04,0x00,0x10,0x02,0x04,0x15,0x14,0x12,0x15,0x1B,0x00,0x01,0x01,0x03,0x00,0x86,0x05,0x05,0x22,0x09,0x08,0x06,0x00,0x13,
+  0x82,0x08,0x05,0x12,0x0A,0x05,0x07,0x00,0x01,0x00,0x03,0x95,0x00,0x00,0x01,0x00,0x03,0x95,0x00,0x00,0x01,0x97,0x01,
+};
+
+// qr_on  24x24, 58 colors, 1152 -> 550 bytes
+const uint16_t imgPal_qr_on[58] PROGMEM = {
+  0x9019,0xEA10,0xFFFF,0xFB42,0xDFFF,0x3DE7,0x1DE7,0x9BD6,0x7EEF,0x924A,0x7BCE,0xBFF7,0x1ABE,0xBEF7,0x1AC6,0xFCDE,
+  0xBBD6,0xB9B5,0xF47B,0x5DEF,0x179D,0x946B,0x78AD,0x5584,0x335B,0xF9BD,0x5BCE,0x5363,0xD473,0xDCDE,0x9EF7,0x7142,
+  0xD694,0xB473,0x9BCE,0xD69C,0x3AC6,0x7363,0x936B,0x5142,0x313A,0x58AD,0xBCD6,0x5ACE,0x513A,0x37A5,0x98AD,0x758C,
+  0xF131,0xD252,0xB129,0x1CDF,0x7242,0xB252,0xD9BD,0x5DE7,0x98B5,0x736B,
+};
+const uint8_t imgRle_qr_on[434] PROGMEM = {
+  0x96,0x03,0x00,0x01,0x00,0x03,0x95,0x00,0x00,0x01,0x00,0x03,0x95,0x00,0x00,0x01,0x02,0x03,0x00,0x0F,0x85,0x05,0x05,0x26,
+  0x27,0x05,0x1A,0x00,0x16,0x85,0x06,0x02,0x11,0x00,0x01,0x03,0x03,0x00,0x04,0x04,0x82,0x05,0x10,0x0D,0x02,0x12,0x1F,0x08,
+  0x07,0x00,0x0E,0x02,0x08,0x05,0x05,0x13,0x02,0x0A,0x00,0x01,0x03,0x03,0x00,0x04,0x13,0x82,0x00,0x02,0x0E,0x02,0x12,0x83,
+  0x00,0x09,0x0E,0x02,0x17,0x00,0x00,0x18,0x02,0x0A,0x00,0x01,0x03,0x03,0x00,0x04,0x13,0x82,0x00,0x10,0x0E,0x02,0x12,0x28,
+  0x1A,0x11,0x00,0x0E,0x02,0x17,0x00,0x00,0x18,0x02,0x0A,0x00,0x01,0x03,0x03,0x00,0x04,0x13,0x82,0x00,0x10,0x0E,0x02,0x12,
+  0x09,0x02,0x06,0x00,0x0E,0x02,0x17,0x00,0x00,0x18,0x02,0x0A,0x00,0x01,0x03,0x03,0x00,0x04,0x02,0x82,0x0B,0x09,0x04,0x02,
+  0x12,0x09,0x02,0x06,0x00,0x0E,0x02,0x04,0x82,0x0B,0x03,0x02,0x0A,0x00,0x01,0x02,0x03,0x00,0x0A,0x85,0x07,0x05,0x1B,0x09,
+  0x02,0x06,0x00,0x14,0x85,0x07,0x02,0x29,0x00,0x01,0x00,0x03,0x88,0x00,0x02,0x09,0x02,0x06,0x89,0x00,0x00,0x01,0x17,0x03,
+  0x00,0x0F,0x2A,0x00,0x20,0x06,0x14,0x00,0x10,0x06,0x17,0x16,0x06,0x16,0x00,0x2B,0x05,0x2C,0x21,0x06,0x11,0x00,0x01,0x17,
+  0x03,0x00,0x05,0x0F,0x00,0x14,0x08,0x2D,0x00,0x0F,0x13,0x1C,0x2E,0x02,0x0A,0x1C,0x1D,0x08,0x1B,0x2F,0x08,0x19,0x00,0x01,
+  0x00,0x03,0x88,0x00,0x00,0x30,0x84,0x02,0x03,0x14,0x00,0x04,0x1E,0x82,0x00,0x00,0x01,0x02,0x03,0x00,0x19,0x85,0x0C,0x0E,
+  0x31,0x32,0x11,0x22,0x02,0x33,0x11,0x21,0x00,0x04,0x04,0x0C,0x23,0x00,0x01,0x02,0x03,0x00,0x04,0x85,0x02,0x05,0x15,0x00,
+  0x00,0x20,0x02,0x0C,0x82,0x00,0x05,0x04,0x02,0x02,0x0A,0x00,0x01,0x03,0x03,0x00,0x04,0x05,0x82,0x09,0x10,0x0A,0x02,0x15,
+  0x34,0x0B,0x04,0x02,0x0C,0x00,0x10,0x1E,0x02,0x0D,0x1B,0x35,0x00,0x01,0x03,0x03,0x00,0x04,0x05,0x82,0x00,0x0C,0x24,0x02,
+  0x15,0x09,0x02,0x0B,0x10,0x36,0x23,0x22,0x0F,0x0F,0x07,0x82,0x00,0x00,0x01,0x03,0x03,0x00,0x04,0x05,0x82,0x00,0x09,0x24,
+  0x02,0x15,0x09,0x02,0x06,0x00,0x19,0x02,0x14,0x85,0x00,0x00,0x01,0x03,0x03,0x00,0x04,0x0B,0x82,0x10,0x10,0x08,0x02,0x15,
+  0x09,0x02,0x06,0x00,0x19,0x02,0x37,0x1D,0x18,0x25,0x1D,0x38,0x00,0x01,0x02,0x03,0x00,0x1E,0x85,0x0D,0x05,0x39,0x1F,0x08,
+  0x07,0x00,0x16,0x82,0x08,0x05,0x25,0x1C,0x04,0x1A,0x00,0x01,0x00,0x03,0x95,0x00,0x00,0x01,0x00,0x03,0x95,0x00,0x00,0x01,
+  0x97,0x01,
+};
+
+// rfid_off  24x24, 30 colors, 1152 -> 358 bytes
+const uint16_t imgPal_rfid_off[30] PROGMEM = {
+  0x9019,0xEA10,0xFB42,0x157C,0xF47B,0xF252,0x5142,0x7142,0xB121,0xF131,0xD473,0xB473,0x1132,0x313A,0xB24A,0xD129,
+  0x125B,0x736B,0x7363,0xD252,0x5363,0x335B,0xF25A,0x7242,0x924A,0x135B,0x946B,0xB252,0x9021,0x936B,
+};
+const uint8_t imgRle_rfid_off[298] PROGMEM = {
+  0x96,0x02,0x00,0x01,0x00,0x02,0x95,0x00,0x00,0x01,0x00,0x02,0x95,0x00,0x00,0x01,0x00,0x02,0x95,0x00,0x00,0x01,0x00,0x02,
+  0x95,0x00,0x00,0x01,0x00,0x02,0x95,0x00,0x00,0x01,0x04,0x02,0x00,0x00,0x10,0x0A,0x8D,0x04,0x04,0x0A,0x11,0x08,0x00,0x01,
+  0x05,0x02,0x00,0x00,0x03,0x04,0x10,0x8C,0x05,0x04,0x0B,0x03,0x07,0x00,0x01,0x04,0x02,0x00,0x00,0x03,0x12,0x8D,0x00,0x04,
+  0x05,0x03,0x07,0x00,0x01,0x04,0x02,0x00,0x00,0x0E,0x06,0x8D,0x00,0x04,0x05,0x03,0x07,0x00,0x01,0x04,0x02,0x00,0x00,0x09,
+  0x0C,0x8D,0x00,0x04,0x05,0x03,0x07,0x00,0x01,0x07,0x02,0x00,0x00,0x04,0x03,0x04,0x11,0x17,0x8A,0x00,0x04,0x05,0x03,0x07,
+  0x00,0x01,0x09,0x02,0x00,0x00,0x09,0x18,0x19,0x0A,0x03,0x1A,0x0C,0x88,0x00,0x04,0x05,0x03,0x07,0x00,0x01,0x0A,0x02,0x00,
+  0x00,0x1B,0x13,0x09,0x00,0x13,0x04,0x04,0x0D,0x87,0x00,0x04,0x05,0x03,0x07,0x00,0x01,0x0B,0x02,0x00,0x00,0x0B,0x03,0x03,
+  0x14,0x08,0x0D,0x04,0x0A,0x0F,0x86,0x00,0x04,0x05,0x03,0x07,0x00,0x01,0x00,0x02,0x82,0x00,0x07,0x0F,0x15,0x03,0x0B,0x08,
+  0x0E,0x03,0x15,0x86,0x00,0x04,0x05,0x03,0x07,0x00,0x01,0x0E,0x02,0x00,0x00,0x0B,0x05,0x00,0x16,0x03,0x16,0x00,0x0A,0x04,
+  0x00,0x00,0x0D,0x83,0x06,0x04,0x12,0x03,0x07,0x00,0x01,0x0D,0x02,0x00,0x00,0x03,0x03,0x0E,0x1C,0x04,0x1D,0x00,0x14,0x03,
+  0x08,0x0C,0x85,0x03,0x03,0x04,0x09,0x00,0x01,0x0E,0x02,0x00,0x00,0x06,0x06,0x09,0x00,0x09,0x0F,0x00,0x08,0x0C,0x00,0x00,
+  0x0D,0x84,0x06,0x03,0x08,0x00,0x00,0x01,0x00,0x02,0x95,0x00,0x00,0x01,0x00,0x02,0x95,0x00,0x00,0x01,0x00,0x02,0x95,0x00,
+  0x00,0x01,0x00,0x02,0x95,0x00,0x00,0x01,0x97,0x01,
+};
+
+// rfid_on  24x24, 48 colors, 1152 -> 394 bytes
+const uint16_t imgPal_rfid_on[48] PROGMEM = {
+  0x9019,0xEA10,0xFB42,0xFFFF,0x78AD,0x9EF7,0x3584,0x1584,0x7EEF,0x9BD6,0xBFF7,0x3363,0xF252,0xB473,0xB9B5,0x1132,
+  0x3DE7,0xF79C,0x335B,0xBEF7,0xF9BD,0x37A5,0x1DE7,0x7242,0xF131,0xF47B,0x758C,0x968C,0xFCDE,0x179D,0xDFFF,0x5ACE,
+  0x513A,0xB252,0xD694,0x1ABE,0x98B5,0x98AD,0x5EEF,0x9BCE,0xD129,0xDCDE,0x3AC6,0x313A,0x5363,0x135B,0x946B,0x157C,
+};
+const uint8_t imgRle_rfid_on[298] PROGMEM = {
+  0x96,0x02,0x00,0x01,0x00,0x02,0x95,0x00,0x00,0x01,0x00,0x02,0x95,0x00,0x00,0x01,0x00,0x02,0x95,0x00,0x00,0x01,0x00,0x02,
+  0x95,0x00,0x00,0x01,0x00,0x02,0x95,0x00,0x00,0x01,0x04,0x02,0x00,0x00,0x0E,0x08,0x8E,0x05,0x03,0x09,0x0F,0x00,0x01,0x05,
+  0x02,0x00,0x00,0x03,0x0A,0x0E,0x8C,0x04,0x04,0x10,0x03,0x06,0x00,0x01,0x04,0x02,0x00,0x00,0x03,0x09,0x8D,0x00,0x04,0x04,
+  0x03,0x06,0x00,0x01,0x04,0x02,0x00,0x00,0x11,0x19,0x8D,0x00,0x04,0x04,0x03,0x06,0x00,0x01,0x04,0x02,0x00,0x00,0x12,0x0B,
+  0x8D,0x00,0x04,0x04,0x03,0x06,0x00,0x01,0x07,0x02,0x00,0x00,0x13,0x03,0x0A,0x09,0x1A,0x8A,0x00,0x04,0x04,0x03,0x06,0x00,
+  0x01,0x09,0x02,0x00,0x00,0x12,0x1B,0x14,0x08,0x03,0x1C,0x0B,0x88,0x00,0x04,0x04,0x03,0x06,0x00,0x01,0x0A,0x02,0x00,0x00,
+  0x1D,0x15,0x0C,0x00,0x15,0x1E,0x05,0x0D,0x87,0x00,0x04,0x04,0x03,0x06,0x00,0x01,0x0B,0x02,0x00,0x00,0x16,0x03,0x03,0x1F,
+  0x20,0x0D,0x0A,0x08,0x17,0x86,0x00,0x04,0x04,0x03,0x06,0x00,0x01,0x00,0x02,0x82,0x00,0x07,0x21,0x14,0x03,0x16,0x18,0x22,
+  0x03,0x23,0x86,0x00,0x04,0x04,0x03,0x06,0x00,0x01,0x0E,0x02,0x00,0x00,0x10,0x04,0x00,0x24,0x03,0x25,0x00,0x26,0x05,0x00,
+  0x00,0x0D,0x83,0x07,0x04,0x27,0x03,0x06,0x00,0x01,0x0D,0x02,0x00,0x00,0x03,0x03,0x11,0x28,0x13,0x29,0x00,0x2A,0x03,0x2B,
+  0x2C,0x85,0x03,0x03,0x05,0x0C,0x00,0x01,0x0E,0x02,0x00,0x00,0x07,0x07,0x2D,0x00,0x0C,0x17,0x00,0x18,0x0B,0x00,0x00,0x2E,
+  0x83,0x07,0x04,0x2F,0x0F,0x00,0x00,0x01,0x00,0x02,0x95,0x00,0x00,0x01,0x00,0x02,0x95,0x00,0x00,0x01,0x00,0x02,0x95,0x00,
+  0x00,0x01,0x00,0x02,0x95,0x00,0x00,0x01,0x97,0x01,
+};
+
+// battery  24x24, 4 colors, 1152 -> 282 bytes
+const uint16_t imgPal_battery[4] PROGMEM = {
+  0x9019,0x1CE7,0xEA10,0xFB42,
+};
+const uint8_t imgRle_battery[274] PROGMEM = {
+  0x96,0x03,0x00,0x02,0x00,0x03,0x95,0x00,0x00,0x02,0x00,0x03,0x88,0x00,0x83,0x01,0x88,0x00,0x00,0x02,0x00,0x03,0x88,0x00,
+  0x83,0x01,0x88,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x89,0x01,0x85,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x89,0x01,0x85,0x00,
+  0x00,0x02,0x00,0x03,0x85,0x00,0x00,0x01,0x87,0x00,0x00,0x01,0x85,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x00,0x01,0x87,0x00,
+  0x00,0x01,0x85,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x00,0x01,0x87,0x00,0x00,0x01,0x85,0x00,0x00,0x02,0x00,0x03,0x85,0x00,
+  0x00,0x01,0x87,0x00,0x00,0x01,0x85,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x00,0x01,0x87,0x00,0x00,0x01,0x85,0x00,0x00,0x02,
+  0x00,0x03,0x85,0x00,0x00,0x01,0x87,0x00,0x00,0x01,0x85,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x00,0x01,0x87,0x00,0x00,0x01,
+  0x85,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x00,0x01,0x87,0x00,0x00,0x01,0x85,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x00,0x01,
+  0x87,0x00,0x00,0x01,0x85,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x00,0x01,0x87,0x00,0x00,0x01,0x85,0x00,0x00,0x02,0x00,0x03,
+  0x85,0x00,0x00,0x01,0x87,0x00,0x00,0x01,0x85,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x00,0x01,0x87,0x00,0x00,0x01,0x85,0x00,
+  0x00,0x02,0x00,0x03,0x85,0x00,0x00,0x01,0x87,0x00,0x00,0x01,0x85,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x00,0x01,0x87,0x00,
+  0x00,0x01,0x85,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x89,0x01,0x85,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x89,0x01,0x85,0x00,
+  0x00,0x02,0x00,0x03,0x95,0x00,0x00,0x02,0x97,0x02,
+};
+
+// key  24x24, 32 colors, 1152 -> 474 bytes
+const uint16_t imgPal_key[32] PROGMEM = {
+  0x271C,0x1CE7,0x2312,0xF16E,0xFBDE,0x78C6,0x1BDF,0x8B4C,0x4834,0x99CE,0x0F75,0xAC54,0x482C,0xDAD6,0x728D,0xB49D,
+  0x8A4C,0x57BE,0xCD64,0xAC5C,0xB39D,0xAB54,0xEE6C,0x472C,0x2724,0x4724,0xB4A5,0xCE64,0x939D,0x58BE,0xEE74,0xBAD6,
+};
+const uint8_t imgRle_key[410] PROGMEM = {
+  0x96,0x03,0x00,0x02,0x00,0x03,0x87,0x00,0x05,0x08,0x0E,0x09,0x09,0x0E,0x08,0x87,0x00,0x00,0x02,0x00,0x03,0x87,0x00,0x08,
+  0x10,0x09,0x01,0x01,0x09,0x12,0x07,0x10,0x08,0x84,0x00,0x00,0x02,0x00,0x03,0x87,0x00,0x01,0x07,0x04,0x82,0x01,0x03,0x04,
+  0x04,0x09,0x0E,0x84,0x00,0x00,0x02,0x00,0x03,0x87,0x00,0x01,0x07,0x04,0x85,0x01,0x00,0x09,0x84,0x00,0x00,0x02,0x00,0x03,
+  0x87,0x00,0x01,0x07,0x04,0x85,0x01,0x00,0x09,0x84,0x00,0x00,0x02,0x00,0x03,0x87,0x00,0x01,0x07,0x04,0x82,0x01,0x03,0x04,
+  0x04,0x09,0x0E,0x84,0x00,0x00,0x02,0x00,0x03,0x87,0x00,0x08,0x07,0x04,0x01,0x01,0x04,0x12,0x07,0x10,0x08,0x84,0x00,0x00,
+  0x02,0x00,0x03,0x87,0x00,0x05,0x07,0x04,0x01,0x01,0x04,0x07,0x87,0x00,0x00,0x02,0x00,0x03,0x87,0x00,0x05,0x07,0x04,0x01,
+  0x01,0x04,0x07,0x87,0x00,0x00,0x02,0x00,0x03,0x86,0x00,0x07,0x18,0x13,0x04,0x01,0x01,0x04,0x0B,0x19,0x86,0x00,0x00,0x02,
+  0x00,0x03,0x85,0x00,0x09,0x0C,0x0B,0x1A,0x04,0x01,0x01,0x04,0x14,0x15,0x0C,0x85,0x00,0x00,0x02,0x00,0x03,0x84,0x00,0x03,
+  0x0C,0x16,0x05,0x04,0x83,0x01,0x03,0x04,0x05,0x1B,0x0C,0x84,0x00,0x00,0x02,0x00,0x03,0x84,0x00,0x02,0x13,0x05,0x06,0x85,
+  0x01,0x02,0x06,0x05,0x15,0x84,0x00,0x00,0x02,0x00,0x03,0x84,0x00,0x0B,0x0F,0x04,0x01,0x01,0x06,0x04,0x04,0x06,0x01,0x01,
+  0x04,0x1C,0x84,0x00,0x00,0x02,0x00,0x03,0x84,0x00,0x0B,0x05,0x01,0x01,0x06,0x11,0x0A,0x0A,0x1D,0x06,0x01,0x01,0x05,0x84,
+  0x00,0x00,0x02,0x00,0x03,0x84,0x00,0x0B,0x0D,0x01,0x01,0x04,0x0A,0x08,0x08,0x0A,0x04,0x01,0x01,0x0D,0x84,0x00,0x00,0x02,
+  0x00,0x03,0x84,0x00,0x0B,0x0D,0x01,0x01,0x04,0x0A,0x08,0x08,0x0A,0x04,0x01,0x01,0x0D,0x84,0x00,0x00,0x02,0x00,0x03,0x84,
+  0x00,0x0B,0x05,0x01,0x01,0x06,0x11,0x0A,0x0A,0x11,0x06,0x01,0x01,0x05,0x84,0x00,0x00,0x02,0x00,0x03,0x84,0x00,0x0B,0x0F,
+  0x04,0x01,0x01,0x06,0x04,0x04,0x06,0x01,0x01,0x04,0x0F,0x84,0x00,0x00,0x02,0x00,0x03,0x84,0x00,0x02,0x0B,0x05,0x06,0x85,
+  0x01,0x02,0x06,0x05,0x0B,0x84,0x00,0x00,0x02,0x00,0x03,0x84,0x00,0x03,0x0C,0x1E,0x05,0x04,0x83,0x01,0x03,0x04,0x05,0x16,
+  0x17,0x84,0x00,0x00,0x02,0x00,0x03,0x85,0x00,0x09,0x0C,0x0B,0x14,0x05,0x0D,0x1F,0x05,0x0F,0x0B,0x17,0x85,0x00,0x00,0x02,
+  0x97,0x02,
+};
+
+// setting  24x24, 28 colors, 1152 -> 418 bytes
+const uint16_t imgPal_setting[28] PROGMEM = {
+  0x271C,0x1CE7,0x2312,0xF16E,0xDAD6,0x4934,0x37BE,0x36B6,0x99CE,0x4724,0x99C6,0x78C6,0x728D,0x8B54,0x16B6,0x9295,
+  0x6944,0xF5AD,0x7295,0x1BDF,0x0F75,0xD4A5,0xB4A5,0x37B6,0x57BE,0xDBDE,0xFBDE,0xB49D,
+};
+const uint8_t imgRle_setting[362] PROGMEM = {
+  0x96,0x03,0x00,0x02,0x00,0x03,0x95,0x00,0x00,0x02,0x00,0x03,0x87,0x00,0x00,0x16,0x83,0x01,0x00,0x16,0x87,0x00,0x00,0x02,
+  0x00,0x03,0x87,0x00,0x00,0x18,0x83,0x01,0x00,0x06,0x87,0x00,0x00,0x02,0x00,0x03,0x87,0x00,0x00,0x08,0x83,0x01,0x00,0x08,
+  0x87,0x00,0x00,0x02,0x08,0x03,0x00,0x00,0x09,0x0A,0x0B,0x0C,0x0D,0x0E,0x85,0x01,0x08,0x0E,0x0D,0x0C,0x0B,0x0A,0x09,0x00,
+  0x00,0x02,0x03,0x03,0x00,0x00,0x0F,0x8F,0x01,0x03,0x0F,0x00,0x00,0x02,0x03,0x03,0x00,0x10,0x19,0x8F,0x01,0x03,0x1A,0x10,
+  0x00,0x02,0x02,0x03,0x00,0x11,0x86,0x01,0x03,0x04,0x17,0x17,0x04,0x86,0x01,0x02,0x11,0x00,0x02,0x03,0x03,0x00,0x12,0x13,
+  0x84,0x01,0x05,0x06,0x05,0x00,0x00,0x05,0x06,0x84,0x01,0x03,0x13,0x12,0x00,0x02,0x04,0x03,0x00,0x00,0x14,0x04,0x82,0x01,
+  0x01,0x04,0x05,0x83,0x00,0x01,0x05,0x04,0x82,0x01,0x04,0x04,0x14,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x00,0x15,0x82,0x01,
+  0x00,0x07,0x85,0x00,0x00,0x07,0x82,0x01,0x00,0x15,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x00,0x15,0x82,0x01,0x00,0x17,
+  0x85,0x00,0x00,0x07,0x82,0x01,0x00,0x15,0x82,0x00,0x00,0x02,0x04,0x03,0x00,0x00,0x14,0x04,0x82,0x01,0x01,0x04,0x05,0x83,
+  0x00,0x01,0x05,0x04,0x82,0x01,0x04,0x04,0x14,0x00,0x00,0x02,0x03,0x03,0x00,0x12,0x13,0x84,0x01,0x05,0x06,0x05,0x00,0x00,
+  0x05,0x06,0x84,0x01,0x03,0x13,0x12,0x00,0x02,0x02,0x03,0x00,0x11,0x86,0x01,0x03,0x04,0x07,0x07,0x04,0x86,0x01,0x02,0x11,
+  0x00,0x02,0x03,0x03,0x00,0x10,0x19,0x8F,0x01,0x03,0x1A,0x10,0x00,0x02,0x03,0x03,0x00,0x00,0x0F,0x8F,0x01,0x03,0x0F,0x00,
+  0x00,0x02,0x08,0x03,0x00,0x00,0x09,0x0A,0x0B,0x0C,0x0D,0x0E,0x85,0x01,0x08,0x0E,0x0D,0x0C,0x0B,0x0A,0x09,0x00,0x00,0x02,
+  0x00,0x03,0x87,0x00,0x00,0x08,0x83,0x01,0x00,0x08,0x87,0x00,0x00,0x02,0x00,0x03,0x87,0x00,0x00,0x18,0x83,0x01,0x00,0x06,
+  0x87,0x00,0x00,0x02,0x00,0x03,0x87,0x00,0x00,0x16,0x83,0x01,0x00,0x1B,0x87,0x00,0x00,0x02,0x00,0x03,0x95,0x00,0x00,0x02,
+  0x97,0x02,
+};
+
+// barcode  24x24, 5 colors, 1152 -> 456 bytes
+const uint16_t imgPal_barcode[5] PROGMEM = {
+  0x271C,0xFFFF,0x2312,0xF16E,0x471C,
+};
+const uint8_t imgRle_barcode[446] PROGMEM = {
+  0x96,0x03,0x00,0x02,0x00,0x03,0x95,0x00,0x00,0x02,0x00,0x03,0x95,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x00,0x04,0x91,0x00,
+  0x00,0x02,0x00,0x03,0x82,0x00,0x0F,0x01,0x01,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x01,0x00,0x01,0x00,0x01,0x01,0x82,
+  0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x0F,0x01,0x01,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x01,0x00,0x01,0x00,0x01,0x01,
+  0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x0F,0x01,0x01,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x01,0x00,0x01,0x00,0x01,
+  0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x0F,0x01,0x01,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x01,0x00,0x01,0x00,
+  0x01,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x0F,0x01,0x01,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x01,0x00,0x01,
+  0x00,0x01,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x0F,0x01,0x01,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x01,0x00,
+  0x01,0x00,0x01,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x0F,0x01,0x01,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x01,
+  0x00,0x01,0x00,0x01,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x0F,0x01,0x01,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,
+  0x01,0x00,0x01,0x00,0x01,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x0F,0x01,0x01,0x00,0x01,0x00,0x00,0x01,0x00,0x00,
+  0x01,0x01,0x00,0x01,0x00,0x01,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x0F,0x01,0x01,0x00,0x01,0x00,0x00,0x01,0x00,
+  0x00,0x01,0x01,0x00,0x01,0x00,0x01,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x0F,0x01,0x01,0x00,0x01,0x00,0x00,0x01,
+  0x00,0x00,0x01,0x01,0x00,0x01,0x00,0x01,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x0F,0x01,0x01,0x00,0x01,0x00,0x00,
+  0x01,0x00,0x00,0x01,0x01,0x00,0x01,0x00,0x01,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x0F,0x01,0x01,0x00,0x01,0x00,
+  0x00,0x01,0x00,0x00,0x01,0x01,0x00,0x01,0x00,0x01,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x0F,0x01,0x01,0x00,0x01,
+  0x00,0x00,0x01,0x00,0x00,0x01,0x01,0x00,0x01,0x00,0x01,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x0F,0x01,0x01,0x00,
+  0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x01,0x00,0x01,0x00,0x01,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x0F,0x01,0x01,
+  0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x01,0x00,0x01,0x00,0x01,0x01,0x82,0x00,0x00,0x02,0x00,0x03,0x95,0x00,0x00,0x02,
+  0x00,0x03,0x95,0x00,0x00,0x02,0x00,0x03,0x95,0x00,0x00,0x02,0x97,0x02,
+};
+
+// power  24x24, 39 colors, 1152 -> 454 bytes
+const uint16_t imgPal_power[39] PROGMEM = {
+  0x271C,0x1CE7,0x2312,0xF16E,0xFBDE,0x99CE,0x6A44,0xEE6C,0x78C6,0xAC5C,0x307D,0x36B6,0xBAD6,0x8B4C,0x57BE,0x6944,
+  0x0F75,0x5185,0xD4A5,0xF5AD,0xAD5C,0x8B54,0x37B6,0x1BDF,0x693C,0xDAD6,0xD5A5,0x107D,0x58BE,0x4724,0x4834,0xCD64,
+  0xEF74,0xF5A5,0xEE74,0x99C6,0x0F7D,0xBACE,0x16B6,
+};
+const uint8_t imgRle_power[376] PROGMEM = {
+  0x96,0x03,0x00,0x02,0x00,0x03,0x95,0x00,0x00,0x02,0x00,0x03,0x95,0x00,0x00,0x02,0x00,0x03,0x89,0x00,0x01,0x05,0x05,0x89,
+  0x00,0x00,0x02,0x00,0x03,0x89,0x00,0x01,0x01,0x01,0x89,0x00,0x00,0x02,0x00,0x03,0x83,0x00,0x01,0x07,0x11,0x83,0x00,0x01,
+  0x01,0x01,0x83,0x00,0x01,0x11,0x07,0x83,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x03,0x14,0x04,0x01,0x15,0x82,0x00,0x01,0x01,
+  0x01,0x82,0x00,0x03,0x0D,0x01,0x04,0x09,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x02,0x05,0x01,0x0E,0x83,0x00,0x01,0x01,
+  0x01,0x83,0x00,0x02,0x0E,0x01,0x05,0x82,0x00,0x00,0x02,0x06,0x03,0x00,0x00,0x0A,0x01,0x04,0x06,0x83,0x00,0x01,0x01,0x01,
+  0x83,0x00,0x06,0x06,0x04,0x01,0x0A,0x00,0x00,0x02,0x05,0x03,0x00,0x00,0x16,0x01,0x12,0x84,0x00,0x01,0x01,0x01,0x84,0x00,
+  0x05,0x12,0x01,0x0B,0x00,0x00,0x02,0x05,0x03,0x00,0x00,0x0C,0x01,0x07,0x84,0x00,0x01,0x01,0x01,0x84,0x00,0x05,0x07,0x01,
+  0x0C,0x00,0x00,0x02,0x05,0x03,0x00,0x00,0x17,0x01,0x0F,0x84,0x00,0x01,0x01,0x01,0x84,0x00,0x05,0x18,0x01,0x04,0x00,0x00,
+  0x02,0x05,0x03,0x00,0x00,0x04,0x01,0x06,0x84,0x00,0x01,0x05,0x05,0x84,0x00,0x05,0x06,0x01,0x04,0x00,0x00,0x02,0x05,0x03,
+  0x00,0x00,0x19,0x01,0x07,0x8B,0x00,0x05,0x10,0x01,0x0C,0x00,0x00,0x02,0x05,0x03,0x00,0x00,0x0B,0x01,0x1A,0x8B,0x00,0x05,
+  0x13,0x01,0x0B,0x00,0x00,0x02,0x06,0x03,0x00,0x00,0x1B,0x01,0x04,0x0F,0x89,0x00,0x06,0x0D,0x04,0x01,0x0A,0x00,0x00,0x02,
+  0x00,0x03,0x82,0x00,0x03,0x08,0x01,0x1C,0x1D,0x87,0x00,0x03,0x1E,0x08,0x01,0x08,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,
+  0x04,0x09,0x04,0x01,0x0E,0x0F,0x85,0x00,0x04,0x0D,0x08,0x01,0x04,0x1F,0x82,0x00,0x00,0x02,0x00,0x03,0x83,0x00,0x0D,0x20,
+  0x04,0x01,0x04,0x21,0x22,0x06,0x06,0x10,0x13,0x04,0x01,0x04,0x10,0x83,0x00,0x00,0x02,0x00,0x03,0x84,0x00,0x01,0x09,0x08,
+  0x87,0x01,0x01,0x23,0x09,0x84,0x00,0x00,0x02,0x00,0x03,0x86,0x00,0x07,0x24,0x0B,0x25,0x04,0x04,0x0C,0x26,0x0A,0x86,0x00,
+  0x00,0x02,0x00,0x03,0x95,0x00,0x00,0x02,0x00,0x03,0x95,0x00,0x00,0x02,0x97,0x02,
+};
+
+// clock  24x24, 32 colors, 1152 -> 504 bytes
+const uint16_t imgPal_clock[32] PROGMEM = {
+  0x271C,0x1CE7,0x2312,0xF16E,0xFBDE,0x99CE,0x6A44,0x107D,0x307D,0xCD64,0xEE6C,0x58BE,0x78C6,0xBAD6,0x0F75,0x9395,
+  0x482C,0x16AE,0x36B6,0xD5A5,0x6944,0x37B6,0xB49D,0x472C,0xF5A5,0xDAD6,0x693C,0x99C6,0xB39D,0x4724,0xF5AD,0x58C6,
+};
+const uint8_t imgRle_clock[440] PROGMEM = {
+  0x96,0x03,0x00,0x02,0x00,0x03,0x95,0x00,0x00,0x02,0x00,0x03,0x83,0x00,0x02,0x07,0x0C,0x0E,0x87,0x00,0x02,0x0E,0x0C,0x07,
+  0x83,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x03,0x0F,0x01,0x01,0x16,0x87,0x00,0x03,0x16,0x01,0x01,0x0F,0x82,0x00,0x00,0x02,
+  0x17,0x03,0x00,0x10,0x11,0x01,0x01,0x11,0x10,0x08,0x12,0x0D,0x04,0x04,0x19,0x12,0x08,0x10,0x11,0x01,0x01,0x11,0x10,0x00,
+  0x02,0x07,0x03,0x00,0x16,0x01,0x01,0x0F,0x09,0x05,0x87,0x01,0x07,0x05,0x09,0x0F,0x01,0x01,0x1C,0x00,0x02,0x17,0x03,0x00,
+  0x0E,0x0C,0x07,0x07,0x04,0x01,0x04,0x13,0x0A,0x1A,0x1A,0x0A,0x13,0x04,0x01,0x04,0x07,0x07,0x0C,0x0E,0x00,0x02,0x00,0x03,
+  0x82,0x00,0x04,0x09,0x04,0x01,0x0B,0x06,0x85,0x00,0x04,0x14,0x0B,0x01,0x04,0x09,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,
+  0x03,0x05,0x01,0x0B,0x1D,0x87,0x00,0x03,0x17,0x0B,0x01,0x1B,0x82,0x00,0x00,0x02,0x06,0x03,0x00,0x00,0x08,0x01,0x04,0x06,
+  0x83,0x00,0x01,0x05,0x05,0x83,0x00,0x06,0x06,0x04,0x01,0x08,0x00,0x00,0x02,0x05,0x03,0x00,0x00,0x12,0x01,0x13,0x84,0x00,
+  0x01,0x01,0x01,0x84,0x00,0x05,0x18,0x01,0x15,0x00,0x00,0x02,0x05,0x03,0x00,0x00,0x0D,0x01,0x0A,0x84,0x00,0x01,0x01,0x01,
+  0x84,0x00,0x05,0x0A,0x01,0x19,0x00,0x00,0x02,0x08,0x03,0x00,0x00,0x04,0x01,0x06,0x00,0x00,0x05,0x85,0x01,0x08,0x05,0x00,
+  0x00,0x06,0x01,0x04,0x00,0x00,0x02,0x08,0x03,0x00,0x00,0x04,0x01,0x06,0x00,0x00,0x05,0x85,0x01,0x08,0x05,0x00,0x00,0x14,
+  0x01,0x04,0x00,0x00,0x02,0x05,0x03,0x00,0x00,0x0D,0x01,0x0A,0x84,0x00,0x01,0x01,0x01,0x84,0x00,0x05,0x0A,0x01,0x0D,0x00,
+  0x00,0x02,0x05,0x03,0x00,0x00,0x12,0x01,0x13,0x84,0x00,0x01,0x01,0x01,0x84,0x00,0x05,0x1E,0x01,0x15,0x00,0x00,0x02,0x06,
+  0x03,0x00,0x00,0x08,0x01,0x04,0x14,0x83,0x00,0x01,0x05,0x05,0x83,0x00,0x06,0x06,0x04,0x01,0x08,0x00,0x00,0x02,0x00,0x03,
+  0x82,0x00,0x03,0x05,0x01,0x0B,0x17,0x87,0x00,0x03,0x17,0x1F,0x01,0x0C,0x82,0x00,0x00,0x02,0x00,0x03,0x82,0x00,0x04,0x09,
+  0x04,0x01,0x0B,0x06,0x85,0x00,0x04,0x06,0x0B,0x01,0x04,0x09,0x82,0x00,0x00,0x02,0x00,0x03,0x83,0x00,0x0D,0x07,0x04,0x01,
+  0x04,0x18,0x0A,0x14,0x06,0x0A,0x18,0x04,0x01,0x04,0x07,0x83,0x00,0x00,0x02,0x00,0x03,0x84,0x00,0x01,0x09,0x1B,0x87,0x01,
+  0x01,0x0C,0x09,0x84,0x00,0x00,0x02,0x00,0x03,0x86,0x00,0x07,0x08,0x15,0x0D,0x04,0x04,0x0D,0x15,0x08,0x86,0x00,0x00,0x02,
+  0x00,0x03,0x95,0x00,0x00,0x02,0x97,0x02,
+};
+
+// putnfc1  107x64, 4 colors, 13696 -> 1172 bytes
+const uint16_t imgPal_putnfc1[4] PROGMEM = {
+  0x0000,0x9E17,0x9E1F,0xBE1F,
+};
+const uint8_t imgRle_putnfc1[1164] PROGMEM = {
+  0xEA,0x00,0xEA,0x00,0xEA,0x00,0x93,0x00,0xCF,0x01,0x86,0x00,0x91,0x00,0xD2,0x01,0x85,0x00,0x90,0x00,0xD4,0x01,0x84,0x00,
+  0x90,0x00,0xD5,0x01,0x83,0x00,0x8F,0x00,0xD6,0x01,0x83,0x00,0x8F,0x00,0x88,0x01,0xC5,0x00,0x87,0x01,0x83,0x00,0x8F,0x00,
+  0x86,0x01,0xC9,0x00,0x85,0x01,0x83,0x00,0x8F,0x00,0x85,0x01,0xCB,0x00,0x84,0x01,0x83,0x00,0x8F,0x00,0x85,0x01,0xC0,0x00,
+  0x01,0x02,0x01,0x88,0x00,0x84,0x01,0x83,0x00,0x8F,0x00,0x84,0x01,0x00,0x02,0xBF,0x00,0x00,0x02,0x82,0x01,0x87,0x00,0x84,
+  0x01,0x83,0x00,0x8F,0x00,0x85,0x01,0x83,0x00,0x83,0x01,0xB6,0x00,0x00,0x02,0x83,0x01,0x87,0x00,0x84,0x01,0x83,0x00,0x98,
+  0x00,0x85,0x01,0xB5,0x00,0x85,0x01,0x86,0x00,0x84,0x01,0x83,0x00,0x97,0x00,0x87,0x01,0xB5,0x00,0x84,0x01,0x86,0x00,0x84,
+  0x01,0x83,0x00,0x95,0x00,0x00,0x03,0x88,0x01,0xB2,0x00,0x00,0x01,0x82,0x00,0x84,0x01,0x85,0x00,0x84,0x01,0x83,0x00,0x89,
+  0x00,0x95,0x01,0xB1,0x00,0x82,0x01,0x01,0x00,0x00,0x84,0x01,0x85,0x00,0x84,0x01,0x83,0x00,0x88,0x00,0x95,0x01,0xB1,0x00,
+  0x83,0x01,0x82,0x00,0x84,0x01,0x84,0x00,0x84,0x01,0x83,0x00,0x88,0x00,0x94,0x01,0xB1,0x00,0x00,0x02,0x84,0x01,0x01,0x00,
+  0x00,0x84,0x01,0x84,0x00,0x84,0x01,0x83,0x00,0x88,0x00,0x93,0x01,0xB3,0x00,0x84,0x01,0x82,0x00,0x83,0x01,0x84,0x00,0x84,
+  0x01,0x83,0x00,0x88,0x00,0x91,0x01,0x00,0x02,0xB5,0x00,0x84,0x01,0x01,0x00,0x00,0x84,0x01,0x83,0x00,0x84,0x01,0x83,0x00,
+  0x88,0x00,0x90,0x01,0xB7,0x00,0x84,0x01,0x01,0x00,0x00,0x84,0x01,0x83,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xB2,0x01,
+  0x9C,0x00,0x00,0x02,0x83,0x01,0x82,0x00,0x83,0x01,0x83,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xB3,0x01,0x9C,0x00,0x84,
+  0x01,0x01,0x00,0x00,0x83,0x01,0x83,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xB3,0x01,0x9C,0x00,0x84,0x01,0x01,0x00,0x00,
+  0x84,0x01,0x82,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xB3,0x01,0x9C,0x00,0x00,0x02,0x83,0x01,0x01,0x00,0x00,0x84,0x01,
+  0x82,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xB3,0x01,0x9D,0x00,0x83,0x01,0x01,0x00,0x00,0x84,0x01,0x82,0x00,0x84,0x01,
+  0x83,0x00,0x01,0x00,0x00,0xB2,0x01,0x9E,0x00,0x83,0x01,0x01,0x00,0x00,0x84,0x01,0x82,0x00,0x84,0x01,0x83,0x00,0x01,0x00,
+  0x00,0xA2,0x01,0xAE,0x00,0x83,0x01,0x82,0x00,0x83,0x01,0x82,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xA3,0x01,0xAD,0x00,
+  0x83,0x01,0x82,0x00,0x83,0x01,0x82,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xA3,0x01,0x83,0x00,0x83,0x01,0x83,0x00,0x82,
+  0x01,0x82,0x00,0x89,0x01,0x83,0x00,0x86,0x01,0x86,0x00,0x83,0x01,0x82,0x00,0x83,0x01,0x82,0x00,0x84,0x01,0x83,0x00,0x01,
+  0x00,0x00,0xA3,0x01,0x83,0x00,0x83,0x01,0x83,0x00,0x83,0x01,0x01,0x00,0x00,0x89,0x01,0x01,0x00,0x00,0x89,0x01,0x85,0x00,
+  0x83,0x01,0x82,0x00,0x83,0x01,0x82,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xA3,0x01,0x83,0x00,0x84,0x01,0x82,0x00,0x83,
+  0x01,0x01,0x00,0x00,0x89,0x01,0x01,0x00,0x00,0x8A,0x01,0x84,0x00,0x83,0x01,0x82,0x00,0x83,0x01,0x82,0x00,0x84,0x01,0x83,
+  0x00,0x01,0x00,0x00,0xA2,0x01,0x84,0x00,0x85,0x01,0x01,0x00,0x00,0x83,0x01,0x01,0x00,0x00,0x82,0x01,0x87,0x00,0x84,0x01,
+  0x01,0x00,0x00,0x84,0x01,0x84,0x00,0x83,0x01,0x82,0x00,0x83,0x01,0x82,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xA1,0x01,
+  0x85,0x00,0x85,0x01,0x01,0x00,0x00,0x83,0x01,0x01,0x00,0x00,0x82,0x01,0x87,0x00,0x83,0x01,0x83,0x00,0x83,0x01,0x84,0x00,
+  0x83,0x01,0x01,0x00,0x00,0x84,0x01,0x82,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xA1,0x01,0x85,0x00,0x86,0x01,0x00,0x00,
+  0x83,0x01,0x01,0x00,0x00,0x88,0x01,0x01,0x00,0x00,0x83,0x01,0x8C,0x00,0x83,0x01,0x01,0x00,0x00,0x84,0x01,0x82,0x00,0x84,
+  0x01,0x83,0x00,0x01,0x00,0x00,0xA1,0x01,0x85,0x00,0x8B,0x01,0x01,0x00,0x00,0x88,0x01,0x01,0x00,0x00,0x83,0x01,0x8B,0x00,
+  0x84,0x01,0x01,0x00,0x00,0x84,0x01,0x82,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xA1,0x01,0x85,0x00,0x8B,0x01,0x01,0x00,
+  0x00,0x88,0x01,0x01,0x00,0x00,0x83,0x01,0x8B,0x00,0x84,0x01,0x01,0x00,0x00,0x84,0x01,0x82,0x00,0x84,0x01,0x83,0x00,0x01,
+  0x00,0x00,0xA1,0x01,0x85,0x00,0x8B,0x01,0x01,0x00,0x00,0x88,0x01,0x01,0x00,0x00,0x83,0x01,0x83,0x00,0x82,0x01,0x84,0x00,
+  0x83,0x01,0x02,0x02,0x00,0x00,0x83,0x01,0x83,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xA0,0x01,0x86,0x00,0x83,0x01,0x00,
+  0x00,0x86,0x01,0x01,0x00,0x00,0x82,0x01,0x87,0x00,0x83,0x01,0x83,0x00,0x83,0x01,0x82,0x00,0x00,0x02,0x83,0x01,0x82,0x00,
+  0x83,0x01,0x83,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0x9E,0x01,0x00,0x02,0x87,0x00,0x83,0x01,0x00,0x00,0x86,0x01,0x01,
+  0x00,0x00,0x82,0x01,0x87,0x00,0x84,0x01,0x01,0x00,0x00,0x84,0x01,0x82,0x00,0x84,0x01,0x01,0x00,0x00,0x84,0x01,0x83,0x00,
+  0x84,0x01,0x83,0x00,0x88,0x00,0x98,0x01,0x87,0x00,0x83,0x01,0x01,0x00,0x00,0x85,0x01,0x01,0x00,0x00,0x82,0x01,0x88,0x00,
+  0x8A,0x01,0x82,0x00,0x84,0x01,0x01,0x00,0x00,0x84,0x01,0x83,0x00,0x84,0x01,0x83,0x00,0x88,0x00,0x98,0x01,0x87,0x00,0x83,
+  0x01,0x82,0x00,0x84,0x01,0x01,0x00,0x00,0x82,0x01,0x88,0x00,0x89,0x01,0x82,0x00,0x84,0x01,0x82,0x00,0x83,0x01,0x84,0x00,
+  0x84,0x01,0x83,0x00,0x88,0x00,0x98,0x01,0x87,0x00,0x83,0x01,0x82,0x00,0x84,0x01,0x01,0x00,0x00,0x82,0x01,0x89,0x00,0x87,
+  0x01,0x82,0x00,0x00,0x03,0x84,0x01,0x01,0x00,0x00,0x84,0x01,0x84,0x00,0x84,0x01,0x83,0x00,0x88,0x00,0x98,0x01,0xAE,0x00,
+  0x83,0x01,0x82,0x00,0x84,0x01,0x84,0x00,0x84,0x01,0x83,0x00,0x89,0x00,0x96,0x01,0xB0,0x00,0x82,0x01,0x01,0x00,0x00,0x84,
+  0x01,0x85,0x00,0x84,0x01,0x83,0x00,0xD2,0x00,0x00,0x01,0x82,0x00,0x84,0x01,0x85,0x00,0x84,0x01,0x83,0x00,0xD5,0x00,0x84,
+  0x01,0x86,0x00,0x84,0x01,0x83,0x00,0xD4,0x00,0x85,0x01,0x86,0x00,0x84,0x01,0x83,0x00,0x8F,0x00,0x85,0x01,0xBE,0x00,0x84,
+  0x01,0x87,0x00,0x84,0x01,0x83,0x00,0x8F,0x00,0x84,0x01,0x00,0x02,0xBF,0x00,0x83,0x01,0x87,0x00,0x84,0x01,0x83,0x00,0x8F,
+  0x00,0x85,0x01,0xC0,0x00,0x01,0x01,0x01,0x88,0x00,0x84,0x01,0x83,0x00,0x8F,0x00,0x85,0x01,0xCB,0x00,0x84,0x01,0x83,0x00,
+  0x8F,0x00,0x86,0x01,0xC9,0x00,0x85,0x01,0x83,0x00,0x8F,0x00,0x87,0x01,0x00,0x02,0xC5,0x00,0x87,0x01,0x83,0x00,0x8F,0x00,
+  0xD6,0x01,0x83,0x00,0x90,0x00,0xD5,0x01,0x83,0x00,0x90,0x00,0xD4,0x01,0x84,0x00,0x91,0x00,0xD2,0x01,0x85,0x00,0x92,0x00,
+  0x00,0x03,0xCF,0x01,0x86,0x00,0xEA,0x00,0xEA,0x00,0xEA,0x00,
+};
+
+// putnfc0  107x64, 2 colors, 13696 -> 1139 bytes
+const uint16_t imgPal_putnfc0[2] PROGMEM = {
+  0x0000,0xCB5A,
+};
+const uint8_t imgRle_putnfc0[1135] PROGMEM = {
+  0xEA,0x00,0xEA,0x00,0xEA,0x00,0x93,0x00,0xCF,0x01,0x86,0x00,0x91,0x00,0xD2,0x01,0x85,0x00,0x90,0x00,0xD4,0x01,0x84,0x00,
+  0x90,0x00,0xD5,0x01,0x83,0x00,0x8F,0x00,0xD6,0x01,0x83,0x00,0x8F,0x00,0x88,0x01,0xC5,0x00,0x87,0x01,0x83,0x00,0x8F,0x00,
+  0x86,0x01,0xC9,0x00,0x85,0x01,0x83,0x00,0x8F,0x00,0x85,0x01,0xCB,0x00,0x84,0x01,0x83,0x00,0x8F,0x00,0x85,0x01,0xC0,0x00,
+  0x01,0x01,0x01,0x88,0x00,0x84,0x01,0x83,0x00,0x8F,0x00,0x85,0x01,0xBF,0x00,0x83,0x01,0x87,0x00,0x84,0x01,0x83,0x00,0x8F,
+  0x00,0x85,0x01,0x83,0x00,0x83,0x01,0xB6,0x00,0x84,0x01,0x87,0x00,0x84,0x01,0x83,0x00,0x98,0x00,0x85,0x01,0xB5,0x00,0x85,
+  0x01,0x86,0x00,0x84,0x01,0x83,0x00,0x97,0x00,0x87,0x01,0xB5,0x00,0x84,0x01,0x86,0x00,0x84,0x01,0x83,0x00,0x95,0x00,0x89,
+  0x01,0xB2,0x00,0x00,0x01,0x82,0x00,0x84,0x01,0x85,0x00,0x84,0x01,0x83,0x00,0x89,0x00,0x95,0x01,0xB1,0x00,0x82,0x01,0x01,
+  0x00,0x00,0x84,0x01,0x85,0x00,0x84,0x01,0x83,0x00,0x88,0x00,0x95,0x01,0xB1,0x00,0x83,0x01,0x82,0x00,0x84,0x01,0x84,0x00,
+  0x84,0x01,0x83,0x00,0x88,0x00,0x94,0x01,0xB1,0x00,0x85,0x01,0x01,0x00,0x00,0x84,0x01,0x84,0x00,0x84,0x01,0x83,0x00,0x88,
+  0x00,0x93,0x01,0xB3,0x00,0x84,0x01,0x82,0x00,0x83,0x01,0x84,0x00,0x84,0x01,0x83,0x00,0x88,0x00,0x92,0x01,0xB5,0x00,0x84,
+  0x01,0x01,0x00,0x00,0x84,0x01,0x83,0x00,0x84,0x01,0x83,0x00,0x88,0x00,0x90,0x01,0xB7,0x00,0x84,0x01,0x01,0x00,0x00,0x84,
+  0x01,0x83,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xB2,0x01,0x9C,0x00,0x84,0x01,0x82,0x00,0x83,0x01,0x83,0x00,0x84,0x01,
+  0x83,0x00,0x01,0x00,0x00,0xB3,0x01,0x9C,0x00,0x84,0x01,0x01,0x00,0x00,0x83,0x01,0x83,0x00,0x84,0x01,0x83,0x00,0x01,0x00,
+  0x00,0xB3,0x01,0x9C,0x00,0x84,0x01,0x01,0x00,0x00,0x84,0x01,0x82,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xB3,0x01,0x9C,
+  0x00,0x84,0x01,0x01,0x00,0x00,0x84,0x01,0x82,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xB3,0x01,0x9D,0x00,0x83,0x01,0x01,
+  0x00,0x00,0x84,0x01,0x82,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xB2,0x01,0x9E,0x00,0x83,0x01,0x01,0x00,0x00,0x84,0x01,
+  0x82,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xA2,0x01,0xAE,0x00,0x83,0x01,0x82,0x00,0x83,0x01,0x82,0x00,0x84,0x01,0x83,
+  0x00,0x01,0x00,0x00,0xA3,0x01,0xAD,0x00,0x83,0x01,0x82,0x00,0x83,0x01,0x82,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xA3,
+  0x01,0x83,0x00,0x83,0x01,0x83,0x00,0x82,0x01,0x82,0x00,0x89,0x01,0x83,0x00,0x86,0x01,0x86,0x00,0x83,0x01,0x82,0x00,0x83,
+  0x01,0x82,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xA3,0x01,0x83,0x00,0x83,0x01,0x83,0x00,0x83,0x01,0x01,0x00,0x00,0x89,
+  0x01,0x01,0x00,0x00,0x89,0x01,0x85,0x00,0x83,0x01,0x82,0x00,0x83,0x01,0x82,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xA3,
+  0x01,0x83,0x00,0x84,0x01,0x82,0x00,0x83,0x01,0x01,0x00,0x00,0x89,0x01,0x01,0x00,0x00,0x8A,0x01,0x84,0x00,0x83,0x01,0x82,
+  0x00,0x83,0x01,0x82,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xA2,0x01,0x84,0x00,0x85,0x01,0x01,0x00,0x00,0x83,0x01,0x01,
+  0x00,0x00,0x82,0x01,0x87,0x00,0x84,0x01,0x01,0x00,0x00,0x84,0x01,0x84,0x00,0x83,0x01,0x82,0x00,0x83,0x01,0x82,0x00,0x84,
+  0x01,0x83,0x00,0x01,0x00,0x00,0xA1,0x01,0x85,0x00,0x85,0x01,0x01,0x00,0x00,0x83,0x01,0x01,0x00,0x00,0x82,0x01,0x87,0x00,
+  0x83,0x01,0x83,0x00,0x83,0x01,0x84,0x00,0x83,0x01,0x01,0x00,0x00,0x84,0x01,0x82,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,
+  0xA1,0x01,0x85,0x00,0x86,0x01,0x00,0x00,0x83,0x01,0x01,0x00,0x00,0x88,0x01,0x01,0x00,0x00,0x83,0x01,0x8C,0x00,0x83,0x01,
+  0x01,0x00,0x00,0x84,0x01,0x82,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xA1,0x01,0x85,0x00,0x8B,0x01,0x01,0x00,0x00,0x88,
+  0x01,0x01,0x00,0x00,0x83,0x01,0x8B,0x00,0x84,0x01,0x01,0x00,0x00,0x84,0x01,0x82,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,
+  0xA1,0x01,0x85,0x00,0x8B,0x01,0x01,0x00,0x00,0x88,0x01,0x01,0x00,0x00,0x83,0x01,0x8B,0x00,0x84,0x01,0x01,0x00,0x00,0x84,
+  0x01,0x82,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0xA1,0x01,0x85,0x00,0x8B,0x01,0x01,0x00,0x00,0x88,0x01,0x01,0x00,0x00,
+  0x83,0x01,0x83,0x00,0x82,0x01,0x84,0x00,0x84,0x01,0x01,0x00,0x00,0x83,0x01,0x83,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,
+  0xA0,0x01,0x86,0x00,0x83,0x01,0x00,0x00,0x86,0x01,0x01,0x00,0x00,0x82,0x01,0x87,0x00,0x83,0x01,0x83,0x00,0x83,0x01,0x82,
+  0x00,0x84,0x01,0x82,0x00,0x83,0x01,0x83,0x00,0x84,0x01,0x83,0x00,0x01,0x00,0x00,0x9F,0x01,0x87,0x00,0x83,0x01,0x00,0x00,
+  0x86,0x01,0x01,0x00,0x00,0x82,0x01,0x87,0x00,0x84,0x01,0x01,0x00,0x00,0x84,0x01,0x82,0x00,0x84,0x01,0x01,0x00,0x00,0x84,
+  0x01,0x83,0x00,0x84,0x01,0x83,0x00,0x88,0x00,0x98,0x01,0x87,0x00,0x83,0x01,0x01,0x00,0x00,0x85,0x01,0x01,0x00,0x00,0x82,
+  0x01,0x88,0x00,0x8A,0x01,0x82,0x00,0x84,0x01,0x01,0x00,0x00,0x84,0x01,0x83,0x00,0x84,0x01,0x83,0x00,0x88,0x00,0x98,0x01,
+  0x87,0x00,0x83,0x01,0x82,0x00,0x84,0x01,0x01,0x00,0x00,0x82,0x01,0x88,0x00,0x89,0x01,0x82,0x00,0x84,0x01,0x82,0x00,0x83,
+  0x01,0x84,0x00,0x84,0x01,0x83,0x00,0x88,0x00,0x98,0x01,0x87,0x00,0x83,0x01,0x82,0x00,0x84,0x01,0x01,0x00,0x00,0x82,0x01,
+  0x89,0x00,0x87,0x01,0x82,0x00,0x85,0x01,0x01,0x00,0x00,0x84,0x01,0x84,0x00,0x84,0x01,0x83,0x00,0x88,0x00,0x98,0x01,0xAE,
+  0x00,0x83,0x01,0x82,0x00,0x84,0x01,0x84,0x00,0x84,0x01,0x83,0x00,0x89,0x00,0x96,0x01,0xB0,0x00,0x82,0x01,0x01,0x00,0x00,
+  0x84,0x01,0x85,0x00,0x84,0x01,0x83,0x00,0xD2,0x00,0x00,0x01,0x82,0x00,0x84,0x01,0x85,0x00,0x84,0x01,0x83,0x00,0xD5,0x00,
+  0x84,0x01,0x86,0x00,0x84,0x01,0x83,0x00,0xD4,0x00,0x85,0x01,0x86,0x00,0x84,0x01,0x83,0x00,0x8F,0x00,0x85,0x01,0xBE,0x00,
+  0x84,0x01,0x87,0x00,0x84,0x01,0x83,0x00,0x8F,0x00,0x85,0x01,0xBF,0x00,0x83,0x01,0x87,0x00,0x84,0x01,0x83,0x00,0x8F,0x00,
+  0x85,0x01,0xC0,0x00,0x01,0x01,0x01,0x88,0x00,0x84,0x01,0x83,0x00,0x8F,0x00,0x85,0x01,0xCB,0x00,0x84,0x01,0x83,0x00,0x8F,
+  0x00,0x86,0x01,0xC9,0x00,0x85,0x01,0x83,0x00,0x8F,0x00,0x88,0x01,0xC5,0x00,0x87,0x01,0x83,0x00,0x8F,0x00,0xD6,0x01,0x83,
+  0x00,0x90,0x00,0xD5,0x01,0x83,0x00,0x90,0x00,0xD4,0x01,0x84,0x00,0x91,0x00,0xD2,0x01,0x85,0x00,0x92,0x00,0xD0,0x01,0x86,
+  0x00,0xEA,0x00,0xEA,0x00,0xEA,0x00,
+};
@@ -0,0 +1,164 @@
+/*
+  keyshard.h
+  秘密鍵の分割保存（Shamirの秘密分散 k-of-n）
+
+  秘密鍵32byteを1byteずつGF(2^8)上のk-1次多項式で分割し、n枚のNFCカードに1個ずつ保存する
+  k枚のカードを読めば復元でき、k-1枚以下からは秘密鍵の情報は何も得られない
+  分割片は秘密鍵ファイル(SecretDef)と同じ形式で、秘密鍵と同じ方法で暗号化して保存する
+    rfui[SRFUI_SHARD_X]   分割片の番号x（1～n、0は分割していない秘密鍵）
+    rfui[SRFUI_SHARD_K]   復元に必要な枚数k
+    rfui[SRFUI_SHARD_N]   分割した枚数n
+    rfui[SRFUI_SHARD_ID]  分割ごとの識別子（別の分割で作った分割片を混ぜないため）
+  GF(2^8)の計算は秘密の値で分岐やテーブル参照をしない（処理時間が値によって変わらない）
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#pragma once
+
+#include "common.h"
+#include "mbedtls/platform_util.h"
+
+//--------------------------------------------------------------
+// GF(2^8)の掛け算（AESと同じ既約多項式 x^8+x^4+x^3+x+1）
+//--------------------------------------------------------------
+uint8_t gf256Mul(uint8_t a, uint8_t b) {
+  uint8_t p = 0;
+  for (int i=0; i<8; i++) {
+    p ^= a & (uint8_t)-(b & 1);           // bの最下位ビットが1ならaを足す
+    uint8_t carry = (uint8_t)-(a >> 7);   // aの最上位ビットが1なら既約多項式で割る
+    a = (uint8_t)(a << 1) ^ (0x1B & carry);
+    b >>= 1;
+  }
+  return p;
+}
+
+//--------------------------------------------------------------
+// GF(2^8)の逆数  a^254 = a^-1（a=0の場合は0）
+//--------------------------------------------------------------
+uint8_t gf256Inv(uint8_t a) {
+  uint8_t r = 1, s = a;
+  for (int i=1; i<8; i++) {   // a^2 * a^4 * ... * a^128
+    s = gf256Mul(s, s);
+    r = gf256Mul(r, s);
+  }
+  return r;
+}
+
+//--------------------------------------------------------------
+// 秘密鍵をn個の分割片にする（x=1～nの値をshares[0]～shares[n-1]に出力）
+//--------------------------------------------------------------
+bool shardSplit(const byte* secret, uint8_t k, uint8_t n, byte (*shares)[32]) {
+  if (secret == nullptr || shares == nullptr || k < 2 || k > n || n > SHARD_MAX) return false;
+  byte coef[SHARD_MAX - 1];
+  for (int b=0; b<32; b++) {
+    esp_fill_random(coef, k - 1);   // 1次～k-1次の係数は乱数、0次の係数が秘密鍵（0も含めて一様にする）
+    for (int i=0; i<n; i++) {
+      uint8_t x = i + 1;
+      uint8_t y = 0;
+      for (int j=k-2; j>=0; j--) y = gf256Mul(y ^ coef[j], x);  // ホーナー法
+      shares[i][b] = y ^ secret[b];
+    }
+  }
+  mbedtls_platform_zeroize(coef, sizeof(coef));
+  return true;
+}
+
+//--------------------------------------------------------------
+// k個の分割片から秘密鍵を復元する（ラグランジュ補間でx=0の値を求める）
+//--------------------------------------------------------------
+bool shardCombine(const uint8_t* xs, const byte (*ys)[32], uint8_t k, byte* secret) {
+  if (xs == nullptr || ys == nullptr || secret == nullptr || k < 2 || k > SHARD_MAX) return false;
+  memset(secret, 0, 32);
+  for (int i=0; i<k; i++) {
+    uint8_t num = 1, den = 1;
+    for (int j=0; j<k; j++) {
+      if (j == i) continue;
+      num = gf256Mul(num, xs[j]);
+      den = gf256Mul(den, xs[j] ^ xs[i]);
+    }
+    uint8_t li = gf256Mul(num, gf256Inv(den));
+    for (int b=0; b<32; b++) secret[b] ^= gf256Mul(li, ys[i][b]);
+  }
+  return true;
+}
+
+//--------------------------------------------------------------
+// 集めた分割片を消去する
+//--------------------------------------------------------------
+void shardClear(KeyShardSet* set) {
+  mbedtls_platform_zeroize(set, sizeof(KeyShardSet));
+}
+
+//--------------------------------------------------------------
+// マウント中のNFCカードから秘密鍵を読み込んで解錠する（分割片の場合は集める）
+//   戻り値: 0=解錠した、1以上=あと何枚必要か、-1=読み込めなかった
+//   分割片はどの順番でかざしてもよい。同じ分割片や別の分割の分割片は無視する
+//--------------------------------------------------------------
+int shardCollect(KeyShardSet* set) {
+  SecretDef sdef;
+  if (!readSecretDef(CONF_SECRET_NFC, &sdef)) return -1;
+
+  // 分割していない秘密鍵ならそのまま解錠する
+  uint8_t x = sdef.rfui[SRFUI_SHARD_X];
+  uint8_t k = sdef.rfui[SRFUI_SHARD_K];
+  uint8_t id = sdef.rfui[SRFUI_SHARD_ID];
+  if (x == 0) {
+    if (!loadSecretDef(&sdef)) return -1;
+    status.unlock = true;
+    unlockSessionTouch();
+    return 0;
+  }
+  if (k < 2 || k > SHARD_MAX) return -1;
+
+  // 分割片を集める
+  if (set->count == 0) {
+    set->k = k;
+    set->id = id;
+  }
+  int remain = set->k - set->count;
+  if (k != set->k || id != set->id) {
+    if (debug) spf("shardCollect: other shard set (id=%02X, k=%d)\n", id, k);
+    return remain;
+  }
+  for (int i=0; i<set->count; i++) {
+    if (set->x[i] == x) {
+      if (debug) spf("shardCollect: shard %d already read\n", x);
+      return remain;
+    }
+  }
+  if (decryptSecretDef(&sdef, set->y[set->count]) != 32) return -1;
+  set->x[set->count++] = x;
+  remain--;
+  if (debug) spf("shardCollect: shard %d/%d read, remain=%d\n", x, sdef.rfui[SRFUI_SHARD_N], remain);
+  if (remain > 0) return remain;
+
+  // 必要な枚数が揃ったら復元して解錠する
+  shardCombine(set->x, set->y, set->k, status.secret);
+  shardClear(set);
+  if (!cryptoSessionBegin(status.secret)) {
+    lockSecret();
+    return -1;
+  }
+  status.unlock = true;
+  unlockSessionTouch();
+  return 0;
+}
+
+//--------------------------------------------------------------
+// 分割片をマウント中のNFCカードに保存する（メモリ→NFC）
+//--------------------------------------------------------------
+bool saveSecretShard(const byte* share, uint8_t x, uint8_t k, uint8_t n, uint8_t id) {
+  SecretDef sdef;
+  memcpy(sdef.magic, SecretMagic, sizeof(sdef.magic));
+  sdef.rfui[SRFUI_SHARD_X] = x;
+  sdef.rfui[SRFUI_SHARD_K] = k;
+  sdef.rfui[SRFUI_SHARD_N] = n;
+  sdef.rfui[SRFUI_SHARD_ID] = id;
+  size_t enclen = encrypt((byte*)share, 32, status.iv, status.bsecret, sdef.secretEnc);
+  if (enclen != 32 || !nfc.isMounted()) return false;
+  bool res = saveSecretNfc(&sdef);
+  if (debug) spf("saveSecretShard: %d/%d (k=%d, id=%02X) %s\n", x, n, k, id, tf(res).c_str());
+  return res;
+}
@@ -0,0 +1,165 @@
+/*
+  nfcstore.h
+  NFCカードへの秘密鍵ファイルの保存と読み込み（A/Bスロット、UltralightのNDEFコンテナ、Classicのプロテクトの範囲）
+
+  NfcEasyWriterだけを使い、M5や画面を使わないので、PCでもNfcCardSimulator(test/)と組み合わせてビルドできる
+  utility.hから分けたもので、プロトタイプはcommon.hのutility.hの欄にある
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#pragma once
+#include "common.h"
+
+// メインで定義した変数を使用するためのもの
+extern NfcEasyWriter nfc;
+extern AuthKey passwdNfc;
+
+// プロテクトの範囲
+const uint8_t  prtVaddrCL = SECRET_NFC_PARTITION_ADDR;  // 物理sector=1から48バイト単位後まで
+const uint16_t prtSizeCL = ceil((double)SECRET_NFC_AREA_SIZE / 48) * 48;
+const uint8_t  prtVaddrUL = SECRET_NFC_NDEF_ADDR;  // 物理page=13以降全て（NDEFコンテナのヘッダはプロテクトしない）
+const uint16_t prtSizeUL = ceil((double)SECRET_NFC_AREA_SIZE / 16) * 16;
+
+//--------------------------------------------------------------
+// バイナリファイルを保存する(NFC)
+//--------------------------------------------------------------
+bool saveNfc(void *data, size_t dataSize, uint16_t vaddr, ProtectMode mode) {
+  if (mode == PRT_AUTO) mode = nfc._lastProtectMode;
+  bool res = nfc.writeData(vaddr, reinterpret_cast<void *>(data), dataSize, mode);
+  if (!res) {
+    if (debug) sp("saveNfc failed.");
+    return false;
+  }
+  if (debug) spf("Write %u bytes to NFC: vaddr=%d\n", (unsigned)dataSize, vaddr);
+  return true;
+}
+
+//--------------------------------------------------------------
+// バイナリファイルをA/Bスロットに保存する(NFC)
+// 古い方のスロットに書き込み、書き込んだブロックだけ読み返して確認する
+//--------------------------------------------------------------
+bool saveNfcSlot(void *data, size_t dataSize, uint16_t vaddr, ProtectMode mode) {
+  if (mode == PRT_AUTO) mode = nfc._lastProtectMode;
+  bool res = nfc.writeSlot(vaddr, SECRET_NFC_SLOT_SIZE, data, dataSize, mode);
+  if (!res) {
+    if (debug) sp("saveNfcSlot failed.");
+    return false;
+  }
+  if (debug) spf("Write %u bytes to NFC slot: vaddr=%d\n", (unsigned)dataSize, vaddr);
+  return true;
+}
+
+//--------------------------------------------------------------
+// バイナリファイルを読み込む(NFC)
+//--------------------------------------------------------------
+size_t loadNfc(void *data, size_t dataSize, uint16_t vaddr, ProtectMode mode) {
+  if (mode == PRT_AUTO) mode = nfc._lastProtectMode;
+  bool res = nfc.readData(vaddr, reinterpret_cast<void *>(data), dataSize, mode);
+  if (!res) {
+    if (debug) sp("loadNfc failed.");
+    return false;
+  }
+  if (debug) spf("Read %u bytes from NFC: vaddr=%d\n", (unsigned)dataSize, vaddr);
+  return dataSize;
+}
+
+//--------------------------------------------------------------
+// バイナリファイルをA/Bスロットの新しい方から読み込む(NFC)（有効なスロットがなければ0）
+//--------------------------------------------------------------
+size_t loadNfcSlot(void *data, size_t dataSize, uint16_t vaddr, ProtectMode mode) {
+  if (mode == PRT_AUTO) mode = nfc._lastProtectMode;
+  size_t len = nfc.readSlot(vaddr, SECRET_NFC_SLOT_SIZE, data, dataSize, mode);
+  if (debug) spf("Read %u bytes from NFC slot: vaddr=%d\n", (unsigned)len, vaddr);
+  return len;
+}
+
+//--------------------------------------------------------------
+// 秘密鍵ファイルをマウント中のNFCカードから読み込む（読み込んだバイト数を返す）
+//   UltralightはNDEFコンテナのデータ領域、なければ先頭のA/Bスロット、スロット化する前の形式の順に探す
+//   （NDEFコンテナへの移行中に途切れたUltralightは、ヘッダがなくてもデータ領域の位置のスロットを先に探す。
+//     そこに有効なスロットがあれば、移行のために書いて読み返した新しい内容）
+//--------------------------------------------------------------
+size_t loadSecretNfc(SecretDef* sdef) {
+  size_t rlen = 0;
+  uint16_t vaddr, size;
+  if (nfc.isUltralight() && nfc.findNdefContainerUL(NdefSecretType, &vaddr, &size) && size >= SECRET_NFC_AREA_SIZE) {
+    rlen = loadNfcSlot(sdef, sizeof(SecretDef), vaddr, PRT_PASSWD_RW);  // NDEFコンテナのデータ領域
+  } else {
+    if (nfc.isUltralight()) {
+      rlen = loadNfcSlot(sdef, sizeof(SecretDef), SECRET_NFC_NDEF_ADDR, PRT_PASSWD_RW);
+    }
+    if (rlen == 0) {
+      rlen = loadNfcSlot(sdef, sizeof(SecretDef), SECRET_NFC_PARTITION_ADDR, PRT_PASSWD_RW);
+    }
+    if (rlen == 0) {  // スロット化する前の形式（先頭に秘密鍵ファイルをそのまま書いたもの）
+      rlen = loadNfc(sdef, sizeof(SecretDef), SECRET_NFC_PARTITION_ADDR, PRT_PASSWD_RW);
+    }
+  }
+  return rlen;
+}
+
+//--------------------------------------------------------------
+// [Classic] A/Bスロットの範囲が全てパスワード付きでプロテクトされているか確かめ、足りなければプロテクトする
+//   スロット化する前のカードは先頭のセクタ(48バイト)だけがプロテクトの範囲なので、スロットBのセクタにかけ直す
+//   先頭のセクタがプロテクトされていないカードや、読み込み専用のセクタがあれば書き込まない
+//--------------------------------------------------------------
+bool protectSlotsNfcCL(uint16_t vaddr, uint16_t size) {
+  for (uint16_t v=vaddr; v<vaddr+size; v+=48) {
+    ProtectMode mode = nfc.readProtectModeCL(v);
+    if (debug) spf("protectSlotsNfcCL: vaddr=%d mode=%d\n", v, mode);
+    if (mode == PRT_PASSWD_RW) continue;
+    if (v == vaddr || mode != PRT_NOPASS_RW) return false;
+    if (!nfc.writeProtectCL(PRT_PASSWD_RW, &passwdNfc, v, 48, mode)) return false;
+  }
+  return true;
+}
+
+//--------------------------------------------------------------
+// [Ultralight] NDEFコンテナがまだないカードに秘密鍵ファイルを保存して、NDEFコンテナに移行する
+//   旧形式（先頭の秘密鍵ファイル 0～39、A/Bスロット 0～95）はNDEFヘッダ(0～31)やデータ領域(32～127)と重なるので、
+//   どこで途切れても有効な秘密鍵ファイルが1つは残る順に書く
+//   1. 旧スロットBが最新なら、旧スロットAに書いて最新の内容を0～47に置く
+//   2. データ領域のスロットB(80～127)に書いて読み返す（0～47と重ならない）
+//   3. 最後にNDEFヘッダを書く（途中で途切れても、loadSecretNfc()はデータ領域の位置のスロットを探す）
+//   前回の移行が2.の後で途切れていたら、データ領域のスロットは有効なので、1.2.の代わりに古い方のスロットに書く
+//--------------------------------------------------------------
+bool migrateSecretNfcUL(SecretDef* sdef) {
+  SecretDef cur;
+  int8_t latestNew = -1, latestOld = -1;
+  nfc.readSlot(SECRET_NFC_NDEF_ADDR, SECRET_NFC_SLOT_SIZE, &cur, sizeof(cur), PRT_PASSWD_RW, &latestNew);
+  if (latestNew < 0) nfc.readSlot(SECRET_NFC_PARTITION_ADDR, SECRET_NFC_SLOT_SIZE, &cur, sizeof(cur), PRT_PASSWD_RW, &latestOld);
+  // 読んだ秘密鍵ファイルを消す（この後は使わないので、最適化で省かれないようにvolatileで書く）
+  volatile byte* wipe = reinterpret_cast<volatile byte*>(&cur);
+  for (size_t i=0; i<sizeof(cur); i++) wipe[i] = 0;
+  if (debug) spf("migrateSecretNfcUL: latest slot new=%d old=%d\n", latestNew, latestOld);
+  if (latestNew >= 0) {
+    if (!saveNfcSlot(sdef, sizeof(SecretDef), SECRET_NFC_NDEF_ADDR, PRT_PASSWD_RW)) return false;
+  } else {
+    if (latestOld == 1 && !saveNfcSlot(sdef, sizeof(SecretDef), SECRET_NFC_PARTITION_ADDR, PRT_PASSWD_RW)) return false;
+    if (!nfc.writeSlot(SECRET_NFC_NDEF_ADDR, SECRET_NFC_SLOT_SIZE, sdef, sizeof(SecretDef), PRT_PASSWD_RW, 1)) return false;
+  }
+  uint16_t vaddr;
+  bool res = nfc.writeNdefContainerUL(NdefSecretType, NdefSecretInfo, sizeof(NdefSecretInfo), SECRET_NFC_AREA_SIZE, &vaddr, PRT_PASSWD_RW);
+  if (debug) spf("writeNdefContainerUL: %d vaddr=%d\n", res, vaddr);
+  return res && vaddr == SECRET_NFC_NDEF_ADDR;
+}
+
+//--------------------------------------------------------------
+// 秘密鍵ファイルをマウント中のNFCカードに保存する
+//   Ultralightはスマホからも正常なNDEFに見えるように、NDEFコンテナのデータ領域にA/Bスロットを置く
+//   （NDEFのレコードは外部タイプの目印だけで、秘密鍵ファイルはプロテクトしたProprietary TLVの中）
+//--------------------------------------------------------------
+bool saveSecretNfc(SecretDef* sdef) {
+  if (!nfc.isMounted()) return false;
+  if (nfc.isUltralight()) {
+    uint16_t vaddr, size;
+    if (!nfc.findNdefContainerUL(NdefSecretType, &vaddr, &size)) return migrateSecretNfcUL(sdef);
+    if (vaddr != SECRET_NFC_NDEF_ADDR || size < SECRET_NFC_AREA_SIZE) return false;  // プロテクトの範囲と一致しなければ書かない
+    return saveNfcSlot(sdef, sizeof(SecretDef), vaddr, PRT_PASSWD_RW);  // 書き込んだスロットは読み返して確認される
+  }
+  // Classicはスロットの範囲をプロテクトしてから書く（スロット化する前のカードは、最初はスロットBに書くので先頭の秘密鍵ファイルが残る）
+  if (!protectSlotsNfcCL(SECRET_NFC_PARTITION_ADDR, SECRET_NFC_AREA_SIZE)) return false;
+  return saveNfcSlot(sdef, sizeof(SecretDef), SECRET_NFC_PARTITION_ADDR, PRT_PASSWD_RW);
+}
@@ -0,0 +1,629 @@
+/*
+  otpvault.h
+  OTPの保存ファイル（全アカウントを1つのファイルにまとめたもの）
+
+  ファイル構成 /otp_vault.bin
+    ヘッダ    16byte  VaultHeader
+    レコード 160byte × slots  TotpParams（secretは暗号化済み）、version=0は削除済み
+      version 1  secretをAES-CBCで暗号化（旧形式。アンロック後に最初に使うときにversion 2へ変換する）
+      version 2  secretをAES-GCMで暗号化。nonceはレコードごと、tagは他の項目(AAD)も含めて認証する
+  追加は末尾に書いてからヘッダのslotsを更新する（ヘッダの更新で確定）
+  発行者とアカウントの索引と選択メニューは最初に使うときに一度だけ作り、
+  以降は追加・削除のたびに差分だけ更新する。Webからファイルが変更された場合は破棄する
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#pragma once
+
+#include "common.h"
+#include <FFat.h>
+#include <functional>
+
+#define VAULT_HEADER_SIZE  16
+#define VAULT_RECORD_SIZE  sizeof(TotpParams)
+#define VAULT_COMPACT_MIN  8    // 削除済みがこれ以上かつ半分以上になったら詰め直す
+#define VAULT_READ_BATCH   8    // 全件を読むときに1回で読み込むレコード数
+#define OTP_RECORD_AAD_SIZE  (1 + 32 + 32 + 3)  // 認証する平文の項目（version, issuer, account, algorithm, digit, period）
+
+// ヘッダ
+struct VaultHeader {
+  byte     magic[4] = {0};   // VaultMagic
+  uint16_t recordSize = 0;   // レコードのサイズ
+  uint16_t slots = 0;        // レコード数（削除済みを含む）
+  byte     rfui[8] = {0};    // 予約
+};
+static_assert(sizeof(VaultHeader) == VAULT_HEADER_SIZE, "VaultHeader size");
+
+// 保存ファイルの状態と索引
+std::vector<OtpIndex> vaultIndex;   // 有効なレコードの索引
+uint16_t vaultSlots = 0;            // レコード数（削除済みを含む）
+uint16_t vaultTombstones = 0;       // 削除済みのレコード数
+uint16_t vaultCbcRecords = 0;       // version 1（AES-CBC）のレコード数
+bool vaultReady = false;            // 保存ファイルが使用可能
+bool vaultIndexLoaded = false;      // 索引を読み込み済み
+MenuDef vaultMenu;                  // OTPの選択メニュー（"戻る"＋索引の順）
+bool vaultMenuValid = false;        // 選択メニューを作成済み
+bool vaultLoadIndex();
+void vaultInvalidate();
+
+//--------------------------------------------------------------
+// 索引の1件分を作る
+//--------------------------------------------------------------
+OtpIndex makeOtpIndex(uint16_t slot, const TotpParams* tp) {
+  OtpIndex idx;
+  idx.slot = slot;
+  idx.period = tp->period;
+  memcpy(idx.issuer, tp->issuer, sizeof(idx.issuer));
+  memcpy(idx.account, tp->account, sizeof(idx.account));
+  idx.issuer[sizeof(idx.issuer)-1] = '\0';
+  idx.account[sizeof(idx.account)-1] = '\0';
+  return idx;
+}
+
+//--------------------------------------------------------------
+// 選択メニューの1件分を作る
+//--------------------------------------------------------------
+ItemDef makeOtpMenuItem(const OtpIndex* idx) {
+  return { 0, 0, String(idx->issuer) + " " + String(idx->account), nullptr, "" };
+}
+
+//--------------------------------------------------------------
+// 保存ファイルのヘッダと索引を読み込む
+//   ファイルを1回開いて先頭から順に読むだけ。ヘッダが不正な場合はfalse
+//--------------------------------------------------------------
+bool vaultReadIndex(String path, VaultHeader* header, std::vector<OtpIndex>* index, uint16_t* tombstones, uint16_t* cbcRecords=nullptr) {
+  File file = FFat.open(path, FILE_READ);
+  if (!file) return false;
+  bool res = (file.read(reinterpret_cast<uint8_t*>(header), sizeof(VaultHeader)) == sizeof(VaultHeader)
+           && memcmp(header->magic, VaultMagic, sizeof(VaultMagic)) == 0
+           && header->recordSize == VAULT_RECORD_SIZE);
+  if (res) {
+    // ファイルサイズより多いslotsは書き込み途中の電源断なので切り詰める
+    size_t fit = (file.size() - VAULT_HEADER_SIZE) / VAULT_RECORD_SIZE;
+    if (header->slots > fit) header->slots = fit;
+    index->clear();
+    index->reserve(header->slots);
+    *tombstones = 0;
+    if (cbcRecords != nullptr) *cbcRecords = 0;
+    TotpParams tp;
+    for (uint16_t slot=0; slot<header->slots; slot++) {
+      if (file.read(reinterpret_cast<uint8_t*>(&tp), VAULT_RECORD_SIZE) != VAULT_RECORD_SIZE) {
+        header->slots = slot;
+        break;
+      }
+      if (tp.version == 0) {
+        (*tombstones) ++;
+      } else {
+        index->push_back(makeOtpIndex(slot, &tp));
+        if (tp.version == OTP_RECORD_CBC && cbcRecords != nullptr) (*cbcRecords) ++;
+      }
+    }
+    memset(tp.secret, 0, sizeof(tp.secret));
+  }
+  file.close();
+  return res;
+}
+
+//--------------------------------------------------------------
+// 空の保存ファイルを作成する
+//--------------------------------------------------------------
+bool vaultCreate(String path) {
+  VaultHeader header;
+  memcpy(header.magic, VaultMagic, sizeof(VaultMagic));
+  header.recordSize = VAULT_RECORD_SIZE;
+  header.slots = 0;
+  return saveFile(&header, sizeof(header), path);
+}
+
+//--------------------------------------------------------------
+// 保存ファイルの末尾にレコードを追加する（暗号化済みのレコードを渡す）
+//   全て書き込めた後にヘッダを更新するので、途中で失敗しても追加分は無効のまま
+//--------------------------------------------------------------
+bool vaultAppend(String path, const TotpParams* records, size_t count, uint16_t* slots) {
+  if ((size_t)*slots + count > UINT16_MAX) return false;
+  File file = FFat.open(path, "r+");
+  if (!file) return false;
+  bool res = file.seek(VAULT_HEADER_SIZE + (size_t)*slots * VAULT_RECORD_SIZE);
+  if (res) {
+    size_t len = count * VAULT_RECORD_SIZE;
+    res = (file.write(reinterpret_cast<const uint8_t*>(records), len) == len);
+  }
+  if (res) {
+    file.flush();
+    VaultHeader header;
+    memcpy(header.magic, VaultMagic, sizeof(VaultMagic));
+    header.recordSize = VAULT_RECORD_SIZE;
+    header.slots = *slots + count;
+    res = file.seek(0) && (file.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header)) == sizeof(header));
+    if (res) *slots = header.slots;
+  }
+  file.close();
+  if (debug) spf("vaultAppend %u records: %s\n", (unsigned)count, tf(res).c_str());
+  return res;
+}
+
+//--------------------------------------------------------------
+// 保存ファイルからレコードを1件読み込む（暗号化されたまま）
+//--------------------------------------------------------------
+bool vaultReadRecord(String path, uint16_t slot, TotpParams* tp) {
+  File file = FFat.open(path, FILE_READ);
+  if (!file) return false;
+  bool res = file.seek(VAULT_HEADER_SIZE + (size_t)slot * VAULT_RECORD_SIZE)
+          && file.read(reinterpret_cast<uint8_t*>(tp), VAULT_RECORD_SIZE) == VAULT_RECORD_SIZE;
+  file.close();
+  return res;
+}
+
+//--------------------------------------------------------------
+// 削除済みのレコードを詰めて保存ファイルを作り直す
+//   一時ファイルに書いてから置き換える。置き換え前に電源が切れた場合はvaultBegin()で復旧する
+//--------------------------------------------------------------
+bool vaultCompact() {
+  File src = FFat.open(FN_OTPVAULT, FILE_READ);
+  if (!src) return false;
+  File dst = FFat.open(FN_OTPVAULT_TMP, FILE_WRITE);
+  if (!dst) {
+    src.close();
+    return false;
+  }
+  VaultHeader header;
+  memcpy(header.magic, VaultMagic, sizeof(VaultMagic));
+  header.recordSize = VAULT_RECORD_SIZE;
+  header.slots = 0;
+  bool res = (dst.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header)) == sizeof(header));
+  TotpParams tp;
+  src.seek(VAULT_HEADER_SIZE);
+  for (uint16_t slot=0; res && slot<vaultSlots; slot++) {
+    if (src.read(reinterpret_cast<uint8_t*>(&tp), VAULT_RECORD_SIZE) != VAULT_RECORD_SIZE) res = false;
+    else if (tp.version == 0) continue;
+    else if (dst.write(reinterpret_cast<const uint8_t*>(&tp), VAULT_RECORD_SIZE) != VAULT_RECORD_SIZE) res = false;
+    else header.slots ++;
+  }
+  memset(tp.secret, 0, sizeof(tp.secret));
+  if (res) res = dst.seek(0) && (dst.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header)) == sizeof(header));
+  src.close();
+  dst.close();
+
+  // 置き換え
+  if (res) res = FFat.remove(FN_OTPVAULT) && FFat.rename(FN_OTPVAULT_TMP, FN_OTPVAULT);
+  else FFat.remove(FN_OTPVAULT_TMP);
+  if (debug) spf("vaultCompact %d -> %d slots: %s\n", vaultSlots, header.slots, tf(res).c_str());
+  if (!res) return false;
+  // 順番は変わらないのでメニューはそのまま使える
+  VaultHeader rh;
+  if (!vaultReadIndex(FN_OTPVAULT, &rh, &vaultIndex, &vaultTombstones, &vaultCbcRecords)) {
+    vaultInvalidate();
+    return false;
+  }
+  vaultSlots = rh.slots;
+  return true;
+}
+
+//--------------------------------------------------------------
+// 旧形式（1アカウント1ファイルの otp-*.bin）を保存ファイルに移行する
+//   暗号化されたまま複写するので秘密鍵は不要。移行後に旧ファイルを削除する
+//   読めなかったファイル（大きさやバージョンが違う）は削除せずに残す
+//--------------------------------------------------------------
+int vaultMigrateLegacy() {
+  std::vector<String> files = listOtpFiles();
+  if (files.size() == 0) return 0;
+
+  // 旧ファイルを読み込む（前回の移行が途中で止まった場合に備えて、同じレコードは除く）
+  std::vector<TotpParams> records;
+  std::vector<String> migrated;   // 追加するか、すでに保存ファイルにあるファイル（移行後に削除する）
+  TotpParams tp, cur;
+  for (String& filename : files) {
+    int size = getFileSize(filename);
+    if (size != VAULT_RECORD_SIZE) {
+      if (debug) spf("vaultMigrateLegacy: skip %s (size %d)\n", filename.c_str(), size);
+      continue;
+    }
+    if (loadFile(&tp, VAULT_RECORD_SIZE, filename) != VAULT_RECORD_SIZE || tp.version != OTP_RECORD_CBC) {
+      if (debug) spf("vaultMigrateLegacy: skip %s (read failed or version %d)\n", filename.c_str(), tp.version);
+      continue;
+    }
+    migrated.push_back(filename);
+    bool exists = false;
+    for (OtpIndex& idx : vaultIndex) {
+      if (strcmp(idx.issuer, tp.issuer) != 0 || strcmp(idx.account, tp.account) != 0) continue;
+      if (vaultReadRecord(FN_OTPVAULT, idx.slot, &cur) && memcmp(&cur, &tp, VAULT_RECORD_SIZE) == 0) {
+        exists = true;
+        break;
+      }
+    }
+    if (!exists) records.push_back(tp);
+  }
+
+  // まとめて追加し、成功したら旧ファイルを削除する
+  uint16_t first = vaultSlots;
+  bool res = (records.size() == 0) || vaultAppend(FN_OTPVAULT, records.data(), records.size(), &vaultSlots);
+  if (res) {
+    for (size_t i=0; i<records.size(); i++) vaultIndex.push_back(makeOtpIndex(first + i, &records[i]));
+    vaultCbcRecords += records.size();
+    for (String& filename : migrated) deleteFile(filename);
+  }
+  if (debug) spf("vaultMigrateLegacy %u files (%u skipped) -> %u records: %s\n", (unsigned)files.size(), (unsigned)(files.size() - migrated.size()), (unsigned)records.size(), tf(res).c_str());
+  return res ? records.size() : -1;
+}
+
+//--------------------------------------------------------------
+// 保存ファイルを開く（起動時とフォーマット後に呼ぶ）
+//   索引は最初に使うときに読み込む
+//--------------------------------------------------------------
+bool vaultBegin() {
+  vaultInvalidate();
+  vaultReady = false;
+
+  // 詰め直しの途中で止まっていた場合は一時ファイルから復旧する
+  bool exists = FFat.exists(FN_OTPVAULT);
+  if (FFat.exists(FN_OTPVAULT_TMP)) {
+    if (exists) FFat.remove(FN_OTPVAULT_TMP);
+    else exists = FFat.rename(FN_OTPVAULT_TMP, FN_OTPVAULT);
+  }
+  if (!exists && !vaultCreate(FN_OTPVAULT)) {
+    if (debug) sp("vaultBegin: cannot create "+FN_OTPVAULT);
+    return false;
+  }
+  vaultReady = true;
+  return true;
+}
+
+//--------------------------------------------------------------
+// 索引とメニューを破棄する（Webからファイルがアップロード・削除された場合など）
+//--------------------------------------------------------------
+void vaultInvalidate() {
+  vaultIndex.clear();
+  vaultIndex.shrink_to_fit();
+  vaultMenu.lists.clear();
+  vaultMenu.lists.shrink_to_fit();
+  vaultSlots = 0;
+  vaultTombstones = 0;
+  vaultCbcRecords = 0;
+  vaultIndexLoaded = false;
+  vaultMenuValid = false;
+}
+
+//--------------------------------------------------------------
+// 索引を読み込む（読み込み済みなら何もしない）
+//   旧形式のファイルがあればここで移行する
+//--------------------------------------------------------------
+bool vaultLoadIndex() {
+  if (vaultIndexLoaded) return true;
+  if (!vaultReady && !vaultBegin()) return false;
+  if (!FFat.exists(FN_OTPVAULT) && !vaultCreate(FN_OTPVAULT)) return false;  // Webから削除された場合
+
+  VaultHeader header;
+  uint32_t tm = micros();
+  if (!vaultReadIndex(FN_OTPVAULT, &header, &vaultIndex, &vaultTombstones, &vaultCbcRecords)) {
+    if (debug) sp("vaultLoadIndex: invalid header "+FN_OTPVAULT);   // 壊れたファイルは上書きしない
+    vaultIndex.clear();
+    return false;
+  }
+  vaultSlots = header.slots;
+  vaultIndexLoaded = true;
+  if (debug) spf("vaultLoadIndex: %u records, %u deleted, %u CBC, %u us\n", (unsigned)vaultIndex.size(), (unsigned)vaultTombstones, (unsigned)vaultCbcRecords, (unsigned)(micros() - tm));
+
+  // 旧形式からの移行と詰め直し
+  vaultMigrateLegacy();
+  if (vaultTombstones >= VAULT_COMPACT_MIN && vaultTombstones * 2 >= vaultSlots) vaultCompact();
+  return true;
+}
+
+//--------------------------------------------------------------
+// OTPの一覧を取得する（メモリ上の索引を返す）
+//--------------------------------------------------------------
+const std::vector<OtpIndex>& getOtpIndex() {
+  vaultLoadIndex();
+  return vaultIndex;
+}
+
+//--------------------------------------------------------------
+// OTPの選択メニューを取得する（先頭は"戻る"、以降は索引と同じ順）
+//   メニューは一度だけ作り、以降は選択状態を初期化して同じものを返す
+//--------------------------------------------------------------
+MenuDef* getOtpMenu(String title, int select) {
+  vaultLoadIndex();
+  if (!vaultMenuValid) {
+    vaultMenu.lists.clear();
+    vaultMenu.lists.reserve(vaultIndex.size() + 1);
+    vaultMenu.lists.push_back({ 0, 0, "戻る", nullptr, "" });
+    for (OtpIndex& idx : vaultIndex) vaultMenu.lists.push_back(makeOtpMenuItem(&idx));
+    vaultMenuValid = true;
+  }
+  vaultMenu.title = title;
+  vaultMenu.select = select;
+  vaultMenu.selected = -1;
+  vaultMenu.idx = 0;
+  vaultMenu.cur = select;
+  return &vaultMenu;
+}
+
+//--------------------------------------------------------------
+// レコードの認証する項目（AAD）を並べる　secretとnonce/tag以外の全て
+//--------------------------------------------------------------
+void otpRecordAad(const TotpParams* tp, byte* aad) {
+  aad[0] = tp->version;
+  memcpy(aad + 1, tp->issuer, sizeof(TotpParams::issuer));
+  memcpy(aad + 33, tp->account, sizeof(TotpParams::account));
+  aad[65] = tp->algorithm;
+  aad[66] = tp->digit;
+  aad[67] = tp->period;
+}
+
+//--------------------------------------------------------------
+// 復号化したsecretがBase32の文字列と0埋めになっているか調べる
+//   version 1（AES-CBC）は復号化に失敗しないので、違う秘密鍵で復号化したかどうかはこれで判断する
+//--------------------------------------------------------------
+bool otpSecretIsBase32(const char* secret, size_t size) {
+  size_t len = 0;
+  while (len < size && secret[len] != '\0') {
+    char c = secret[len];
+    bool ok = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '2' && c <= '7') || c == '=' || c == ' ' || c == '-';
+    if (!ok) return false;
+    len ++;
+  }
+  if (len == 0 || len == size) return false;
+  for (size_t i=len; i<size; i++) {
+    if (secret[i] != '\0') return false;
+  }
+  return true;
+}
+
+//--------------------------------------------------------------
+// 保存形式のレコードを検証して復号化する（encとtpは別のバッファ）
+//   version 2は認証タグを検証し、改ざんされていればfalse
+//   version 1は復号化して、secretがBase32でなければfalse（違うカードでアンロックした場合）
+//--------------------------------------------------------------
+bool openOtpRecord(const TotpParams* enc, TotpParams* tp) {
+  *tp = *enc;
+  size_t seclen = sizeof(TotpParams::secret);
+  bool res = false;
+  if (enc->version == OTP_RECORD_GCM) {
+    byte aad[OTP_RECORD_AAD_SIZE];
+    otpRecordAad(enc, aad);
+    res = sessionOpen(enc->nonce, aad, sizeof(aad), reinterpret_cast<const byte*>(enc->secret), seclen, enc->tag, reinterpret_cast<byte*>(tp->secret));
+  } else if (enc->version == OTP_RECORD_CBC) {
+    res = (sessionDecrypt(reinterpret_cast<byte*>(tp->secret), reinterpret_cast<const byte*>(enc->secret), seclen, status.iv) == seclen);
+    res = res && otpSecretIsBase32(tp->secret, seclen);
+  }
+  tp->secret[seclen-1] = '\0';
+  if (!res) memset(tp->secret, 0, seclen);
+  return res;
+}
+
+//--------------------------------------------------------------
+// OTPを暗号化して保存形式にする（version 2）
+//--------------------------------------------------------------
+bool encryptOtpRecord(const TotpParams* tp, TotpParams* enc) {
+  *enc = *tp;
+  enc->version = OTP_RECORD_GCM;
+  esp_fill_random(enc->nonce, sizeof(enc->nonce));
+  byte aad[OTP_RECORD_AAD_SIZE];
+  otpRecordAad(enc, aad);
+  size_t len = sizeof(TotpParams::secret);
+  bool res = sessionSeal(enc->nonce, aad, sizeof(aad), reinterpret_cast<const byte*>(tp->secret), len, reinterpret_cast<byte*>(enc->secret), enc->tag); // 暗号化
+  if (!res) memset(enc->secret, 0, len);
+  return res;
+}
+
+//--------------------------------------------------------------
+// 保存ファイルの全レコードを先頭から順に読み、検証・復号化してvisitに渡す
+//   ファイルを1回だけ開き、VAULT_READ_BATCH件ずつまとめて読み込んでから続けて復号化する
+//   visit(slot, 保存形式, 復号化したもの)　削除済みと検証失敗は復号化したものがnullptr
+//   visitがfalseを返したら中断する。検証に失敗したレコード数を返す（ファイルが読めなければ-1）
+//--------------------------------------------------------------
+int vaultOpenRecords(String path, uint16_t slots, std::function<bool(uint16_t, const TotpParams*, TotpParams*)> visit) {
+  File file = FFat.open(path, FILE_READ);
+  if (!file) return -1;
+  if (!file.seek(VAULT_HEADER_SIZE)) {
+    file.close();
+    return -1;
+  }
+  TotpParams batch[VAULT_READ_BATCH];
+  TotpParams tp;
+  int failed = 0;
+  bool stop = false;
+  for (uint16_t slot=0; !stop && slot<slots; ) {
+    size_t n = (slots - slot < VAULT_READ_BATCH) ? (slots - slot) : VAULT_READ_BATCH;
+    if (file.read(reinterpret_cast<uint8_t*>(batch), n * VAULT_RECORD_SIZE) != n * VAULT_RECORD_SIZE) {
+      failed = -1;
+      break;
+    }
+    for (size_t i=0; !stop && i<n; i++, slot++) {
+      bool ok = (batch[i].version != 0) && openOtpRecord(&batch[i], &tp);
+      if (batch[i].version != 0 && !ok) {
+        failed ++;
+        if (debug) spf("vaultOpenRecords: slot %d verify failed!\n", slot);
+      }
+      stop = !visit(slot, &batch[i], (ok ? &tp : nullptr));
+    }
+  }
+  file.close();
+  memset(tp.secret, 0, sizeof(tp.secret));
+  return failed;
+}
+
+//--------------------------------------------------------------
+// version 1（AES-CBC）のレコードをversion 2（AES-GCM）に変換する
+//   秘密鍵が必要なのでアンロック後に行う。slotの番号は変えず、一時ファイルに書いてから置き換える
+//   復号化できないレコードが1件でもあれば中断して、ファイルはそのまま残す
+//   （違うカードでアンロックしたときに、壊れたsecretを認証付きで保存し直してしまわないように）
+//--------------------------------------------------------------
+bool vaultUpgradeRecords() {
+  if (!status.unlock || vaultCbcRecords == 0) return true;
+  File dst = FFat.open(FN_OTPVAULT_TMP, FILE_WRITE);
+  if (!dst) return false;
+  VaultHeader header;
+  memcpy(header.magic, VaultMagic, sizeof(VaultMagic));
+  header.recordSize = VAULT_RECORD_SIZE;
+  header.slots = vaultSlots;
+  bool res = (dst.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header)) == sizeof(header));
+  int upgraded = 0;
+  TotpParams enc;
+  int failed = vaultOpenRecords(FN_OTPVAULT, vaultSlots, [&](uint16_t slot, const TotpParams* raw, TotpParams* tp) {
+    const TotpParams* out = raw;
+    if (raw->version != 0 && tp == nullptr) {
+      res = false;
+      return false;
+    }
+    if (raw->version == OTP_RECORD_CBC) {
+      if (!encryptOtpRecord(tp, &enc)) {
+        res = false;
+        return false;
+      }
+      out = &enc;
+      upgraded ++;
+    }
+    res = res && (dst.write(reinterpret_cast<const uint8_t*>(out), VAULT_RECORD_SIZE) == VAULT_RECORD_SIZE);
+    return res;
+  });
+  memset(enc.secret, 0, sizeof(enc.secret));
+  dst.close();
+  res = res && (failed >= 0);
+
+  // 置き換え（途中で電源が切れた場合はvaultBegin()で復旧する）
+  if (res) res = FFat.remove(FN_OTPVAULT) && FFat.rename(FN_OTPVAULT_TMP, FN_OTPVAULT);
+  else FFat.remove(FN_OTPVAULT_TMP);
+  if (debug) spf("vaultUpgradeRecords %d records: %s\n", upgraded, tf(res).c_str());
+  if (res) vaultCbcRecords = 0;
+  return res;
+}
+
+//--------------------------------------------------------------
+// OTPを読み込む
+//--------------------------------------------------------------
+bool loadOtpRecord(uint16_t slot, TotpParams* tp, bool decryptSecret) {
+  if (decryptSecret && !status.unlock) return false;
+  if (!vaultLoadIndex() || slot >= vaultSlots) return false;
+  if (decryptSecret) vaultUpgradeRecords();
+  TotpParams enc;
+  if (!vaultReadRecord(FN_OTPVAULT, slot, &enc)) return false;
+  if (enc.version != OTP_RECORD_CBC && enc.version != OTP_RECORD_GCM) return false;
+
+  // "tp.secret"を検証して複合化する
+  if (decryptSecret) {
+    bool res = openOtpRecord(&enc, tp);
+    memset(enc.secret, 0, sizeof(enc.secret));
+    if (debug && !res) spf("loadOtpRecord: slot %d verify failed!\n", slot);
+    return res;
+  }
+  *tp = enc;
+  memset(tp->secret, 0, sizeof(TotpParams::secret));
+  return true;
+}
+
+//--------------------------------------------------------------
+// 同じOTP（発行者、アカウント、秘密鍵が同じ）が保存済みか探す　見つからなければ-1
+//--------------------------------------------------------------
+int findOtpRecord(const TotpParams* tp) {
+  if (!vaultLoadIndex()) return -1;
+  int found = -1;
+  bool named = false;   // 発行者とアカウントが同じものがなければ復号化せずに終わる
+  for (OtpIndex& idx : vaultIndex) {
+    if (strcmp(idx.issuer, tp->issuer) == 0 && strcmp(idx.account, tp->account) == 0) named = true;
+  }
+  if (!named) return -1;
+  vaultOpenRecords(FN_OTPVAULT, vaultSlots, [&](uint16_t slot, const TotpParams* raw, TotpParams* cur) {
+    if (cur != nullptr && strcmp(cur->issuer, tp->issuer) == 0 && strcmp(cur->account, tp->account) == 0
+     && strcmp(cur->secret, tp->secret) == 0) found = slot;
+    return (found < 0);
+  });
+  return found;
+}
+
+//--------------------------------------------------------------
+// 複数のOTPをまとめて保存する
+//   保存済みのもの、同じものは追加しない。書き込みは1回で、失敗したら1件も追加されない
+//--------------------------------------------------------------
+bool saveOtpRecords(std::vector<TotpParams>* tps, int* added, int* duplicated) {
+  *added = 0;
+  *duplicated = 0;
+  if (!status.unlock || !vaultLoadIndex()) return false;
+  vaultUpgradeRecords();
+
+  // 保存済みのものを探す（全件を1回だけ検証・復号化して比較する）
+  std::vector<bool> saved(tps->size(), false);
+  if (vaultIndex.size() > 0) {
+    vaultOpenRecords(FN_OTPVAULT, vaultSlots, [&](uint16_t slot, const TotpParams* raw, TotpParams* cur) {
+      if (cur == nullptr) return true;
+      for (size_t i=0; i<tps->size(); i++) {
+        TotpParams* tp = &(*tps)[i];
+        if (strcmp(cur->issuer, tp->issuer) == 0 && strcmp(cur->account, tp->account) == 0 && strcmp(cur->secret, tp->secret) == 0) saved[i] = true;
+      }
+      return true;
+    });
+  }
+
+  // 暗号化（保存済みと、今回の中での重複は除く）
+  std::vector<TotpParams> records;
+  records.reserve(tps->size());
+  for (size_t i=0; i<tps->size(); i++) {
+    TotpParams* tp = &(*tps)[i];
+    bool dup = saved[i];
+    for (size_t j=0; !dup && j<i; j++) {
+      TotpParams* prev = &(*tps)[j];
+      dup = (strcmp(prev->issuer, tp->issuer) == 0 && strcmp(prev->account, tp->account) == 0 && strcmp(prev->secret, tp->secret) == 0);
+    }
+    if (dup) {
+      (*duplicated) ++;
+      continue;
+    }
+    TotpParams enc;
+    if (!encryptOtpRecord(tp, &enc)) return false;
+    records.push_back(enc);
+  }
+  if (records.size() == 0) return true;
+
+  // 追加
+  uint16_t first = vaultSlots;
+  if (!vaultAppend(FN_OTPVAULT, records.data(), records.size(), &vaultSlots)) return false;
+  for (size_t i=0; i<records.size(); i++) {
+    vaultIndex.push_back(makeOtpIndex(first + i, &records[i]));
+    if (vaultMenuValid) vaultMenu.lists.push_back(makeOtpMenuItem(&vaultIndex.back()));
+  }
+  *added = records.size();
+  return true;
+}
+
+//--------------------------------------------------------------
+// OTPを1件保存する　保存した（または保存済みの）slotを返す。失敗したら-1
+//--------------------------------------------------------------
+int saveOtpRecord(TotpParams* tp) {
+  int slot = findOtpRecord(tp);
+  if (slot >= 0) return slot;
+  std::vector<TotpParams> tps = { *tp };
+  int added, duplicated;
+  bool res = saveOtpRecords(&tps, &added, &duplicated);
+  memset(tps[0].secret, 0, sizeof(TotpParams::secret));
+  return (res && added == 1) ? vaultSlots - 1 : -1;
+}
+
+//--------------------------------------------------------------
+// OTPを削除する　レコードを0で上書きして削除済みにする
+//--------------------------------------------------------------
+bool deleteOtpRecord(uint16_t slot) {
+  if (!vaultLoadIndex() || slot >= vaultSlots) return false;
+  File file = FFat.open(FN_OTPVAULT, "r+");
+  if (!file) return false;
+  // TotpParamsは初期値がversion=1などなので、0で埋めたバイト列を書く（version=0で削除済みになる）
+  uint8_t blank[VAULT_RECORD_SIZE] = {0};
+  bool res = file.seek(VAULT_HEADER_SIZE + (size_t)slot * VAULT_RECORD_SIZE)
+          && file.write(blank, VAULT_RECORD_SIZE) == VAULT_RECORD_SIZE;
+  file.close();
+  if (debug) spf("deleteOtpRecord slot=%d: %s\n", slot, tf(res).c_str());
+  if (!res) return false;
+
+  // 索引とメニューから削除
+  for (size_t i=0; i<vaultIndex.size(); i++) {
+    if (vaultIndex[i].slot == slot) {
+      vaultIndex.erase(vaultIndex.begin() + i);
+      if (vaultMenuValid) vaultMenu.lists.erase(vaultMenu.lists.begin() + i + 1);
+      break;
+    }
+  }
+  vaultTombstones ++;
+  if (vaultTombstones >= VAULT_COMPACT_MIN && vaultTombstones * 2 >= vaultSlots) vaultCompact();
+  return true;
+}
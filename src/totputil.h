@@ -9,6 +9,7 @@
   参考ページ
     TOTPのURIの仕様 https://github.com/google/google-authenticator/wiki/Key-Uri-Format
     TOTP QRジェネレーター https://stefansundin.github.io/2fa-qr/
+    Google Authenticatorのエクスポート形式 https://github.com/dim13/otpauth/blob/master/migration/migration.proto
     Base32エンコーダー https://dencode.com/ja/string/base32
 */
 #pragma once
@@ -16,228 +17,437 @@
 #include "common.h"
 
 #include <Base32-Decode.h>
+#include "mbedtls/base64.h"
+#include "TotpGenerator.h"
 
 
 //--------------------------------------------------------------
-// URLデコード
+// 文字列の範囲　元のバッファを指すだけでコピーしない
 //--------------------------------------------------------------
-String urlDecode(String str) {
-	String decoded = "";
-	for (int i=0; i<str.length(); i++) {
-	  char c = str.charAt(i);
-	  if (c == '%' && i+2 < str.length()) {
-      String hex = str.substring(i+1, i+3);
-      char decodedChar = (char) strtol(hex.c_str(), NULL, 16);
-      decoded += decodedChar;
-      i += 2;
-	  } else if (c == '+') {
-  		decoded += ' ';
-	  } else {
-	  	decoded += c;
-	  }
-	}
-	return decoded;
+struct StrSpan {
+  char*  ptr = nullptr;
+  size_t len = 0;
+
+  // 大文字小文字を区別せずに比較する
+  bool equals(const char* str) const {
+    return (strlen(str) == len && (len == 0 || strncasecmp(ptr, str, len) == 0));
+  }
+  // 指定文字の位置（見つからなければ-1）
+  int indexOf(char c) const {
+    if (len == 0) return -1;
+    const char* p = (const char*)memchr(ptr, c, len);
+    return (p == nullptr) ? -1 : (int)(p - ptr);
+  }
+  // 部分範囲
+  StrSpan sub(size_t start, size_t n) const {
+    if (start > len) start = len;
+    if (n > len - start) n = len - start;
+    return { ptr + start, n };
+  }
+  // 前後の空白を除く
+  StrSpan trim() const {
+    StrSpan r = *this;
+    while (r.len > 0 && isspace((unsigned char)r.ptr[0])) { r.ptr++; r.len--; }
+    while (r.len > 0 && isspace((unsigned char)r.ptr[r.len-1])) r.len--;
+    return r;
+  }
+};
+
+//--------------------------------------------------------------
+// URLデコード　バッファ上で直接デコードし、デコード後の長さを返す
+//--------------------------------------------------------------
+int hexValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+size_t urlDecodeInPlace(char* buf, size_t len, bool plusAsSpace) {
+  size_t w = 0;
+  for (size_t r=0; r<len; r++) {
+    char c = buf[r];
+    if (c == '%' && r+2 < len && hexValue(buf[r+1]) >= 0 && hexValue(buf[r+2]) >= 0) {
+      c = (char)((hexValue(buf[r+1]) << 4) | hexValue(buf[r+2]));
+      r += 2;
+    } else if (c == '+' && plusAsSpace) {
+      c = ' ';
+    }
+    buf[w++] = c;
+  }
+  return w;
+}
+StrSpan urlDecodeInPlace(StrSpan s, bool plusAsSpace=true) {
+  s.len = urlDecodeInPlace(s.ptr, s.len, plusAsSpace);
+  return s;
+}
+
+//--------------------------------------------------------------
+// 範囲を固定長の文字配列にコピーする（UTF-8の途中で切らない）
+//--------------------------------------------------------------
+void copySpan(char* dst, size_t dstSize, StrSpan s) {
+  size_t n = s.len;
+  if (n > dstSize-1) {
+    n = dstSize-1;
+    while (n > 0 && ((uint8_t)s.ptr[n] & 0xC0) == 0x80) n--;  // 継続バイトで切らない
+  }
+  if (n > 0) memcpy(dst, s.ptr, n);
+  dst[n] = '\0';
+}
+
+//--------------------------------------------------------------
+// 範囲を10進数として読む（数字以外を含む場合はfalse）
+//--------------------------------------------------------------
+bool parseSpanUint(StrSpan s, uint32_t* value) {
+  if (s.len == 0 || s.len > 10) return false;
+  uint64_t v = 0;
+  for (size_t i=0; i<s.len; i++) {
+    if (s.ptr[i] < '0' || s.ptr[i] > '9') return false;
+    v = v * 10 + (s.ptr[i] - '0');
+  }
+  if (v > UINT32_MAX) return false;
+  *value = (uint32_t)v;
+  return true;
 }
 
 //--------------------------------------------------------------
 // OTPのURIをパースする
+//   uriは書き換えられる（パーセントデコードをその場で行うため）
+//   ヒープは使用せず、結果はTotpParamsの固定長配列に直接書き込む
 //--------------------------------------------------------------
-bool parseUriOTP(TotpParams* tp, String uri) {
-	String issuer = "", account = "", secret = "";
-	String remainder, label, query;
-	bool result = false;
-	
+bool parseUriOTP(TotpParams* tp, char* uri, size_t len) {
+	TotpParams res;
+	StrSpan issuer, account, secret;
+
 	// URIが otpauth://totp/ で始まっているか？
-	String prefix = "otpauth://totp/";
-	if (!uri.startsWith(prefix)) {
+	const char prefix[] = "otpauth://totp/";
+	const size_t prefixLen = sizeof(prefix) - 1;
+	if (len < prefixLen || strncasecmp(uri, prefix, prefixLen) != 0) {
 	  if (debug) sp("URI not start with otpauth://totp/");
 	  return false;
 	}
-	
+	StrSpan remainder = { uri + prefixLen, len - prefixLen };
+
 	// ?の箇所でラベルとクエリに分離
-	remainder = uri.substring(prefix.length());
+	StrSpan label = remainder, query;
 	int qIndex = remainder.indexOf('?');
 	if (qIndex != -1) {
-	  label = remainder.substring(0, qIndex);
-	  query = remainder.substring(qIndex + 1);
-	} else {
-	  label = remainder;
+	  label = remainder.sub(0, qIndex);
+	  query = remainder.sub(qIndex + 1, remainder.len);
 	}
-	
+
 	// ラベルの中に:がある場合はissuerとaccountに分割
-	label = urlDecode(label);
+	label = urlDecodeInPlace(label);
 	int colonIndex = label.indexOf(':');
 	if (colonIndex != -1) {
-	  issuer = label.substring(0, colonIndex);
-	  String accountPart = label.substring(colonIndex + 1);
-	  accountPart.trim();
-	  account = accountPart;
+	  issuer = label.sub(0, colonIndex);
+	  account = label.sub(colonIndex + 1, label.len).trim();
 	} else {
 	  account = label;
 	}
-	
+
 	// クエリパラメータ(key=value&key=value)のパース
-	if (query.length() > 0) {
-	  int start = 0;
-	  while (start < query.length()) {
-      // & で分割
-      int ampIndex = query.indexOf('&', start);
-      String pair;
-      if (ampIndex == -1) {
-        pair = query.substring(start);
-        start = query.length();
-      } else {
-        pair = query.substring(start, ampIndex);
-        start = ampIndex + 1;
+	while (query.len > 0) {
+	  // & で分割
+	  StrSpan pair = query;
+	  int ampIndex = query.indexOf('&');
+	  if (ampIndex != -1) {
+      pair = query.sub(0, ampIndex);
+      query = query.sub(ampIndex + 1, query.len);
+	  } else {
+      query.len = 0;
+	  }
+	  // = で分割
+	  int equalIndex = pair.indexOf('=');
+	  if (equalIndex == -1) continue;
+	  StrSpan key = urlDecodeInPlace(pair.sub(0, equalIndex));
+	  StrSpan value = urlDecodeInPlace(pair.sub(equalIndex + 1, pair.len));
+	  uint32_t num;
+	  // パラメーターごとの処理
+	  if (key.equals("secret")) {
+      if (value.len == 0 || value.len > sizeof(TotpParams::secret)-1) {
+        if (debug) sp("Secret too long");
+        return false;
+      }
+      secret = value;
+	  } else if (key.equals("issuer")) {
+      issuer = value;
+	  } else if (key.equals("algorithm")) {
+      res.algorithm = TotpGenerator::algorithmFromName(value.ptr, value.len);
+      if (res.algorithm == 0) {
+        if (debug) sp("Unsupported algorithm");
+        return false;
+      }
+	  } else if (key.equals("digits") || key.equals("digit")) {
+      if (!parseSpanUint(value, &num) || num < TotpGenerator::DIGITS_MIN || num > TotpGenerator::DIGITS_MAX) {
+        if (debug) sp("Unsupported digits");
+        return false;
       }
-      // = で分割
-      int equalIndex = pair.indexOf('=');
-      if (equalIndex != -1) {
-        String key = pair.substring(0, equalIndex);
-        String value = pair.substring(equalIndex + 1);
-        key = urlDecode(key);
-        value = urlDecode(value);
-        // パラメーターごとの処理        
-        if (key.equalsIgnoreCase("secret")) {
-          if (value.length() < sizeof(TotpParams::secret)-1) {
-            secret = value;
-            result = true;
-          }
-        } else if (key.equalsIgnoreCase("issuer")) {
-          issuer = value;
-        } else if (key.equalsIgnoreCase("digit")) {
-          int num = value.toInt();
-          if (num == 6 || num == 8) tp->digit = (uint8_t)num;
-        } else if (key.equalsIgnoreCase("period")) {
-          int num = value.toInt();
-          if (num > 0 || num <= 255) tp->period = (uint8_t)num;
-        }
+      res.digit = (uint8_t)num;
+	  } else if (key.equals("period")) {
+      if (!parseSpanUint(value, &num) || num == 0 || num > 255) {   // TotpParams::periodはuint8_t
+        if (debug) sp("Unsupported period");
+        return false;
       }
+      res.period = (uint8_t)num;
+	  } else if (key.equals("counter")) {
+      if (!parseSpanUint(value, &num)) return false;   // HOTP用なので値は使わない
 	  }
 	}
-  
+
 	// 構造体に代入
-	if (result) {
-	  issuer.toCharArray(tp->issuer, sizeof(TotpParams::issuer));
-	  account.toCharArray(tp->account, sizeof(TotpParams::account));
-	  secret.toCharArray(tp->secret, sizeof(TotpParams::secret));
-	  if (debug) {
-      spf("URI: %s\n", uri.c_str());
-      spf("  Issuer:  %s\n", tp->issuer);
-      spf("  Account: %s\n", tp->account);
-      spf("  Secret:  %s\n", tp->secret);
-      spf("  Digit:   %d\n", tp->digit);
-      spf("  Period:  %d\n", tp->period);
-	  }
-	} else {
+	if (secret.len == 0) {
     if (debug) sp("Error! URI cannot decode");
+    return false;
   }
-	return result;
+	copySpan(res.issuer, sizeof(TotpParams::issuer), issuer);
+	copySpan(res.account, sizeof(TotpParams::account), account);
+	copySpan(res.secret, sizeof(TotpParams::secret), secret);
+	*tp = res;
+	memset(res.secret, 0, sizeof(res.secret));
+	if (debug) {
+	  spf("  Issuer:  %s\n", tp->issuer);
+	  spf("  Account: %s\n", tp->account);
+	  spf("  Secret:  %s\n", tp->secret);
+	  spf("  Algo:    %s\n", TotpGenerator::algorithmName(tp->algorithm));
+	  spf("  Digit:   %d\n", tp->digit);
+	  spf("  Period:  %d\n", tp->period);
+	}
+	return true;
 }
 
 //--------------------------------------------------------------
-// 指定時刻のワンタイムパスワードを取得する
+// Base32エンコード（パディングなし）　出力した文字数を返す。入りきらない場合は0
 //--------------------------------------------------------------
-String getTotp(TotpParams* tp, time_t epoch) {
-  size_t maxOut = strlen(tp->secret);
-  char decodedSecret[maxOut];
-  int decLen = base32decode(tp->secret, (unsigned char*) decodedSecret, maxOut);
-  if (decLen < 0) return "";
-  TOTP totp = TOTP(reinterpret_cast<uint8_t*>(decodedSecret), decLen, tp->period);
-  char* code = totp.getCode(epoch);
-  if (0 && debug) {
-    spp("Secret (base32)",tp->secret);
-    spn("Secret (decode): ");
-    printDump1Line(reinterpret_cast<byte*>(decodedSecret), decLen);
-    spp("epoch",epoch);
-    spp("code",code);
+size_t base32Encode(const uint8_t* data, size_t len, char* out, size_t outSize) {
+  const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567";
+  size_t olen = (len * 8 + 4) / 5;
+  if (olen + 1 > outSize) return 0;
+  uint32_t buffer = 0;
+  int bits = 0;
+  size_t w = 0;
+  for (size_t i=0; i<len; i++) {
+    buffer = (buffer << 8) | data[i];
+    bits += 8;
+    while (bits >= 5) {
+      out[w++] = alphabet[(buffer >> (bits - 5)) & 0x1F];
+      bits -= 5;
+    }
   }
-  return (String)code;
+  if (bits > 0) out[w++] = alphabet[(buffer << (5 - bits)) & 0x1F];
+  out[w] = '\0';
+  return w;
 }
 
 //--------------------------------------------------------------
-// OTPの保存ファイル名を作成する
+// protobufの最小限のリーダー　バッファを前から順に読むだけで、メモリは確保しない
 //--------------------------------------------------------------
-String makeOtpFilename(TotpParams* tp) {
-  uint8_t hash[32];
-  String filename = "/otp-";
-  // ハッシュ値をHEX表記にする
-  String text = String(tp->issuer) + String(tp->account) + String(tp->secret);
-  if (debug) spp("makeOtpFilename HASH source text",text);
-  if (!sha256(text, hash, sizeof(hash))) return "";
-  for (int i=0; i<8; i++) {
-    char buff[4];
-    sprintf(buff, "%02x", hash[i]);
-    filename = filename + String(buff);
+struct PbReader {
+  const uint8_t* p;
+  const uint8_t* end;
+
+  bool eof() const { return p >= end; }
+  // varintを読む
+  bool readVarint(uint64_t* value) {
+    uint64_t v = 0;
+    for (int shift=0; shift<64; shift+=7) {
+      if (p >= end) return false;
+      uint8_t b = *p++;
+      v |= (uint64_t)(b & 0x7F) << shift;
+      if ((b & 0x80) == 0) {
+        *value = v;
+        return true;
+      }
+    }
+    return false;
   }
-  filename = filename + ".bin";
-  return filename;
-}
+  // タグ（フィールド番号とワイヤタイプ）を読む
+  bool readTag(uint32_t* field, uint8_t* wire) {
+    uint64_t tag;
+    if (!readVarint(&tag) || (tag >> 3) == 0) return false;
+    *field = (uint32_t)(tag >> 3);
+    *wire = tag & 0x07;
+    return true;
+  }
+  // 長さ付きのデータ（bytes, string, message）を読む
+  bool readBytes(const uint8_t** data, size_t* len) {
+    uint64_t n;
+    if (!readVarint(&n) || n > (uint64_t)(end - p)) return false;
+    *data = p;
+    *len = (size_t)n;
+    p += n;
+    return true;
+  }
+  // 不要なフィールドを読み飛ばす
+  bool skip(uint8_t wire) {
+    uint64_t v;
+    const uint8_t* d;
+    size_t n;
+    switch (wire) {
+      case 0: return readVarint(&v);
+      case 1: if (end - p < 8) return false; p += 8; return true;
+      case 2: return readBytes(&d, &n);
+      case 5: if (end - p < 4) return false; p += 4; return true;
+    }
+    return false;
+  }
+};
 
 //--------------------------------------------------------------
-// FatFSにOTPを保存する
+// Google Authenticatorのエクスポートの1アカウント分(OtpParameters)を変換する
+//   非対応（HOTP、MD5、秘密鍵が長すぎる）の場合はfalse
 //--------------------------------------------------------------
-bool saveOtpFile(String filename, TotpParams* tp) {
-  if (!status.unlock) return false;
-  bool res = false;
-
-  // "tp.secret"を暗号化する
-  TotpParams tps = *tp;
-  size_t len = sizeof(TotpParams::secret);
-  size_t enclen = encrypt(reinterpret_cast<byte*>(tp->secret), len, status.iv, status.secret, reinterpret_cast<byte*>(tps.secret)); // 暗号化
-  if (debug) {
-    spn("otp-secret: ");
-    printDump1Line(reinterpret_cast<byte*>(tp->secret), len);
-    spn("otp-secret-enc: ");
-    printDump1Line(reinterpret_cast<byte*>(tps.secret), enclen);
+bool parseMigrationOtp(const uint8_t* data, size_t len, TotpParams* tp) {
+  PbReader pb = { data, data + len };
+  TotpParams res;
+  const uint8_t* secret = nullptr;
+  size_t secretLen = 0;
+  StrSpan name, issuer;
+  uint64_t algorithm = 0, digits = 0, type = 0;
+  uint32_t field;
+  uint8_t wire;
+  while (!pb.eof()) {
+    if (!pb.readTag(&field, &wire)) return false;
+    const uint8_t* d;
+    size_t n;
+    if (wire == 2 && field <= 3) {
+      if (!pb.readBytes(&d, &n)) return false;
+      if (field == 1) { secret = d; secretLen = n; }
+      else if (field == 2) name = { (char*)d, n };
+      else issuer = { (char*)d, n };
+    } else if (wire == 0 && field >= 4 && field <= 6) {
+      uint64_t v;
+      if (!pb.readVarint(&v)) return false;
+      if (field == 4) algorithm = v;
+      else if (field == 5) digits = v;
+      else type = v;
+    } else {
+      if (!pb.skip(wire)) return false;   // counter(7)などは使わない
+    }
   }
 
-  // ファイル保存
-  res = saveFile(&tps, sizeof(tps), filename);
-  if (debug) spp("saveFile", tf(res));
-  return res;
+  // 種別　0=未指定 1=HOTP 2=TOTP
+  if (type == 1) return false;
+  // アルゴリズム　0=未指定 1=SHA1 2=SHA256 3=SHA512 4=MD5（TotpAlgorithmと同じ値）
+  if (algorithm == 0) algorithm = TOTP_ALGO_SHA1;
+  if (algorithm > TOTP_ALGO_SHA512) return false;
+  res.algorithm = (uint8_t)algorithm;
+  // 桁数　0=未指定 1=6桁 2=8桁
+  if (digits > 2) return false;
+  res.digit = (digits == 2) ? 8 : 6;
+  // 秘密鍵はバイナリなのでBase32に戻す
+  if (secret == nullptr || secretLen == 0) return false;
+  if (base32Encode(secret, secretLen, res.secret, sizeof(res.secret)) == 0) return false;
+  // 名前が "issuer:account" の場合はaccountだけにする
+  int colonIndex = name.indexOf(':');
+  if (colonIndex != -1) {
+    if (issuer.len == 0) issuer = name.sub(0, colonIndex);
+    name = name.sub(colonIndex + 1, name.len).trim();
+  }
+  copySpan(res.issuer, sizeof(TotpParams::issuer), issuer);
+  copySpan(res.account, sizeof(TotpParams::account), name);
+  *tp = res;
+  memset(res.secret, 0, sizeof(res.secret));
+  return true;
 }
 
 //--------------------------------------------------------------
-// FatFSからOTPを読み込む
+// Google AuthenticatorのエクスポートのURIをパースする
+//   otpauth-migration://offline?data=（base64のMigrationPayload）
+//   uriは書き換えられる。対応するアカウントをtpsに追加し、バッチの情報をbatchに入れる
 //--------------------------------------------------------------
-bool loadOtpFile(String filename, TotpParams* tp, bool decryptSecret) {
-  if (decryptSecret && !status.unlock) return false;
-  bool res = false;
-  size_t rlen = 0;
+bool parseMigrationUri(char* uri, size_t len, std::vector<TotpParams>* tps, MigrationBatch* batch) {
+  const char prefix[] = "otpauth-migration://offline?";
+  const size_t prefixLen = sizeof(prefix) - 1;
+  if (len < prefixLen || strncasecmp(uri, prefix, prefixLen) != 0) return false;
+  StrSpan query = { uri + prefixLen, len - prefixLen };
+
+  // data= を探す
+  StrSpan data;
+  while (query.len > 0) {
+    StrSpan pair = query;
+    int ampIndex = query.indexOf('&');
+    if (ampIndex != -1) {
+      pair = query.sub(0, ampIndex);
+      query = query.sub(ampIndex + 1, query.len);
+    } else {
+      query.len = 0;
+    }
+    int equalIndex = pair.indexOf('=');
+    if (equalIndex != -1 && pair.sub(0, equalIndex).equals("data")) {
+      data = urlDecodeInPlace(pair.sub(equalIndex + 1, pair.len), false);  // base64の+は空白にしない
+    }
+  }
+  if (data.len == 0) return false;
 
-  // ファイル読み込み
-  size_t deflen = sizeof(TotpParams);
-  int filelen = getFileSize(filename);
-  if (filelen == deflen) {
-    rlen = loadFile(tp, deflen, filename);
-    if (debug) spp("loadFile size", rlen);
+  // base64デコード　デコード結果は元のバッファより短いので同じ位置に上書きする
+  size_t plen = 0;
+  if (mbedtls_base64_decode((uint8_t*)data.ptr, data.len, &plen, (const uint8_t*)data.ptr, data.len) != 0) {
+    if (debug) sp("Error! migration data base64");
+    return false;
   }
-  if (rlen != deflen) return false;
 
-  // "tp.secret"を複合化する
-  size_t seclen = sizeof(TotpParams::secret);
-  if (decryptSecret) { 
-    byte decSecret[seclen];
-    size_t declen = decrypt(decSecret, reinterpret_cast<byte*>(tp->secret), seclen, status.iv, status.secret);  // 複合化
-    res = (declen == seclen && tp->version == 1);
-    if (debug) {
-      spn("otp-secret-enc: ");
-      printDump1Line(reinterpret_cast<byte*>(tp->secret), seclen);
-      spn("otp-secret: ");
-      printDump1Line(decSecret, declen);
+  // MigrationPayload
+  PbReader pb = { (const uint8_t*)data.ptr, (const uint8_t*)data.ptr + plen };
+  MigrationBatch res;
+  size_t first = tps->size();
+  uint32_t field;
+  uint8_t wire;
+  bool success = true;
+  while (success && !pb.eof()) {
+    if (!pb.readTag(&field, &wire)) { success = false; break; }
+    if (field == 1 && wire == 2) {   // otp_parameters
+      const uint8_t* d;
+      size_t n;
+      TotpParams tp;
+      if (!pb.readBytes(&d, &n)) { success = false; break; }
+      if (parseMigrationOtp(d, n, &tp)) {
+        tps->push_back(tp);
+        memset(tp.secret, 0, sizeof(tp.secret));
+      } else {
+        res.skipped ++;
+      }
+    } else if (field >= 3 && field <= 5 && wire == 0) {   // batch_size, batch_index, batch_id
+      uint64_t v;
+      if (!pb.readVarint(&v)) { success = false; break; }
+      if (field == 3) res.batchSize = (v > 0 && v <= MIGRATION_BATCH_MAX) ? (uint8_t)v : 0;
+      else if (field == 4) res.batchIndex = (v < MIGRATION_BATCH_MAX) ? (uint8_t)v : MIGRATION_BATCH_MAX;
+      else res.batchId = (int32_t)v;
+    } else {
+      success = pb.skip(wire);   // version(2)など
     }
-    memcpy(reinterpret_cast<char*>(tp->secret), decSecret, seclen);
-  } else {
-    res = (tp->version == 1);
-    memset(reinterpret_cast<char*>(tp->secret), 0, seclen);
   }
-  
-  return res;
+  if (res.batchSize == 0 || res.batchIndex >= res.batchSize) success = false;
+
+  // 失敗した場合は追加した分を取り消す
+  if (!success) {
+    for (size_t i=first; i<tps->size(); i++) memset((*tps)[i].secret, 0, sizeof(TotpParams::secret));
+    tps->resize(first);
+    if (debug) sp("Error! migration payload cannot decode");
+    return false;
+  }
+  *batch = res;
+  if (debug) spf("Migration batch %d/%d id=%d: %u accounts, %d skipped\n",
+    res.batchIndex+1, res.batchSize, res.batchId, (unsigned)(tps->size()-first), res.skipped);
+  return true;
 }
 
 //--------------------------------------------------------------
-// FatFSのOTPファイル名一覧を取得する
+// 指定時刻のワンタイムパスワードを取得する
+//--------------------------------------------------------------
+bool getTotp(TotpParams* tp, time_t epoch, char* code, size_t codeSize) {
+  TotpGenerator totp;
+  if (!totp.begin(tp->secret, tp->period, tp->digit, tp->algorithm)) return false;
+  if (!totp.getCode(epoch, code, codeSize)) return false;
+  if (0 && debug) {
+    spp("Secret (base32)",tp->secret);
+    spp("epoch",epoch);
+    spp("code",code);
+  }
+  return true;
+}
+
+//--------------------------------------------------------------
+// FatFSの旧形式のOTPファイル名一覧を取得する（保存ファイルへの移行用）
 //--------------------------------------------------------------
 std::vector<String> listOtpFiles() {
   const String dirname = "/";
@@ -252,7 +462,7 @@ std::vector<String> listOtpFiles() {
     filename = file.name();
     if (!file.isDirectory()) {
       if (filename.startsWith("otp-") && filename.endsWith(".bin")) {
-        if (debug) spf("  File: %s%s (%d)\n", dirname, filename.c_str(), file.size());
+        if (debug) spf("  File: %s%s (%u)\n", dirname.c_str(), filename.c_str(), (unsigned)file.size());
         fileList.push_back(dirname + filename);
       }
     }
@@ -262,19 +472,3 @@ std::vector<String> listOtpFiles() {
 
   return fileList;
 }
-
-//--------------------------------------------------------------
-// FatFSのOTP情報を全て取得する
-//--------------------------------------------------------------
-int listAllOtpFiles(std::vector<TotpParamsList> *tps, bool decryptSecret) {
-  std::vector<String> otpFiles = listOtpFiles();  // ファイル名一覧を取得
-  bool debugOrig = debug;
-  debug = false;
-  for (int i=0; i<otpFiles.size(); i++) {
-    TotpParams tp;
-    bool res = loadOtpFile(otpFiles[i], &tp, decryptSecret);
-    if (res) tps->push_back({ otpFiles[i], tp });
-  }
-  debug = debugOrig;
-  return tps->size();
-}
@@ -9,11 +9,12 @@
 #pragma once
 #include "common.h"
 #include "secret.h"
+#include "coreutil.h"   // ファイル操作と暗号化（ハードウェアに依存しない部分）
+#include "nfcstore.h"   // NFCカードへの秘密鍵ファイルの保存と読み込み
 
 #include <WiFi.h>
 #include <FFat.h>
-#include "mbedtls/md.h"
-#include "mbedtls/aes.h"
+#include "mbedtls/platform_util.h"
 #include <M5UnitQRCode.h>   // https://github.com/m5stack/M5Unit-QRCode
 
 // メインで定義した変数を使用するためのもの
@@ -23,12 +24,6 @@ extern DinMeterUI ui;
 extern BleKeyboard  bleKeyboard;
 bool m5BtnAwasReleased();
 
-// プロテクトの範囲
-const uint8_t  prtVaddrCL = SECRET_NFC_PARTITION_ADDR;  // 物理sector=1から48バイト単位後まで
-const uint16_t prtSizeCL = ceil((double)SECRET_SAVE_SIZE / 48) * 48;
-const uint8_t  prtVaddrUL = SECRET_NFC_PARTITION_ADDR;  // 物理page=6以降全て
-const uint16_t prtSizeUL = ceil((double)SECRET_SAVE_SIZE / 16) * 16;
-
 // JIS/US配列対応表 funcDevelopSendAscii()で調査
 const uint8_t keyMapTable[][2] = {  // 入力したい文字, このキーを入力すればそれが出るやつ
   { '*', '\"' },
@@ -142,7 +137,9 @@ void qrcodeUnitInitI2C(uint32_t timeout) {
   uint32_t tmqrexp = millis();
   while (!status.unitQRready) {
     // if (qr.begin(&Serial2, UNIT_QRCODE_UART_BAUD, pinRX, pinTX)) { // for UART
-    if (qr.begin(&Wire, UNIT_QRCODE_ADDR, pinSda, pinScl, 100000U)) { // for I2C
+    if (qr.begin(&Wire, UNIT_QRCODE_ADDR, pinSda, pinScl, I2C_CLOCK_QRCODE)) { // for I2C
+      I2cBusProfile::invalidate();  // begin()でWireが初期化し直されるので、次の通信でクロックを設定し直す
+      qrcodeBusUse();
       qr.setTriggerMode(MANUAL_SCAN_MODE);
       status.unitQRready = true;
     } else if (tmqrexp+timeout < millis()) {  // timeout
@@ -152,6 +149,14 @@ void qrcodeUnitInitI2C(uint32_t timeout) {
   }
 }
 
+//--------------------------------------------------------------
+// I2CバスのクロックをUnit-QRに合わせる
+//   Unit-RFID2と同じWireを使うので、QRの通信の前に呼ぶ（RFID2側はMFRC522_I2C_Extendが自分で合わせる）
+//--------------------------------------------------------------
+void qrcodeBusUse() {
+  I2cBusProfile::use(&Wire, I2C_CLOCK_QRCODE);
+}
+
 //--------------------------------------------------------------
 // バイナリのdumpを出力する
 //--------------------------------------------------------------
@@ -219,13 +224,6 @@ Tms getMultiDateTime(bool syncRtc) {  // default: false
   return tms;
 }
 
-//--------------------------------------------------------------
-// PASS/FAIL
-//--------------------------------------------------------------
-String tf(bool res) {
-  return res ? "PASS" : "FAIL";
-}
-
 //--------------------------------------------------------------
 // NFCのプロテクトを変更する
 //--------------------------------------------------------------
@@ -276,116 +274,6 @@ bool nfcChangeProtect(bool protect, bool formatAll) {
   return res;
 }
 
-//--------------------------------------------------------------
-// バイナリファイルを保存する(FatFS)
-//--------------------------------------------------------------
-bool saveFile(void *data, size_t dataSize, String filename) {
-  // 書き込み
-  File file = FFat.open(filename, FILE_WRITE);
-  if (!file) {
-    if (debug) sp("saveFile open failed "+filename);
-    return false;
-  }
-  size_t wlen = file.write(reinterpret_cast<const uint8_t *>(data), dataSize);
-  file.close();
-  // チェック
-  if (wlen != dataSize) {
-    if (debug) sp("saveFile write failed "+filename);
-    return false;
-  }
-  if (debug) spf("Write %d bytes to file: %s\n", wlen, filename.c_str());
-  return true;
-}
-
-//--------------------------------------------------------------
-// バイナリファイルを保存する(NFC)
-//--------------------------------------------------------------
-bool saveNfc(void *data, size_t dataSize, uint16_t vaddr, ProtectMode mode) {
-  if (mode == PRT_AUTO) mode = nfc._lastProtectMode;
-  bool res = nfc.writeData(vaddr, reinterpret_cast<void *>(data), dataSize, mode);
-  if (!res) {
-    if (debug) sp("saveNfc failed.");
-    return false;
-  }
-  if (debug) spf("Write %d bytes to NFC: vaddr=%d\n", dataSize, vaddr);
-  return true;
-}
-
-//--------------------------------------------------------------
-// バイナリファイルを読み込む(FatFS)
-//--------------------------------------------------------------
-size_t loadFile(void *data, size_t dataSize, String filename) {
-  File file = FFat.open(filename, FILE_READ);
-  if (!file) {
-    if (debug) sp("loadFile open failed "+filename);
-    return 0;
-  }
-  size_t rlen = file.read(reinterpret_cast<uint8_t *>(data), dataSize);
-  file.close();
-  if (debug) spf("Read %d bytes from file: %s\n", rlen, filename.c_str());
-  return rlen;
-}
-
-//--------------------------------------------------------------
-// バイナリファイルを読み込む(NFC)
-//--------------------------------------------------------------
-size_t loadNfc(void *data, size_t dataSize, uint16_t vaddr, ProtectMode mode) {
-  if (mode == PRT_AUTO) mode = nfc._lastProtectMode;
-  bool res = nfc.readData(vaddr, reinterpret_cast<void *>(data), dataSize, mode);
-  if (!res) {
-    if (debug) sp("loadNfc failed.");
-    return false;
-  }
-  if (debug) spf("Read %d bytes from NFC: vaddr=%d\n", dataSize, vaddr);
-  return dataSize;
-}
-
-//--------------------------------------------------------------
-// バイナリファイルを削除する(FatFS)
-//--------------------------------------------------------------
-bool deleteFile(String filename) {
-  bool res = FFat.remove(filename);
-  if (debug) spf("Delete %s file: %s\n", tf(res), filename.c_str());
-  return res;
-}
-
-//--------------------------------------------------------------
-// ファイルサイズを取得する（存在しなければ-1）
-//--------------------------------------------------------------
-int getFileSize(String filename) {
-  int fileSize = -1;
-  File file = FFat.open(filename, FILE_READ);
-  if (file) {
-    fileSize = (int) file.size();
-  }
-  file.close();
-  return fileSize;
-}
-
-//--------------------------------------------------------------
-// SHA256でハッシュ化する  output:32byte=256bit
-//--------------------------------------------------------------
-bool sha256(String input, byte* output, size_t outputSize) {
-  if (input == nullptr || output == nullptr || outputSize < 32) return false;
-
-  mbedtls_md_context_t ctx;
-  mbedtls_md_init(&ctx);
-  const mbedtls_md_info_t* mdInfo = mbedtls_md_info_from_type(MBEDTLS_MD_SHA256);
-  if (mdInfo == nullptr) {
-    mbedtls_md_free(&ctx);
-    return false;
-  }
-  if (mbedtls_md_setup(&ctx, mdInfo, 0) != 0) {
-    mbedtls_md_free(&ctx);
-    return false;
-  }
-  mbedtls_md_starts(&ctx);
-  mbedtls_md_update(&ctx, (const unsigned char*)input.c_str(), input.length());
-  mbedtls_md_finish(&ctx, output);
-  mbedtls_md_free(&ctx);
-  return true;
-}
-
 //--------------------------------------------------------------
 // IVを取得(生成)する  output:16byte=128bit　一意な値
 //--------------------------------------------------------------
@@ -417,139 +305,122 @@ bool getBSecret(uint8_t* bsecret, size_t bsecretSize, String addText) {
 }
 
 //--------------------------------------------------------------
-// AES 256bitで暗号化する
+// 端末固有の鍵を生成してメモリ上に保存する（起動時に1回だけ呼ぶ）
+//   IVと秘密鍵暗号化用の秘密鍵はMACアドレスから決まるので、読み込み/保存のたびに計算し直さない
 //--------------------------------------------------------------
-size_t encrypt(byte* data, size_t dataSize, const byte* iv, const byte* key, byte* encryptedData) {
-  if (data == nullptr || iv == nullptr || key == nullptr || encryptedData == nullptr) return 0;
-  size_t encsize = 0;
-  byte ivCopy[16];
-
-  // AES初期化
-  memcpy(ivCopy, iv, 16);
-  mbedtls_aes_context aes;
-  mbedtls_aes_init(&aes);
-  if (mbedtls_aes_setkey_enc(&aes, key, 256) != 0) {
-    mbedtls_aes_free(&aes);
-    return 0;
-  }
-
-  // 暗号化処理
-  for (int i=0; i<dataSize; i+=16) {
-    size_t blockSize = (dataSize-i >= 16) ? 16 : (dataSize-i);
-    byte block[16] = {0};
-    memcpy(block, data+i, blockSize);
-    if (mbedtls_aes_crypt_cbc(&aes, MBEDTLS_AES_ENCRYPT, 16, ivCopy, block, encryptedData+i) != 0) {
-      mbedtls_aes_free(&aes);
-      return 0;
-    }
-    encsize += 16;
-  }
-  mbedtls_aes_free(&aes);
- 
-  return encsize;
-}
-
-//--------------------------------------------------------------
-// AES 256bitで復号化する
-//--------------------------------------------------------------
-size_t decrypt(byte* decryptedData, const byte* encryptedData, size_t encryptedSize, const byte* iv, const byte* key) {
-  if (decryptedData == nullptr || encryptedData == nullptr || iv == nullptr || key == nullptr)  return 0;
-  byte ivCopy[16];
-  size_t decsize = 0;
-
-  // AES初期化
-  memcpy(ivCopy, iv, sizeof(ivCopy));
-  mbedtls_aes_context aes;
-  mbedtls_aes_init(&aes);
-  if (mbedtls_aes_setkey_dec(&aes, key, 256) != 0) {
-    mbedtls_aes_free(&aes);
-    return 0;
-  }
-  
-  // 復号化処理
-  for (int i=0; i<encryptedSize; i+=16) {
-    byte block[16];
-    if (mbedtls_aes_crypt_cbc(&aes, MBEDTLS_AES_DECRYPT, 16, ivCopy, encryptedData+i, block) != 0) {
-      mbedtls_aes_free(&aes);
-      return 0;
-    }
-    memcpy(decryptedData+i, block, 16);
-    decsize += 16;
-  }
-  mbedtls_aes_free(&aes);
-
-  return decsize;
+bool deviceKeysBegin() {
+  if (!getIV(status.iv, sizeof(status.iv), IV_PHRASE)) return false;
+  if (!getBSecret(status.bsecret, sizeof(status.bsecret), BSECRET_PHRASE)) return false;
+  return true;
 }
 
 //--------------------------------------------------------------
-// 秘密鍵を読み込む（ストレージ→メモリ）
+// 秘密鍵ファイルを読み込む（ストレージ→バッファ）　複合化はしない
 //--------------------------------------------------------------
-bool loadSecret(SecretStore device) {
-  byte bsecret[32];
-  SecretDef sdef;
-  byte deced[32];
+bool readSecretDef(SecretStore device, SecretDef* sdef) {
   size_t rlen = 0;
-
-  // ストレージからの読み込み
-  getBSecret(bsecret, sizeof(bsecret) , BSECRET_PHRASE);   // 秘密鍵を複合化するための秘密鍵を生成する
   if (device == CONF_SECRET_FATFS) {  // FatFSの場合
     if (getFileSize(FN_SECRETENC) == sizeof(SecretDef)) {
-      rlen = loadFile(&sdef, sizeof(SecretDef), FN_SECRETENC);
+      rlen = loadFile(sdef, sizeof(SecretDef), FN_SECRETENC);
     }
   } else if (device == CONF_SECRET_NFC) { // NFCの場合
-    rlen = loadNfc(&sdef, sizeof(SecretDef), SECRET_NFC_PARTITION_ADDR, PRT_PASSWD_RW);
+    nfc.resetStats();
+    rlen = loadSecretNfc(sdef);
+    if (debug) spf("Load Secret NFC: %u us, round trips=%u (auth=%u, read=%u), retry=%u\n", nfc._stats.lastReadUs,
+      nfc._stats.auths + nfc._stats.frames, nfc._stats.auths, nfc._stats.frames, nfc._stats.retries);
   }
-  if (rlen != SECRET_SAVE_SIZE || memcmp(sdef.magic, SecretMagic, sizeof(sdef.magic)) != 0) {
+  if (rlen != SECRET_SAVE_SIZE || memcmp(sdef->magic, SecretMagic, sizeof(sdef->magic)) != 0) {
     if (debug) sp("Load Secret failed! file cannot read.");
     return false;
   }
+  return true;
+}
 
-  // 複合化してメモリに格納する
+//--------------------------------------------------------------
+// 秘密鍵ファイルの中身を複合化する  output:32byte（起動時に生成した秘密鍵で）
+//--------------------------------------------------------------
+size_t decryptSecretDef(const SecretDef* sdef, byte* output) {
   if (debug) {
     spn("Loaded Secret-enc: ");
-    printDump1Line(sdef.secretEnc, sizeof(SecretDef::secretEnc));
+    printDump1Line(sdef->secretEnc, sizeof(SecretDef::secretEnc));
   }
-  size_t declen = decrypt(deced, sdef.secretEnc, sizeof(SecretDef::secretEnc), status.iv, bsecret);  // 複合化
+  size_t declen = decrypt(output, sdef->secretEnc, sizeof(SecretDef::secretEnc), status.iv, status.bsecret);
   if (debug) {
     spn("Loaded Secret: ");
-    printDump1Line(deced, sizeof(deced));
+    printDump1Line(output, declen);
   }
+  return declen;
+}
+
+//--------------------------------------------------------------
+// 秘密鍵ファイルの中身を複合化してメモリに格納する
+//--------------------------------------------------------------
+bool loadSecretDef(const SecretDef* sdef) {
+  byte deced[32];
+  size_t declen = decryptSecretDef(sdef, deced);
   if (declen == sizeof(deced)) {
     memcpy(status.secret, deced, sizeof(status.secret));
+    mbedtls_platform_zeroize(deced, sizeof(deced));
+    if (!cryptoSessionBegin(status.secret)) {  // 鍵スケジュールを展開しておく
+      deleteSecret(CONF_SECRET_MEMORY);   // 展開できなければ施錠したときと同じく消去する
+      if (debug) sp("Load Secret failed! crypto session cannot begin.");
+      return false;
+    }
     if (debug) sp("Load Secret success!");
   } else {
     if (debug) sp("Load Secret failed! file cannot decrypt.");
+    mbedtls_platform_zeroize(deced, sizeof(deced));
     return false;
   }
-
   return true;
 }
 
 //--------------------------------------------------------------
-// 秘密鍵を保存する（メモリ→ストレージ）
+// 秘密鍵を読み込む（ストレージ→メモリ）
 //--------------------------------------------------------------
-bool saveSecret(SecretStore device) {
-  bool res;
-  byte bsecret[32];
+bool loadSecret(SecretStore device) {
   SecretDef sdef;
-  memcpy(sdef.magic, SecretMagic, sizeof(sdef.magic));
-  size_t enclen;
+  if (!readSecretDef(device, &sdef)) return false;
+  if (sdef.rfui[SRFUI_SHARD_X] != 0) {  // 分割片は1枚では復元できない（keyshard.h）
+    if (debug) sp("Load Secret failed! this is a key shard.");
+    return false;
+  }
+  return loadSecretDef(&sdef);
+}
 
-  // メモリ上の秘密鍵を暗号化する
-  getBSecret(bsecret, sizeof(bsecret) , BSECRET_PHRASE);   // 秘密鍵暗号化用の秘密鍵を生成する
+//--------------------------------------------------------------
+// メモリ上の秘密鍵を暗号化して秘密鍵ファイルの中身を作る
+//--------------------------------------------------------------
+bool makeSecretDef(SecretDef* sdef) {
+  memcpy(sdef->magic, SecretMagic, sizeof(sdef->magic));
+  memset(sdef->rfui, 0, sizeof(sdef->rfui));
+
+  // 秘密鍵暗号化用の秘密鍵は起動時に生成済み
   if (debug) {
     spn("B-Secret: ");
-    printDump1Line(bsecret, sizeof(bsecret));
+    printDump1Line(status.bsecret, sizeof(status.bsecret));
   }
-  enclen = encrypt(status.secret, sizeof(status.secret), status.iv, bsecret, sdef.secretEnc);
+  size_t enclen = encrypt(status.secret, sizeof(status.secret), status.iv, status.bsecret, sdef->secretEnc);
   if (debug) {
     spn("Secret-enc: ");
-    printDump1Line(sdef.secretEnc, enclen);
+    printDump1Line(sdef->secretEnc, enclen);
   }
   if (enclen != 32) {
     if (debug) sp("Save Secret failed! secret cannot encrypt.");
     return false;
   }
+  return true;
+}
+
+//--------------------------------------------------------------
+// 秘密鍵を保存する（メモリ→ストレージ）
+//--------------------------------------------------------------
+bool saveSecret(SecretStore device) {
+  bool res;
+  SecretDef sdef;
+
+  // メモリ上の秘密鍵を暗号化する
+  if (!makeSecretDef(&sdef)) return false;
 
   // ストレージに保存する
   res = false;
@@ -560,8 +431,8 @@ bool saveSecret(SecretStore device) {
     // res = nfcChangeProtect(true, false);   // Protect On, Format Quick
     // if (debug) spp("NFC Protect", tf(res));
     // if (res) {
-      res = saveNfc(&sdef, sizeof(SecretDef), SECRET_NFC_PARTITION_ADDR, PRT_PASSWD_RW);
-      if (debug) spp("saveNfc", tf(res));
+      res = saveSecretNfc(&sdef);
+      if (debug) spp("saveSecretNfc", tf(res));
     // }
   }
   if (!res) {
@@ -569,18 +440,26 @@ bool saveSecret(SecretStore device) {
     return false;
   }
 
+  // NFCは書き込んだスロットを読み返して確認済みなので、鍵スケジュールの展開だけ行う
+  if (device == CONF_SECRET_NFC) {
+    return cryptoSessionBegin(status.secret);
+  }
+
   // 再読み込み(複合化)して同一値になるかチェックする
   byte secretOrig[32];
   memcpy(secretOrig, status.secret, sizeof(secretOrig));
   memset(status.secret, 0, sizeof(secretOrig));
   if (!loadSecret(device)) {
+    mbedtls_platform_zeroize(secretOrig, sizeof(secretOrig));
     if (debug) sp("Verify Secret: cannot load!");   
     return false;
   }
   if (memcmp(secretOrig, status.secret, sizeof(secretOrig)) == 0) {
+    mbedtls_platform_zeroize(secretOrig, sizeof(secretOrig));
     if (debug) sp("Verify Secret: compare success!");
   } else {
     memcpy(status.secret, secretOrig, sizeof(secretOrig));
+    mbedtls_platform_zeroize(secretOrig, sizeof(secretOrig));
     if (debug) sp("Verify Secret: compare failed!");
     return false;
   }
@@ -593,27 +472,68 @@ bool saveSecret(SecretStore device) {
 //--------------------------------------------------------------
 bool deleteSecret(SecretStore device, ProtectMode mode) {
   bool res = false;
-  byte dummy[SECRET_SAVE_SIZE] = {0};
-  if (device == CONF_SECRET_NONE) { // メモリの場合
-    memset(status.secret, 0, sizeof(status.secret));
+  byte dummy[SECRET_NFC_NDEF_ADDR + SECRET_NFC_AREA_SIZE] = {0};
+  if (device == CONF_SECRET_NONE || device == CONF_SECRET_MEMORY) { // メモリの場合
+    mbedtls_platform_zeroize(status.secret, sizeof(status.secret));  // 最適化で消されないように消去する
+    cryptoSessionEnd();
     res = true;
     if (debug) sp("deleteSecret: memory");
   } else if (device == CONF_SECRET_NFC) {  // FatFSの場合
     if (mode == PRT_AUTO) mode = nfc._lastProtectMode;
-    res = saveNfc(dummy, sizeof(dummy), SECRET_NFC_PARTITION_ADDR, mode);   // NFCにダミーデータを上書き
+    if (nfc.isUltralight()) { // NDEFコンテナと旧形式の両方の範囲を上書きして、NDEFメッセージも消す
+      res = saveNfc(dummy, sizeof(dummy), 0, mode);
+      if (res) res = nfc.format(false);
+    } else {
+      res = saveNfc(dummy, SECRET_NFC_AREA_SIZE, SECRET_NFC_PARTITION_ADDR, mode);   // NFCの両スロットにダミーデータを上書き
+    }
     if (debug) spp("deleteSecret: NFC", tf(res));
   } else if (device == CONF_SECRET_FATFS) { // NFCの場合
-    res = saveFile(dummy, sizeof(dummy), FN_SECRETENC); // FatFSにダミーデータを保存
+    res = saveFile(dummy, SECRET_SAVE_SIZE, FN_SECRETENC); // FatFSにダミーデータを保存
     res = deleteFile(FN_SECRETENC); // ファイルを削除
     if (debug) spp("deleteSecret: FatFS", tf(res));
   }
   return res;
 }
 
+//--------------------------------------------------------------
+// 解錠セッション
+//   NFCから読み込んだ秘密鍵は、無操作のまま conf.unlockTimeout 秒が経過するか、電源オフで消去する
+//   解錠中はカードをかざし直さなくても、メモリ上の秘密鍵と展開済みの鍵スケジュールをそのまま使う
+//--------------------------------------------------------------
+uint32_t unlockLastUse = 0;   // 最後に操作した時刻(ms)
+
+// 操作があったことを記録する
+void unlockSessionTouch() {
+  unlockLastUse = millis();
+}
+
+// 解錠する（読み込んで解錠セッションを開始する）
+bool unlockSecret(SecretStore device) {
+  if (!loadSecret(device)) return false;
+  status.unlock = true;
+  unlockSessionTouch();
+  return true;
+}
+
+// 施錠する（メモリ上の秘密鍵と鍵スケジュールを消去する）
+void lockSecret() {
+  deleteSecret(CONF_SECRET_MEMORY);
+  status.unlock = false;
+}
+
+// 無操作でタイムアウトしたら施錠する（NFCに秘密鍵を保存している場合のみ）
+void unlockSessionCheck() {
+  if (!status.unlock || conf.saveSecret != CONF_SECRET_NFC || conf.unlockTimeout == 0) return;
+  if (millis() - unlockLastUse < (uint32_t)conf.unlockTimeout * 1000) return;
+  if (debug) sp("Unlock session timeout");
+  lockSecret();
+}
+
 // --------------------------------------------------------------------------------------
 // 再起動
 // --------------------------------------------------------------------------------------
 void restart() {
+  lockSecret();   // 秘密鍵をメモリから消去する
   ESP.restart();
 }
 
@@ -689,17 +609,22 @@ void progressbar(int per, int pbx, int pby, int pbw, int pbh) {   // default: pb
 //--------------------------------------------------------------
 bool nfcMountSequence(String title, uint32_t waitms) {
   // ダイアログを表示して、NFCが置かれるまで待つ。ボタンが押されたら中断
+  //   リーダーの初期化は最初に1回だけ行い、待っている間はカードの検出(REQA)だけを繰り返す
+  //   ダイアログは最初に1回だけ描き、点滅は画像の範囲だけ描き直す
   beep(BEEP_DOUBLE);
-  uint32_t tm = millis();
-  bool blink = false;
+  bool blink = true;
+  ui.imageNotice(IMAGE_nfc1, title, true); // 画像ダイアログ表示
+  uint32_t tm = millis() + 300;
+  if (nfc.isMounted()) nfc.unmountCard();
+  nfc.init();
   while (1) {
     if (tm <= millis()) {
       blink = !blink;
-      ui.imageNotice((blink ? IMAGE_nfc1 : IMAGE_nfc0), title, true); // 画像ダイアログ表示
+      ui.imageNoticeUpdate(blink ? IMAGE_nfc1 : IMAGE_nfc0); // 画像だけ差し替える
       tm = millis() + 300;
     }
-    if (nfc.mountCard(1)) break;      // マウント待ち (1ms待機=すぐ抜ける)
-    if (waitPressButton(100)) break;  // ボタン押し待ち (100ms待機)
+    if (nfc.detectCard() && nfc.mountCard(500, PRT_AUTO, false)) break;  // 検出したらそのままマウント
+    if (waitPressButton(40)) break;   // ボタン押し待ち (40ms待機)
   }
   bool res = nfc.isMounted();
   // 認識したらダイアログを変更
@@ -727,14 +652,84 @@ void nfcUnmountSequence(String title, bool dialog) {
   nfc.unmountCard();
   beep(BEEP_LONG);
   if (debug) sp("NFC unmounted");
+  if (conf.develop) nfc.printTimes();   // 開発者モードでは操作ごとの所要時間を表示する
   return;
 }
 
+//--------------------------------------------------------------
+// ダイアログ付き 解錠（NFCから秘密鍵を読み込む）　解錠済みならNFCは使わない
+//--------------------------------------------------------------
+bool unlockSequence(String title) {
+  if (status.unlock) {
+    unlockSessionTouch();
+    return true;
+  }
+  if (conf.saveSecret != CONF_SECRET_NFC) return false;
+
+  // 分割保存の場合は、必要な枚数が揃うまで続けてカードを受け付ける（順番は問わない）
+  KeyShardSet shards;
+  String mtitle = title;
+  while (1) {
+    bool res = nfcMountSequence(mtitle, 100);  // ダイアログ付き NFCマウント
+    int remain = res ? shardCollect(&shards) : -1;  // 読み込んで解錠する（分割片なら集める）
+    nfcUnmountSequence(mtitle, false);  // ダイアログなし NFCアンマウント
+    if (remain <= 0) break;
+    mtitle = title + " 残り" + String(remain) + "枚";
+  }
+  shardClear(&shards);
+  return status.unlock;
+}
+
+//--------------------------------------------------------------
+// ダイアログ付き QRコードスキャン　読み取った長さを返す（中断した場合とエラーの場合は0）
+//   バッファに入りきらない場合は、切り詰めると別の内容になるのでエラーにする
+//--------------------------------------------------------------
+size_t qrScanSequence(String title, String message, uint8_t* buff, size_t size) {
+  // 画面枠とボタンの表示
+  ui.selectNotice("CANCEL", title, message, 64, true); // 枠のみ表示
+
+  // スキャン開始
+  qrBufferClear();  // 読み取り前にゴミデータが入ってたら取り出す
+  if (debug) sp("Barcode scaning...");
+  qr.setDecodeTrigger(1);   // QRスキャン開始
+
+  // QRスキャン
+  size_t len = 0;
+  while (1) {
+    M5.update();
+    if (m5BtnAwasReleased()) {  // ボタン押したら中断
+      qr.setDecodeTrigger(0);   // QRスキャン終了
+      return 0;
+    }
+    if (qr.getDecodeReadyStatus() == 1) {   // スキャン完了
+      // 読んだ値を取得
+      len = qr.getDecodeLength();
+      if (len > size-1) {
+        qr.getDecodeData(buff, size-1);   // 読んだ値は捨てる
+        memset(buff, 0, size);
+        if (debug) spp("scaned len (too long)", len);
+        ui.selectNotice("OK", title, "エラー! QRコードが長すぎます", 72, false); // ダイアログ表示
+        return 0;
+      }
+      qr.getDecodeData(buff, len);
+      buff[len] = 0;
+      if (debug) {
+        spp("scaned len", len);
+        spp("scaned data", (const char*)buff);
+      }
+      break;
+    }
+    delay(10);
+  }
+  return len;
+}
+
 //--------------------------------------------------------------
 // M5Unit-QR読み取り前にゴミデータが入ってたらクリアする
 //--------------------------------------------------------------
 void qrBufferClear() {
   if (!status.unitQRready) return;
+  qrcodeBusUse();   // この後のスキャンもこのクロックで通信する
   // if (qr.available()) String devnull = qr.getDecodeData();
   if (qr.getDecodeReadyStatus() == 1) {
     uint8_t buff[512] = {0};
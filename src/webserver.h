@@ -371,6 +371,7 @@ void handleUpload(HTTPRequest * req, HTTPResponse * res) {
     }
     file.close();
     if (debug) sp("file saved. filename="+path+" size="+String(filesize));
+    vaultInvalidate();  // OTPの保存ファイルが置き換えられた可能性があるので索引を破棄する
   }
 
   // アップロードが完了したらリダイレクトする
@@ -401,6 +402,7 @@ void handleDelete(HTTPRequest * req, HTTPResponse * res) {
   if (debug) spf("File Delete: %s (%d)\n", path.c_str(), filesize);
   if (filesize > -1) {
     deleteFile(path);
+    vaultInvalidate();  // OTPの保存ファイルが削除された可能性があるので索引を破棄する
   } else {
     handle404(req, res);
   }
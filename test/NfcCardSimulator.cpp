@@ -0,0 +1,455 @@
+/*
+  NfcCardSimulator.cpp
+  NfcEasyWriterをカードなしで動かすための、MFRC522とカードのシミュレータ
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#include "NfcCardSimulator.h"
+
+// [Classic] Access Bit(C1C2C3)ごとの権限　bit0=KeyA, bit1=KeyB
+static const uint8_t kDataRead[8]     = { 3, 3, 3, 2, 3, 2, 3, 0 };  // データブロックの読み込み
+static const uint8_t kDataWrite[8]    = { 3, 0, 0, 2, 2, 0, 2, 0 };  // データブロックの書き込み
+static const uint8_t kTrKeyAWrite[8]  = { 1, 1, 0, 2, 2, 0, 0, 0 };  // トレーラーのKeyAの書き込み
+static const uint8_t kTrAccRead[8]    = { 1, 1, 1, 3, 3, 3, 3, 3 };  // トレーラーのAccess Bitの読み込み
+static const uint8_t kTrAccWrite[8]   = { 0, 1, 0, 2, 0, 2, 0, 0 };  // トレーラーのAccess Bitの書き込み
+static const uint8_t kTrKeyBRead[8]   = { 1, 1, 1, 0, 0, 0, 0, 0 };  // トレーラーのKeyBの読み込み
+static const uint8_t kTrKeyBWrite[8]  = { 1, 1, 0, 2, 2, 0, 0, 0 };  // トレーラーのKeyBの書き込み
+
+// ISO14443-3 TypeAのCRC_Aをdataの後ろに付ける
+static void appendCrcA(byte* data, size_t dataSize) {
+  uint16_t crc = 0x6363;
+  for (size_t i=0; i<dataSize; i++) {
+    uint8_t ch = data[i] ^ (uint8_t)(crc & 0xFF);
+    ch ^= (uint8_t)(ch << 4);
+    crc = (crc >> 8) ^ ((uint16_t)ch << 8) ^ ((uint16_t)ch << 3) ^ ((uint16_t)ch >> 4);
+  }
+  data[dataSize] = crc & 0xFF;
+  data[dataSize+1] = crc >> 8;
+}
+
+// カードを置く（工場出荷時の内容で初期化する）
+void NfcCardSimulator::insertCard(SimCardType type, const byte* uid) {
+  removeCard();
+  _type = type;
+  _authFailsUL = 0;
+  memset(_mem, 0, sizeof(_mem));
+  if (isClassic()) {
+    const byte uidDefault[4] = { 0xC1, 0xA5, 0x10, 0x01 };
+    memcpy(_uidBytes, (uid != nullptr) ? uid : uidDefault, 4);
+    // Block0: UID, BCC, SAK, ATQA, 製造者データ
+    memcpy(_mem, _uidBytes, 4);
+    _mem[4] = _uidBytes[0] ^ _uidBytes[1] ^ _uidBytes[2] ^ _uidBytes[3];
+    _mem[5] = 0x08;
+    _mem[6] = 0x04;
+    _mem[7] = 0x00;
+    for (int i=8; i<16; i++) _mem[i] = 0x60 + i;
+    // セクタートレーラー: KeyA=FF.., Access Bit=FF 07 80(出荷時), GPB=69, KeyB=FF..
+    for (int sector=0; sector<16; sector++) {
+      byte* tr = _mem + (sector * 4 + 3) * 16;
+      memset(tr, 0xFF, 16);
+      tr[6] = 0xFF;
+      tr[7] = 0x07;
+      tr[8] = 0x80;
+      tr[9] = 0x69;
+    }
+  } else if (isNtag()) {
+    const byte uidDefault[7] = { 0x04, 0x5A, 0x11, 0x22, 0x33, 0x44, 0x55 };
+    memcpy(_uidBytes, (uid != nullptr) ? uid : uidDefault, 7);
+    // Page0-2: UID, BCC0, BCC1, 内部データ, ロックバイト
+    memcpy(_mem, _uidBytes, 3);
+    _mem[3] = 0x88 ^ _uidBytes[0] ^ _uidBytes[1] ^ _uidBytes[2];
+    memcpy(_mem + 4, _uidBytes + 3, 4);
+    _mem[8] = _uidBytes[3] ^ _uidBytes[4] ^ _uidBytes[5] ^ _uidBytes[6];
+    _mem[9] = 0x48;
+    // Page3: CC（Byte2がデータ領域のサイズ）
+    _mem[12] = 0xE1;
+    _mem[13] = 0x10;
+    _mem[14] = (_type == SIM_NTAG213) ? 0x12 : (_type == SIM_NTAG215) ? 0x3E : 0x6D;
+    // Page4: 空のNDEFメッセージ
+    _mem[16] = 0x03;
+    _mem[17] = 0x00;
+    _mem[18] = 0xFE;
+    // 動的ロック、CFG0(AUTH0=FF)、CFG1(ACCESS=0)、PWD=FFFFFFFF、PACK=0000
+    uint8_t cfg = configPageUL();
+    _mem[(cfg-1)*4+3] = 0xBD;
+    _mem[cfg*4] = 0x04;
+    _mem[cfg*4+3] = 0xFF;
+    _mem[(cfg+1)*4+1] = 0x05;
+    memset(_mem + (cfg+2)*4, 0xFF, 4);
+  }
+  if (_debug) spf("Sim: insert card type=%d\n", _type);
+}
+
+// カードを取り除く
+void NfcCardSimulator::removeCard() {
+  _type = SIM_NOCARD;
+  _state = SS_IDLE;
+  _authSector = -1;
+  _authedUL = false;
+  memset(&_uid, 0, sizeof(_uid));
+}
+
+// カードのメモリのサイズ
+uint16_t NfcCardSimulator::memorySize() {
+  if (isClassic()) return 64 * 16;
+  if (isNtag()) return (lastPageUL() + 1) * 4;
+  return 0;
+}
+
+// 統計をリセットする
+void NfcCardSimulator::resetStats() {
+  _stats = NfcSimStats();
+}
+
+// NAKを返してIDLEに戻る（認証状態も解除される）
+byte NfcCardSimulator::nak() {
+  _stats.naks ++;
+  _state = SS_IDLE;
+  _authSector = -1;
+  _authedUL = false;
+  if (_debug) sp("Sim: NAK");
+  return MFRC522_I2C::STATUS_ERROR;
+}
+
+// コマンドを受け付けられる状態か（Classicはリーダーとカードの暗号化の有無が一致していること）
+bool NfcCardSimulator::commandReady() {
+  if (_type == SIM_NOCARD || _state != SS_ACTIVE) return false;
+  if (isClassic() && (_authSector >= 0) != _cryptoOn) return false;
+  return true;
+}
+
+// リーダーの初期化（ソフトリセットでRFがいったん止まるので、カードも電源が切れてIDLEに戻る）
+void NfcCardSimulator::PCD_Init_without_resetpin() {
+  _cryptoOn = false;
+  _state = SS_IDLE;
+  _authSector = -1;
+  _authedUL = false;
+}
+
+// レジスタの読み込み（バージョンだけ返す）
+byte NfcCardSimulator::PCD_ReadRegister(byte reg) {
+  if (reg == MFRC522_I2C::VersionReg) return 0x15;  // WS1850Sと同じ値
+  return 0;
+}
+
+// REQA　IDLEのカードだけが応答する
+bool NfcCardSimulator::PICC_IsNewCardPresent() {
+  _stats.roundTrips ++;
+  if (_type == SIM_NOCARD || _cryptoOn) return false;
+  if (_state == SS_IDLE || _state == SS_READY) {
+    _state = SS_READY;
+    return true;
+  }
+  if (_state == SS_ACTIVE) _state = SS_IDLE;   // 想定外のコマンドでIDLEに戻る
+  return false;
+}
+
+// 衝突防止と選択　UIDが7バイトならカスケード2段
+bool NfcCardSimulator::PICC_ReadCardSerial() {
+  uint8_t uidSize = isClassic() ? 4 : 7;
+  if (_type == SIM_NOCARD || _state != SS_READY || _cryptoOn) {
+    _stats.roundTrips ++;
+    return false;
+  }
+  _stats.roundTrips += (uidSize == 4) ? 2 : 4;
+  _stats.selects ++;
+  _state = SS_ACTIVE;
+  _authSector = -1;
+  _authedUL = false;
+  _uid.size = uidSize;
+  memcpy(_uid.uidByte, _uidBytes, uidSize);
+  _uid.sak = isClassic() ? 0x08 : 0x00;
+  if (isNtag()) {   // NTAGの設定は選択したときに反映される（書き換えてもその回の選択中は前の設定のまま）
+    _auth0UL = _mem[configPageUL()*4+3];
+    _accessUL = _mem[(configPageUL()+1)*4];
+  }
+  return true;
+}
+
+// WUPA　HALTのカードも起こす
+byte NfcCardSimulator::PICC_WakeupA(byte* bufferATQA, byte* bufferSize) {
+  if (bufferATQA == nullptr || *bufferSize < 2) return MFRC522_I2C::STATUS_NO_ROOM;
+  _stats.roundTrips ++;
+  if (_type == SIM_NOCARD || _cryptoOn) return MFRC522_I2C::STATUS_TIMEOUT;
+  if (_state == SS_ACTIVE) {    // 選択中（認証中）のカードは応答せずIDLEに戻るだけ
+    _state = SS_IDLE;
+    _authSector = -1;
+    _authedUL = false;
+    return MFRC522_I2C::STATUS_TIMEOUT;
+  }
+  _state = SS_READY;
+  bufferATQA[0] = isClassic() ? 0x04 : 0x44;
+  bufferATQA[1] = 0x00;
+  *bufferSize = 2;
+  return MFRC522_I2C::STATUS_OK;
+}
+
+// HLTA　応答はないのでSTATUS_OKを返す
+byte NfcCardSimulator::PICC_HaltA() {
+  _stats.roundTrips ++;
+  if (commandReady()) {
+    _state = SS_HALT;
+  } else if (_state == SS_ACTIVE) {
+    _state = SS_IDLE;
+  }
+  _authSector = -1;
+  _authedUL = false;
+  return MFRC522_I2C::STATUS_OK;
+}
+
+// SAKからカードの種類を返す
+byte NfcCardSimulator::PICC_GetType(byte sak) {
+  switch (sak & 0x7F) {
+    case 0x08: return MFRC522_I2C::PICC_TYPE_MIFARE_1K;
+    case 0x18: return MFRC522_I2C::PICC_TYPE_MIFARE_4K;
+    case 0x00: return MFRC522_I2C::PICC_TYPE_MIFARE_UL;
+    default:   return MFRC522_I2C::PICC_TYPE_UNKNOWN;
+  }
+}
+
+// カードの種類の名前
+String NfcCardSimulator::PICC_GetTypeName(byte piccType) {
+  switch (piccType) {
+    case MFRC522_I2C::PICC_TYPE_MIFARE_1K: return "MIFARE 1KB (simulated)";
+    case MFRC522_I2C::PICC_TYPE_MIFARE_4K: return "MIFARE 4KB (simulated)";
+    case MFRC522_I2C::PICC_TYPE_MIFARE_UL: return "MIFARE Ultralight (simulated NTAG)";
+    default: return "Unknown type";
+  }
+}
+
+// [Classic] Crypto1の認証（認証要求と乱数の交換で2往復）
+byte NfcCardSimulator::PCD_Authenticate(byte command, byte blockAddr, MFRC522_I2C::MIFARE_Key* key, MFRC522_I2C::Uid* uid) {
+  _stats.roundTrips += 2;
+  _stats.auths ++;
+  if (!commandReady() || !isClassic() || blockAddr >= 64 || key == nullptr || uid == nullptr) {
+    _cryptoOn = false;
+    nak();
+    return MFRC522_I2C::STATUS_TIMEOUT;
+  }
+  uint8_t sector = blockAddr / 4;
+  const byte* tr = _mem + (sector * 4 + 3) * 16;
+  bool useKeyB = (command == MFRC522_I2C::PICC_CMD_MF_AUTH_KEY_B);
+  bool match = (memcmp(key->keyByte, useKeyB ? tr + 10 : tr, 6) == 0);
+  match = match && (memcmp(uid->uidByte, _uidBytes, 4) == 0);   // UIDも暗号の計算に使われる
+  if (!accessBitsValid(sector) || !match) {   // Access Bitが壊れたセクタは認証できない
+    _cryptoOn = false;
+    nak();
+    return MFRC522_I2C::STATUS_TIMEOUT;
+  }
+  _authSector = sector;
+  _authKeyB = useKeyB;
+  _cryptoOn = true;
+  return MFRC522_I2C::STATUS_OK;
+}
+
+// [Classic] リーダー側の暗号化を止める（カードは認証状態のままなので選択し直すまで通じない）
+void NfcCardSimulator::PCD_StopCrypto1() {
+  _cryptoOn = false;
+}
+
+// READ　Classicは1ブロック、NTAGは4ページ（16バイト＋CRC）
+byte NfcCardSimulator::MIFARE_Read(byte blockAddr, byte* buffer, byte* bufferSize) {
+  if (buffer == nullptr || *bufferSize < 18) return MFRC522_I2C::STATUS_NO_ROOM;
+  _stats.roundTrips ++;
+  _stats.reads ++;
+  if (!commandReady()) return nak();
+  if (isClassic()) {
+    if (blockAddr >= 64 || blockAddr / 4 != _authSector || !canRead(blockAddr)) return nak();
+    memcpy(buffer, _mem + blockAddr * 16, 16);
+    if (blockAddr % 4 == 3) {   // セクタートレーラー　KeyAは常に0、他は権限がなければ0
+      uint8_t sector = blockAddr / 4;
+      uint8_t keyMask = _authKeyB ? 2 : 1;
+      uint8_t g = accessBits(sector, 3);
+      memset(buffer, 0, 6);
+      if (!(kTrAccRead[g] & keyMask)) memset(buffer + 6, 0, 4);
+      if (!(kTrKeyBRead[g] & keyMask)) memset(buffer + 10, 0, 6);
+    }
+  } else {
+    if (blockAddr > lastPageUL() || protectedPageUL(blockAddr, false)) return nak();
+    readPagesUL(blockAddr, 4, buffer);
+  }
+  appendCrcA(buffer, 16);
+  *bufferSize = 18;
+  return MFRC522_I2C::STATUS_OK;
+}
+
+// WRITE（コマンドとデータで2往復）　NTAGはCOMPATIBILITY_WRITEとして先頭4バイトだけ書く
+byte NfcCardSimulator::MIFARE_Write(byte blockAddr, byte* buffer, byte bufferSize) {
+  if (buffer == nullptr || bufferSize < 16) return MFRC522_I2C::STATUS_INVALID;
+  if (isNtag()) {
+    _stats.roundTrips ++;   // 残りの1往復と書き込み回数はMIFARE_Ultralight_Write()で数える
+    return MIFARE_Ultralight_Write(blockAddr, buffer, 4);
+  }
+  _stats.roundTrips += 2;
+  _stats.writes ++;
+  if (!commandReady() || _writeLimit == 0) return nak();
+  if (blockAddr == 0 || blockAddr >= 64 || blockAddr / 4 != _authSector) return nak();
+  _writeLimit --;
+  byte* dst = _mem + blockAddr * 16;
+  if (blockAddr % 4 == 3) {   // セクタートレーラー　権限のある項目だけ書き換わる
+    uint8_t sector = blockAddr / 4;
+    uint8_t keyMask = _authKeyB ? 2 : 1;
+    uint8_t g = accessBits(sector, 3);
+    if (_authKeyB && keyBReadable(sector)) return nak();
+    bool keyA = (kTrKeyAWrite[g] & keyMask), acc = (kTrAccWrite[g] & keyMask), keyB = (kTrKeyBWrite[g] & keyMask);
+    if (!keyA && !acc && !keyB) return nak();
+    if (keyA) memcpy(dst, buffer, 6);
+    if (acc) memcpy(dst + 6, buffer + 6, 4);
+    if (keyB) memcpy(dst + 10, buffer + 10, 6);
+  } else {
+    if (!canWrite(blockAddr)) return nak();
+    memcpy(dst, buffer, 16);
+  }
+  return MFRC522_I2C::STATUS_OK;
+}
+
+// [Classic] Access Bitを計算する（MFRC522_I2Cと同じ）
+void NfcCardSimulator::MIFARE_SetAccessBits(byte* accessBitBuffer, byte g0, byte g1, byte g2, byte g3) {
+  byte c1 = ((g3 & 4) << 1) | ((g2 & 4) << 0) | ((g1 & 4) >> 1) | ((g0 & 4) >> 2);
+  byte c2 = ((g3 & 2) << 2) | ((g2 & 2) << 1) | ((g1 & 2) << 0) | ((g0 & 2) >> 1);
+  byte c3 = ((g3 & 1) << 3) | ((g2 & 1) << 2) | ((g1 & 1) << 1) | ((g0 & 1) << 0);
+  accessBitBuffer[0] = (~c2 & 0xF) << 4 | (~c1 & 0xF);
+  accessBitBuffer[1] = c1 << 4 | (~c3 & 0xF);
+  accessBitBuffer[2] = c3 << 4 | c2;
+}
+
+// [NTAG] WRITE 1ページ　Page2のロックバイトとPage3のCCはORで書き込まれる
+byte NfcCardSimulator::MIFARE_Ultralight_Write(byte page, byte* buffer, byte bufferSize) {
+  if (buffer == nullptr || bufferSize < 4) return MFRC522_I2C::STATUS_INVALID;
+  _stats.roundTrips ++;
+  _stats.writes ++;
+  if (!commandReady() || !isNtag()) return nak();
+  uint8_t cfg = configPageUL();
+  bool cfgLock = (_accessUL & 0x40);
+  if (page < 2 || page > lastPageUL() || protectedPageUL(page, true)) return nak();
+  if (cfgLock && (page == cfg || page == cfg+1)) return nak();
+  if (_writeLimit == 0) return nak();
+  _writeLimit --;
+  byte* dst = _mem + page * 4;
+  if (page == 2) {
+    dst[2] |= buffer[2];
+    dst[3] |= buffer[3];
+  } else if (page == 3) {
+    for (int i=0; i<4; i++) dst[i] |= buffer[i];
+  } else {
+    memcpy(dst, buffer, 4);
+  }
+  return MFRC522_I2C::STATUS_OK;
+}
+
+// [NTAG] PWD_AUTH　失敗回数が2^AUTHLIMに達したら正しいパスワードでも認証できなくなる
+byte NfcCardSimulator::MIFARE_Ultralight_Authenticate(byte* password, byte* passwordLen, byte* pack, byte* packLen) {
+  if (password == nullptr || *passwordLen != 4 || pack == nullptr || *packLen != 4) return MFRC522_I2C::STATUS_ERROR;
+  _stats.roundTrips ++;
+  _stats.auths ++;
+  if (!commandReady() || !isNtag()) return nak();
+  uint8_t cfg = configPageUL();
+  uint8_t authLim = _accessUL & 0x07;
+  if (authLim > 0 && _authFailsUL >= (1 << authLim)) return nak();
+  if (memcmp(password, _mem + (cfg+2)*4, 4) != 0) {
+    if (_authFailsUL < 255) _authFailsUL ++;
+    return nak();
+  }
+  _authFailsUL = 0;
+  _authedUL = true;
+  memcpy(pack, _mem + (cfg+3)*4, 2);
+  appendCrcA(pack, 2);
+  *packLen = 4;
+  return MFRC522_I2C::STATUS_OK;
+}
+
+// [NTAG] FAST_READ　応答がリーダーのFIFO(64バイト)に収まらなければエラー
+byte NfcCardSimulator::NTAG_FastRead(byte startPage, byte endPage, byte* buffer, byte* bufferSize) {
+  if (buffer == nullptr || endPage < startPage || *bufferSize < (endPage - startPage + 1) * 4 + 2) {
+    return MFRC522_I2C::STATUS_NO_ROOM;
+  }
+  _stats.roundTrips ++;
+  _stats.reads ++;
+  if (!commandReady() || !isNtag()) return nak();
+  if (endPage > lastPageUL()) return nak();
+  for (uint16_t page=startPage; page<=endPage; page++) {
+    if (protectedPageUL(page, false)) return nak();
+  }
+  uint8_t pages = endPage - startPage + 1;
+  if (pages * 4 + 2 > 64) return MFRC522_I2C::STATUS_ERROR;   // FIFOのオーバーフロー
+  readPagesUL(startPage, pages, buffer);
+  appendCrcA(buffer, pages * 4);
+  *bufferSize = pages * 4 + 2;
+  return MFRC522_I2C::STATUS_OK;
+}
+
+// [Classic] Access Bitの反転ビットが一致しているか
+bool NfcCardSimulator::accessBitsValid(uint8_t sector) {
+  const byte* tr = _mem + (sector * 4 + 3) * 16;
+  return ((tr[6] & 0x0F) ^ (tr[7] >> 4)) == 0x0F
+      && ((tr[6] >> 4) ^ (tr[8] & 0x0F)) == 0x0F
+      && ((tr[7] & 0x0F) ^ (tr[8] >> 4)) == 0x0F;
+}
+
+// [Classic] ブロックのAccess Bit(C1C2C3)
+uint8_t NfcCardSimulator::accessBits(uint8_t sector, uint8_t block) {
+  const byte* tr = _mem + (sector * 4 + 3) * 16;
+  uint8_t c1 = (tr[7] >> (4 + block)) & 1;
+  uint8_t c2 = (tr[8] >> block) & 1;
+  uint8_t c3 = (tr[8] >> (4 + block)) & 1;
+  return (c1 << 2) | (c2 << 1) | c3;
+}
+
+// [Classic] KeyBが読める設定か（その場合KeyBで認証してもアクセスできない）
+bool NfcCardSimulator::keyBReadable(uint8_t sector) {
+  return kTrKeyBRead[accessBits(sector, 3)] != 0;
+}
+
+// [Classic] 認証したキーでデータブロック（トレーラーは一部）を読めるか
+bool NfcCardSimulator::canRead(uint8_t blockAddr) {
+  uint8_t sector = blockAddr / 4;
+  if (_authKeyB && keyBReadable(sector)) return false;
+  if (blockAddr % 4 == 3) return true;
+  return kDataRead[accessBits(sector, blockAddr % 4)] & (_authKeyB ? 2 : 1);
+}
+
+// [Classic] 認証したキーでデータブロックに書き込めるか
+bool NfcCardSimulator::canWrite(uint8_t blockAddr) {
+  uint8_t sector = blockAddr / 4;
+  if (_authKeyB && keyBReadable(sector)) return false;
+  return kDataWrite[accessBits(sector, blockAddr % 4)] & (_authKeyB ? 2 : 1);
+}
+
+// [NTAG] PACKのページ
+uint8_t NfcCardSimulator::lastPageUL() {
+  return configPageUL() + 3;
+}
+
+// [NTAG] CFG0のページ
+uint8_t NfcCardSimulator::configPageUL() {
+  switch (_type) {
+    case SIM_NTAG213: return 41;
+    case SIM_NTAG215: return 131;
+    case SIM_NTAG216: return 227;
+    default:          return 0;
+  }
+}
+
+// [NTAG] 認証なしではアクセスできないページか（AUTH0以降。読み込みはACCESSのPROTが1のときだけ）
+// 設定ページ自身もAUTH0以降なら保護される
+bool NfcCardSimulator::protectedPageUL(uint8_t page, bool write) {
+  if (_authedUL) return false;
+  if (page < _auth0UL) return false;
+  return write || (_accessUL & 0x80);
+}
+
+// [NTAG] ページを読み込む　最終ページを超えたらPage0に戻る、PWD/PACKと読めないページは0（簡略化）
+void NfcCardSimulator::readPagesUL(uint8_t startPage, uint8_t pages, byte* buffer) {
+  uint8_t cfg = configPageUL();
+  for (uint8_t i=0; i<pages; i++) {
+    uint16_t page = startPage + i;
+    if (page > lastPageUL()) page -= lastPageUL() + 1;
+    if (page >= cfg+2 || protectedPageUL(page, false)) {
+      memset(buffer + i*4, 0, 4);
+    } else {
+      memcpy(buffer + i*4, _mem + page*4, 4);
+    }
+  }
+}
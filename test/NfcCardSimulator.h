@@ -0,0 +1,104 @@
+/*
+  NfcCardSimulator.h
+  NfcEasyWriterをカードなしで動かすための、MFRC522とカードのシミュレータ
+
+  NfcTransceiverを実装し、メモリ上のカードに対して読み書きする
+  想定するカード: MIFARE Classic 1K, NTAG213/215/216
+  Classic: セクタートレーラーのKeyA/KeyB/Access Bitを解釈する（Access Bitが壊れたセクタは認証できない）
+  NTAG: PWD/PACK、AUTH0、ACCESSのPROT/CFGLCK/AUTHLIMを解釈する
+  カードの状態(IDLE/READY/ACTIVE/HALT)も再現するので、エラー後の選択し直しも実機と同じ流れになる
+  無線の往復回数を数えるので、読み書きの方法を比べるのに使える
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#pragma once
+#include "NfcEasyWriter.h"
+
+// シミュレートするカードの種類
+enum SimCardType : uint8_t { SIM_NOCARD, SIM_CLASSIC1K, SIM_NTAG213, SIM_NTAG215, SIM_NTAG216 };
+
+struct NfcSimStats { // シミュレータの統計（無線の往復回数）
+  uint32_t roundTrips = 0;  // 無線の往復回数の合計（Classicの認証とWRITEは2往復、選択はカスケードごとに2往復）
+  uint32_t selects = 0;     // 選択した回数
+  uint32_t auths = 0;       // 認証した回数（Crypto1、PWD_AUTH）
+  uint32_t reads = 0;       // READ/FAST_READの回数
+  uint32_t writes = 0;      // WRITEの回数
+  uint32_t naks = 0;        // NAKやタイムアウトになった回数（カードはIDLEに戻る）
+};
+
+class NfcCardSimulator : public NfcTransceiver {
+public:
+  NfcSimStats _stats;   // 無線の往復回数
+  bool _debug = false;  // Serialにデバッグ出力
+  uint32_t _writeLimit = UINT32_MAX;  // 残りの書き込みできる回数　0になったらWRITEはNAKになる（書き込み中の電源断の再現）
+
+  // カードを置く（工場出荷時の内容で初期化する。uidを省略したら固定値）
+  void insertCard(SimCardType type, const byte* uid=nullptr);
+
+  // カードを取り除く
+  void removeCard();
+
+  // カードの種類
+  SimCardType cardType() { return _type; }
+
+  // カードのメモリ（Classicはブロック×16バイト、NTAGはページ×4バイト）
+  byte* memory() { return _mem; }
+  uint16_t memorySize();
+
+  // 統計をリセットする
+  void resetStats();
+
+  // 以下はNfcTransceiverの実装
+  void PCD_Init_without_resetpin() override;
+  byte PCD_ReadRegister(byte reg) override;
+  bool PICC_IsNewCardPresent() override;
+  bool PICC_ReadCardSerial() override;
+  byte PICC_WakeupA(byte* bufferATQA, byte* bufferSize) override;
+  byte PICC_HaltA() override;
+  MFRC522_I2C::Uid& piccUid() override { return _uid; }
+  byte PICC_GetType(byte sak) override;
+  String PICC_GetTypeName(byte piccType) override;
+  byte PCD_Authenticate(byte command, byte blockAddr, MFRC522_I2C::MIFARE_Key* key, MFRC522_I2C::Uid* uid) override;
+  void PCD_StopCrypto1() override;
+  byte MIFARE_Read(byte blockAddr, byte* buffer, byte* bufferSize) override;
+  byte MIFARE_Write(byte blockAddr, byte* buffer, byte bufferSize) override;
+  void MIFARE_SetAccessBits(byte* accessBitBuffer, byte g0, byte g1, byte g2, byte g3) override;
+  byte MIFARE_Ultralight_Write(byte page, byte* buffer, byte bufferSize) override;
+  byte MIFARE_Ultralight_Authenticate(byte* password, byte* passwordLen, byte* pack, byte* packLen) override;
+  byte NTAG_FastRead(byte startPage, byte endPage, byte* buffer, byte* bufferSize) override;
+
+private:
+  enum SimState : uint8_t { SS_IDLE, SS_READY, SS_ACTIVE, SS_HALT };  // ISO14443-3のカードの状態
+  SimCardType _type = SIM_NOCARD;
+  SimState _state = SS_IDLE;
+  byte _mem[1024];          // Classic 1K=64ブロック、NTAG216=231ページ
+  byte _uidBytes[7];
+  MFRC522_I2C::Uid _uid;    // 選択したときにリーダー側に渡るUID
+  int8_t _authSector = -1;  // [Classic] 認証済みのセクタ（-1は未認証）
+  bool _authKeyB = false;   // [Classic] KeyBで認証した
+  bool _cryptoOn = false;   // [Classic] リーダー側のCrypto1が有効
+  bool _authedUL = false;   // [NTAG] PWD_AUTH済み
+  uint8_t _authFailsUL = 0; // [NTAG] PWD_AUTHの連続失敗回数（AUTHLIMと比較する）
+  uint8_t _auth0UL = 0xFF;  // [NTAG] 選択したときのAUTH0
+  uint8_t _accessUL = 0;    // [NTAG] 選択したときのACCESS（PROT, CFGLCK, AUTHLIM）
+
+  bool isClassic() { return _type == SIM_CLASSIC1K; }
+  bool isNtag() { return _type == SIM_NTAG213 || _type == SIM_NTAG215 || _type == SIM_NTAG216; }
+  byte nak();   // NAKを返してIDLEに戻る
+  bool commandReady();  // コマンドを受け付けられる状態か（Crypto1の食い違いもここで判定）
+
+  // [Classic] Access Bit
+  bool accessBitsValid(uint8_t sector);
+  uint8_t accessBits(uint8_t sector, uint8_t block);  // C1C2C3の3ビット
+  bool canRead(uint8_t blockAddr);
+  bool canWrite(uint8_t blockAddr);
+  bool keyBReadable(uint8_t sector);
+
+  // [NTAG] ページ構成と設定
+  uint8_t lastPageUL();   // PACKのページ
+  uint8_t configPageUL(); // CFG0のページ
+  bool protectedPageUL(uint8_t page, bool write);  // 認証なしではアクセスできないページか
+  void readPagesUL(uint8_t startPage, uint8_t pages, byte* buffer);  // PWD/PACKは0で読める
+};
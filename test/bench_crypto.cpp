@@ -0,0 +1,159 @@
+/*
+  bench_crypto.cpp
+  OTPの秘密鍵の復号化の速度(PC)　従来方式(毎回鍵展開＋16byteずつ)、decrypt()、暗号化セッションの比較
+  認証付き(version 2、AES-GCM)とCBC(version 1)のレコードの比較、保存ファイルの一括読み込み
+
+  実機のbenchmarkCrypto()と同じ処理をPCで計測する。結果が一致しなければ失敗として終了する
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#include "hosttest.h"
+#include "hostenv.h"
+#include "coreutil.h"
+#include "totputil.h"
+#include "otpvault.h"
+
+const int BENCH_RECORDS = 100000;
+const size_t SECLEN = sizeof(TotpParams::secret);
+
+static byte benchKey[32], benchIv[16];
+static std::vector<TotpParams> benchRecords(BENCH_RECORDS);
+static byte benchRef[SECLEN];   // 最後のレコードの平文
+
+// 暗号化したレコードを用意する
+static void setupRecords() {
+  esp_fill_random(benchKey, sizeof(benchKey));
+  esp_fill_random(benchIv, sizeof(benchIv));
+  byte plain[SECLEN];
+  for (int i=0; i<BENCH_RECORDS; i++) {
+    memset(plain, 0, SECLEN);
+    snprintf(reinterpret_cast<char*>(plain), SECLEN, "GEZDGNBVGY3TQOJQGEZDGNBVGY3TQOJQ%c%c%c%c",   // Base32の文字だけ
+      'A' + (i / 17576) % 26, 'A' + (i / 676) % 26, 'A' + (i / 26) % 26, 'A' + i % 26);
+    encrypt(plain, SECLEN, benchIv, benchKey, reinterpret_cast<byte*>(benchRecords[i].secret));
+  }
+  memcpy(benchRef, plain, SECLEN);
+}
+
+static void report(const char* name, double sec) {
+  printf("  %-8s: %8.3f s, %10.0f records/s\n", name, sec, BENCH_RECORDS / sec);
+}
+
+// CBCの3つの方式
+void benchCbc() {
+  byte dec[SECLEN];
+  printf("[AES] %d records x %d bytes\n", BENCH_RECORDS, (int)SECLEN);
+
+  // 従来方式　レコードごとに鍵を展開し、16byteずつ処理する
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i=0; i<BENCH_RECORDS; i++) {
+    byte ivCopy[16];
+    memcpy(ivCopy, benchIv, sizeof(ivCopy));
+    mbedtls_aes_context aes;
+    mbedtls_aes_init(&aes);
+    mbedtls_aes_setkey_dec(&aes, benchKey, 256);
+    for (size_t j=0; j<SECLEN; j+=16) {
+      byte block[16];
+      mbedtls_aes_crypt_cbc(&aes, MBEDTLS_AES_DECRYPT, 16, ivCopy, reinterpret_cast<byte*>(benchRecords[i].secret)+j, block);
+      memcpy(dec+j, block, 16);
+    }
+    mbedtls_aes_free(&aes);
+  }
+  report("legacy", benchSeconds(t0));
+  CHECK_MEM(dec, benchRef, SECLEN);
+
+  // decrypt()　レコードごとに鍵を展開し、まとめて処理する
+  memset(dec, 0, SECLEN);
+  t0 = std::chrono::steady_clock::now();
+  for (int i=0; i<BENCH_RECORDS; i++) decrypt(dec, reinterpret_cast<byte*>(benchRecords[i].secret), SECLEN, benchIv, benchKey);
+  report("decrypt", benchSeconds(t0));
+  CHECK_MEM(dec, benchRef, SECLEN);
+
+  // 暗号化セッション　鍵の展開は1回だけ
+  memset(dec, 0, SECLEN);
+  t0 = std::chrono::steady_clock::now();
+  CHECK(cryptoSessionBegin(benchKey));
+  for (int i=0; i<BENCH_RECORDS; i++) sessionDecrypt(dec, reinterpret_cast<byte*>(benchRecords[i].secret), SECLEN, benchIv);
+  report("session", benchSeconds(t0));
+  CHECK_MEM(dec, benchRef, SECLEN);
+  cryptoSessionEnd();
+}
+
+// レコード単位　version 1(CBC、検証なし)とversion 2(GCM、AADも含めて検証)
+void benchRecordFormats() {
+  const int records = 20000;
+  std::vector<TotpParams> cbcs(records), gcms(records);
+  TotpParams tp;
+  CHECK(cryptoSessionBegin(benchKey));
+  memcpy(status.iv, benchIv, sizeof(status.iv));
+  int prepared = 0;
+  for (int i=0; i<records; i++) {
+    cbcs[i] = benchRecords[i];
+    cbcs[i].version = OTP_RECORD_CBC;
+    if (openOtpRecord(&cbcs[i], &tp) && encryptOtpRecord(&tp, &gcms[i])) prepared ++;
+  }
+  CHECK(prepared == records);
+
+  printf("[Record] %d records (open = verify + decrypt)\n", records);
+  int ok = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i=0; i<records; i++) if (openOtpRecord(&cbcs[i], &tp)) ok ++;
+  double secCbc = benchSeconds(t0);
+  CHECK(ok == records);
+  char cbcLast[SECLEN];
+  memcpy(cbcLast, tp.secret, SECLEN);
+  ok = 0;
+  t0 = std::chrono::steady_clock::now();
+  for (int i=0; i<records; i++) if (openOtpRecord(&gcms[i], &tp)) ok ++;
+  double secGcm = benchSeconds(t0);
+  CHECK(ok == records);
+  CHECK_MEM(tp.secret, cbcLast, SECLEN);
+  memset(cbcLast, 0, SECLEN);
+  printf("  CBC v1  : %8.3f s, %10.0f records/s\n", secCbc, records / secCbc);
+  printf("  GCM v2  : %8.3f s, %10.0f records/s  (x%.2f of CBC)\n", secGcm, records / secGcm, secCbc / secGcm);
+
+  // 改ざんしたレコードは検証に失敗する
+  gcms[0].period ^= 1;
+  CHECK(!openOtpRecord(&gcms[0], &tp));
+  gcms[0].period ^= 1;
+
+  // 保存ファイルの全件　1件ずつ読む場合と一括(VAULT_READ_BATCH件ずつ)の比較
+  const int vaultRecords = 1000;
+  FFat.format();
+  vaultInvalidate();
+  vaultReady = false;
+  CHECK(vaultBegin());
+  CHECK(vaultLoadIndex());
+  CHECK(vaultAppend(FN_OTPVAULT, gcms.data(), vaultRecords, &vaultSlots));
+  ok = 0;
+  t0 = std::chrono::steady_clock::now();
+  for (int i=0; i<vaultRecords; i++) if (loadOtpRecord(i, &tp, true)) ok ++;
+  double secEach = benchSeconds(t0);
+  CHECK(ok == vaultRecords);
+  ok = 0;
+  t0 = std::chrono::steady_clock::now();
+  int failed = vaultOpenRecords(FN_OTPVAULT, vaultSlots, [&](uint16_t slot, const TotpParams* raw, TotpParams* cur) {
+    if (cur != nullptr) ok ++;
+    return true;
+  });
+  double secBatch = benchSeconds(t0);
+  CHECK(failed == 0 && ok == vaultRecords);
+  printf("[Vault] %d GCM records from file\n", vaultRecords);
+  printf("  each    : %8.3f s, %10.0f records/s\n", secEach, vaultRecords / secEach);
+  printf("  batch   : %8.3f s, %10.0f records/s\n", secBatch, vaultRecords / secBatch);
+  memset(tp.secret, 0, sizeof(tp.secret));
+  cryptoSessionEnd();
+}
+
+int main() {
+  if (!hostFatfsBegin("bench_crypto")) {
+    printf("FatFS shim init failed\n");
+    return 1;
+  }
+  status.unlock = true;
+  setupRecords();
+  RUN_TEST(benchCbc);
+  RUN_TEST(benchRecordFormats);
+  return testResult();
+}
@@ -0,0 +1,71 @@
+/*
+  bench_nfcsim.cpp
+  NFCの読み書きの往復回数(PC)　NfcCardSimulatorのカードで秘密鍵の保存領域を読み書きする
+  NTAGはREADとFAST_READ、Classicは認証を含めて比較する。新しいスロットを壊したら前のスロットが読めるか確認する
+
+  シミュレータはファームウェアに含めず、PCでだけ動かす。読み書きの結果が一致しなければ失敗として終了する
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#include "hosttest.h"
+#include "common.h"
+#include "NfcCardSimulator.h"
+
+void benchmarkNfcSim() {
+  const SimCardType cards[] = { SIM_CLASSIC1K, SIM_NTAG213, SIM_NTAG215 };
+  const char* names[] = { "Classic1K", "NTAG213", "NTAG215" };
+  NfcCardSimulator sim;
+  NfcEasyWriter snfc(sim);
+  byte data[SECRET_NFC_AREA_SIZE], slot1[SECRET_SAVE_SIZE], slot2[SECRET_SAVE_SIZE], back[SECRET_SAVE_SIZE];
+  for (size_t i=0; i<sizeof(data); i++) data[i] = i;
+  memset(slot1, 0x11, sizeof(slot1));
+  memset(slot2, 0x22, sizeof(slot2));
+
+  sp("[NFC] simulated card, round trips (naks)");
+  for (int c=0; c<3; c++) {
+    int before = testFailures;
+    sim.insertCard(cards[c]);
+    CHECK(snfc.mountCard(100, PRT_NOPASS_RW));
+    // 書き込み
+    sim.resetStats();
+    CHECK(snfc.writeData(SECRET_NFC_PARTITION_ADDR, data, sizeof(data)));
+    NfcSimStats write = sim._stats;
+    // 読み込み（NTAGはFAST_READ、その後READで読み直す）
+    byte rdata[SECRET_NFC_AREA_SIZE];
+    sim.resetStats();
+    CHECK(snfc.readData(SECRET_NFC_PARTITION_ADDR, rdata, sizeof(rdata)));
+    CHECK_MEM(data, rdata, sizeof(data));
+    NfcSimStats fast = sim._stats;
+    NfcSimStats read = fast;
+    if (snfc.isUltralight()) {
+      snfc._fastReadUL = false;
+      sim.resetStats();
+      CHECK(snfc.readData(SECRET_NFC_PARTITION_ADDR, rdata, sizeof(rdata)));
+      CHECK_MEM(data, rdata, sizeof(data));
+      read = sim._stats;
+      snfc._fastReadUL = true;
+    }
+    // A/Bスロット　2回書いて、新しい方のヘッダを壊すと前の内容が読めること
+    sim.resetStats();
+    CHECK(snfc.writeSlot(SECRET_NFC_PARTITION_ADDR, SECRET_NFC_SLOT_SIZE, slot1, sizeof(slot1)));
+    NfcSimStats slot = sim._stats;
+    CHECK(snfc.writeSlot(SECRET_NFC_PARTITION_ADDR, SECRET_NFC_SLOT_SIZE, slot2, sizeof(slot2)));
+    PhyAddr pa = snfc.addr2PhysicalAddr(SECRET_NFC_PARTITION_ADDR, snfc._cardType);  // 2回目はスロットA
+    sim.memory()[pa.blockAddr * (snfc.isClassic() ? 16 : 4)] ^= 0xFF;
+    CHECK(snfc.readSlot(SECRET_NFC_PARTITION_ADDR, SECRET_NFC_SLOT_SIZE, back, sizeof(back)) == sizeof(back));
+    CHECK_MEM(back, slot1, sizeof(back));
+    snfc.unmountCard();
+
+    spf("  %-9s %s write %d bytes: %3u (%u), read: %3u (%u)", names[c], (testFailures == before ? "PASS" : "FAIL"), (int)sizeof(data),
+      write.roundTrips, write.naks, read.roundTrips, read.naks);
+    if (cards[c] != SIM_CLASSIC1K) spf(", fast read: %3u (%u)", fast.roundTrips, fast.naks);
+    spf(", slot write+verify: %3u\n", slot.roundTrips);
+  }
+}
+
+int main() {
+  RUN_TEST(benchmarkNfcSim);
+  return testResult();
+}
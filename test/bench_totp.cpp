@@ -0,0 +1,97 @@
+/*
+  bench_totp.cpp
+  TOTP生成の速度(PC)　従来方式(毎回デコード＋HMAC)と鍵スケジュールキャッシュの比較、アルゴリズムごとのスループット
+
+  実機のbenchmarkTotp()と同じ処理をPCで計測する。結果が一致しなければ失敗として終了する
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#include "hosttest.h"
+#include "hostenv.h"
+#include "totputil.h"
+
+// ベンチマーク用のテストデータ（RFC 6238の秘密鍵 "12345678901234567890"）
+const char BENCH_SECRET_B32[] = "GEZDGNBVGY3TQOJQGEZDGNBVGY3TQOJQ";
+const time_t BENCH_EPOCH = 1700000000;
+const int BENCH_LOOPS = 20000;   // funcOtpShow()の1秒分（前/現在/次）× loops
+
+// 従来方式　コードごとにBase32デコードしてHMACを最初から計算する
+static void legacyCode(time_t epoch, char* code, size_t codeSize) {
+  const mbedtls_md_info_t* sha1 = mbedtls_md_info_from_type(MBEDTLS_MD_SHA1);
+  uint8_t key[TotpGenerator::SECRET_MAXLEN];
+  int decLen = base32decode(BENCH_SECRET_B32, key, strlen(BENCH_SECRET_B32));
+  uint64_t counter = epoch / 30;
+  uint8_t msg[8];
+  for (int j=7; j>=0; j--) {
+    msg[j] = counter & 0xFF;
+    counter >>= 8;
+  }
+  uint8_t hash[20];
+  mbedtls_md_hmac(sha1, key, decLen, msg, sizeof(msg), hash);
+  uint8_t offset = hash[19] & 0x0F;
+  uint32_t bin = ((uint32_t)(hash[offset] & 0x7F) << 24) | ((uint32_t)hash[offset+1] << 16)
+               | ((uint32_t)hash[offset+2] << 8) | (uint32_t)hash[offset+3];
+  snprintf(code, codeSize, "%06u", bin % 1000000);
+}
+
+// 従来方式と新方式のコード/秒
+void benchLegacyVsCached() {
+  char codes[3][TOTP_CODE_BUFSIZE];
+  char legacy[3][TOTP_CODE_BUFSIZE];
+  const int total = BENCH_LOOPS * 3;
+
+  auto t0 = std::chrono::steady_clock::now();
+  for (int n=0; n<BENCH_LOOPS; n++) {
+    for (int i=0; i<3; i++) legacyCode(BENCH_EPOCH + n*30 + (i-1)*30, legacy[i], sizeof(legacy[i]));
+  }
+  double secLegacy = benchSeconds(t0);
+
+  t0 = std::chrono::steady_clock::now();
+  TotpGenerator totp;
+  CHECK(totp.begin(BENCH_SECRET_B32, 30, 6));
+  for (int n=0; n<BENCH_LOOPS; n++) {
+    totp.getCodes(BENCH_EPOCH + n*30, -1, 3, codes);
+  }
+  double secCached = benchSeconds(t0);
+
+  // 結果の一致確認（最後の1回分）
+  for (int i=0; i<3; i++) CHECK_STR(codes[i], legacy[i]);
+
+  printf("[TOTP] codes/sec\n");
+  printf("  legacy (decode+HMAC per code) : %10.0f  (%.3f s / %d codes)\n", total / secLegacy, secLegacy, total);
+  printf("  cached (HMAC midstate, batch) : %10.0f  (%.3f s / %d codes)\n", total / secCached, secCached, total);
+  printf("  speedup x%.1f\n", secLegacy / secCached);
+}
+
+// アルゴリズムごとのスループット（RFC 6238の秘密鍵の長さで、結果も確認する）
+void benchAlgorithms() {
+  static const char seed[] = "1234567890123456789012345678901234567890123456789012345678901234";
+  const struct { uint8_t algo; size_t keyLen; const char* code; } algos[] = {
+    { TOTP_ALGO_SHA1,   20, "89005924" },
+    { TOTP_ALGO_SHA256, 32, "91819424" },
+    { TOTP_ALGO_SHA512, 64, "93441116" },
+  };
+  char codes[3][TOTP_CODE_BUFSIZE];
+  const int total = BENCH_LOOPS * 3;
+  printf("[TOTP] codes/sec by algorithm (SHA backend: %s)\n", TOTP_SHA_BACKEND);
+  for (auto& a : algos) {
+    TotpGenerator totp;
+    CHECK(totp.begin((const uint8_t*)seed, a.keyLen, 30, 8, a.algo));
+    auto t0 = std::chrono::steady_clock::now();
+    for (int n=0; n<BENCH_LOOPS; n++) {
+      totp.getCodes(BENCH_EPOCH + n*30, -1, 3, codes);
+    }
+    double sec = benchSeconds(t0);
+    totp.getCodes(1234567890, 0, 1, codes);
+    CHECK_STR(codes[0], a.code);
+    printf("  %-6s : %10.0f  (%.3f s / %d codes)\n", TotpGenerator::algorithmName(a.algo), total / sec, sec, total);
+  }
+}
+
+int main() {
+  RUN_TEST(benchLegacyVsCached);
+  RUN_TEST(benchAlgorithms);
+  return testResult();
+}
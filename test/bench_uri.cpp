@@ -0,0 +1,83 @@
+/*
+  bench_uri.cpp
+  URIパースの速度とヒープ確保の回数(PC)　otpauth://totp/ とエクスポート(otpauth-migration://)
+
+  operator newを置き換えて、パース1回あたりの確保回数を数える（実機のbenchmarkUriParse()はヒープのブロック数の差で見ている）
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#include "hosttest.h"
+#include "hostenv.h"
+#include "totputil.h"
+#include "migration_data.h"
+#include <new>
+
+// ヒープ確保の回数
+static long allocCount = 0;
+void* operator new(size_t size) {
+  allocCount++;
+  void* p = malloc(size ? size : 1);
+  if (p == nullptr) throw std::bad_alloc();
+  return p;
+}
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+const char BENCH_URI[] = "otpauth://totp/ACME%20Co:%20john.doe%40email.com?secret=HXDMVJECJJWSRB3HWIZR4IFUGFTMXBOZ"
+                         "&issuer=ACME+Co&algorithm=SHA256&digits=8&period=60";
+const int BENCH_LOOPS = 100000;
+
+// otpauth://totp/
+void benchUriOtp() {
+  const size_t uriLen = strlen(BENCH_URI);
+  char buff[256];
+  TotpParams tp;
+  int ok = 0;
+  long allocs = allocCount;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int n=0; n<BENCH_LOOPS; n++) {
+    memcpy(buff, BENCH_URI, uriLen);
+    if (parseUriOTP(&tp, buff, uriLen)) ok ++;
+  }
+  double sec = benchSeconds(t0);
+  allocs = allocCount - allocs;
+  CHECK(ok == BENCH_LOOPS);
+  CHECK(allocs == 0);
+  CHECK_STR(tp.account, "john.doe@email.com");
+  printf("[URI parse] %d/%d parsed, %.3f us/parse, %.2f allocations/parse\n", ok, BENCH_LOOPS, sec * 1e6 / BENCH_LOOPS, (double)allocs / BENCH_LOOPS);
+}
+
+// otpauth-migration://　結果の配列は確保済みのものを使い回す
+void benchMigrationUri() {
+  const size_t uriLen = strlen(MIGRATION_RECORDED_URI);
+  char buff[512];
+  std::vector<TotpParams> tps;
+  tps.reserve(4);
+  MigrationBatch batch;
+  int ok = 0;
+  long allocs = allocCount;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int n=0; n<BENCH_LOOPS; n++) {
+    tps.clear();
+    memcpy(buff, MIGRATION_RECORDED_URI, uriLen);
+    if (parseMigrationUri(buff, uriLen, &tps, &batch)) ok ++;
+  }
+  double sec = benchSeconds(t0);
+  allocs = allocCount - allocs;
+  CHECK(ok == BENCH_LOOPS);
+  CHECK(tps.size() == 2);
+  CHECK(allocs == 0);
+  printf("[Migration decode] %d/%d decoded, %.3f us/decode (%d bytes), %.2f allocations/decode\n",
+    ok, BENCH_LOOPS, sec * 1e6 / BENCH_LOOPS, (int)uriLen, (double)allocs / BENCH_LOOPS);
+}
+
+int main() {
+  RUN_TEST(benchUriOtp);
+  RUN_TEST(benchMigrationUri);
+  return testResult();
+}
@@ -0,0 +1,138 @@
+/*
+  fuzz_migration.cpp
+  エクスポートのデコード(base64 → protobuf)とotpauth URIのパーサーのファズテスト
+
+  clangなら -DHOST_LIBFUZZER=ON でlibFuzzerのターゲットとしてビルドする
+  それ以外は、シードに変異を加えて繰り返す簡易ドライバーになる（ctestではこちらを実行する）
+    fuzz_migration [回数] [乱数のシード]
+  どちらもAddressSanitizer/UBSanが使えれば有効にしてビルドする
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#include "hosttest.h"
+#include "hostenv.h"
+#include "totputil.h"
+#include "migration_data.h"
+#include <random>
+
+// 結果の文字列が配列の中で終端しているか
+static bool bounded(const TotpParams& tp) {
+  return strnlen(tp.issuer, sizeof(tp.issuer)) < sizeof(tp.issuer)
+      && strnlen(tp.account, sizeof(tp.account)) < sizeof(tp.account)
+      && strnlen(tp.secret, sizeof(tp.secret)) < sizeof(tp.secret);
+}
+
+// 壊れた入力でも範囲外アクセスせず、結果が矛盾しないこと（違反したらabortする）
+static void fuzzOne(const uint8_t* data, size_t size) {
+  if (size == 0) return;
+  uint8_t mode = data[0] % 4;
+  data++;
+  size--;
+
+  // ちょうどの大きさのバッファにコピーして、はみ出した読み書きをASanで検出する
+  std::vector<char> buff;
+  if (mode == 0) {
+    std::vector<uint8_t> payload(data, data + size);
+    std::string uri = migrationUri(payload, size % 2);
+    buff.assign(uri.begin(), uri.end());
+  } else {
+    buff.assign((const char*)data, (const char*)data + size);
+  }
+  if (buff.empty()) return;
+  char* p = new char[buff.size()];
+  memcpy(p, buff.data(), buff.size());
+
+  switch (mode) {
+    case 0:   // protobufのペイロード（base64とURIは正しい）
+    case 1: { // URI全体
+      std::vector<TotpParams> tps(1);
+      MigrationBatch batch;
+      batch.batchId = -1;
+      if (parseMigrationUri(p, buff.size(), &tps, &batch)) {
+        if (batch.batchSize == 0 || batch.batchIndex >= batch.batchSize) abort();
+        for (const TotpParams& tp : tps) if (!bounded(tp)) abort();
+      } else {
+        if (tps.size() != 1 || batch.batchId != -1) abort();   // 失敗したら何も変えない
+      }
+      break;
+    }
+    case 2: { // 1アカウント分のprotobuf
+      TotpParams tp;
+      if (parseMigrationOtp((const uint8_t*)p, buff.size(), &tp)) {
+        if (!bounded(tp) || tp.secret[0] == '\0' || tp.algorithm < 1 || tp.algorithm > 3) abort();
+      }
+      break;
+    }
+    case 3: { // otpauth://totp/ のURI
+      TotpParams tp;
+      if (parseUriOTP(&tp, p, buff.size())) {
+        if (!bounded(tp) || tp.secret[0] == '\0' || tp.period == 0) abort();
+        if (tp.digit < TotpGenerator::DIGITS_MIN || tp.digit > TotpGenerator::DIGITS_MAX) abort();
+      }
+      break;
+    }
+  }
+  delete[] p;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  fuzzOne(data, size);
+  return 0;
+}
+
+#ifndef HOST_LIBFUZZER
+// シード（正常な入力）　先頭1バイトはモード
+static std::vector<std::vector<uint8_t>> seeds() {
+  std::vector<std::vector<uint8_t>> s;
+  auto add = [&](uint8_t mode, const void* d, size_t n) {
+    std::vector<uint8_t> v(1, mode);
+    v.insert(v.end(), (const uint8_t*)d, (const uint8_t*)d + n);
+    s.push_back(v);
+  };
+  // 記録済みのペイロード（base64をデコードしたもの）
+  const char* b64 = strstr(MIGRATION_RECORDED_URI, "data=") + 5;
+  std::vector<uint8_t> payload(strlen(b64));
+  size_t plen = 0;
+  mbedtls_base64_decode(payload.data(), payload.size(), &plen, (const uint8_t*)b64, strlen(b64));
+  payload.resize(plen);
+  add(0, payload.data(), payload.size());
+  add(1, MIGRATION_RECORDED_URI, strlen(MIGRATION_RECORDED_URI));
+  std::vector<uint8_t> otp = pbOtp("12345678901234567890", "Example:alice@google.com", "Example", 2, 2, 2);
+  add(2, otp.data(), otp.size());
+  const char uri[] = "otpauth://totp/ACME%20Co:john.doe%40email.com?secret=HXDMVJECJJWSRB3HWIZR4IFUGFTMXBOZ"
+                     "&issuer=ACME+Co&algorithm=SHA256&digits=8&period=60&counter=1";
+  add(3, uri, strlen(uri));
+  return s;
+}
+
+// 簡易ドライバー　シードに置換/削除/挿入/区切り文字/切り詰めの変異を加えて繰り返す
+int main(int argc, char** argv) {
+  long iterations = (argc > 1) ? atol(argv[1]) : 200000;
+  uint32_t seed = (argc > 2) ? strtoul(argv[2], nullptr, 10) : 1;
+  std::mt19937 rng(seed);
+  const char symbols[] = "%=&?:+/\x80\xff";
+  std::vector<std::vector<uint8_t>> corpus = seeds();
+  for (auto& s : corpus) fuzzOne(s.data(), s.size());
+
+  auto t0 = std::chrono::steady_clock::now();
+  for (long n=0; n<iterations; n++) {
+    std::vector<uint8_t> in = corpus[rng() % corpus.size()];
+    int m = 1 + rng() % 8;
+    for (int k=0; k<m && in.size() > 1; k++) {
+      size_t pos = 1 + rng() % (in.size() - 1);   // 先頭のモードは変えない
+      switch (rng() % 5) {
+        case 0: in[pos] = rng() & 0xFF; break;
+        case 1: in[pos] ^= 1 << (rng() % 8); break;
+        case 2: in.erase(in.begin() + pos); break;
+        case 3: in.insert(in.begin() + pos, symbols[rng() % (sizeof(symbols) - 1)]); break;
+        case 4: in.resize(pos + rng() % (in.size() - pos)); break;
+      }
+    }
+    fuzzOne(in.data(), in.size());
+  }
+  printf("%ld inputs, seed %u, %.2f s: no crash\n", iterations, seed, benchSeconds(t0));
+  return 0;
+}
+#endif
@@ -0,0 +1,26 @@
+/*
+  hostenv.h
+  PCでテストするときに、M5Authenticator.inoが定義しているグローバル変数を代わりに定義する
+
+  ヘッダだけのモジュール(totputil.h等)は関数の実体を含むので、1つのテストプログラムにつき1回だけincludeする
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#pragma once
+#include <Arduino.h>
+#include <FFat.h>
+#include "common.h"
+
+bool debug = false;
+StatusInfo status;  // ステータス情報
+ConfigInfo conf;    // 設定情報
+
+// テスト用のFatFSを空の状態で用意する
+inline bool hostFatfsBegin(const char* name) {
+  const char* base = getenv("FFAT_SHIM_ROOT");
+  std::string dir = std::string(base ? base : "/tmp") + "/m5auth_" + name;
+  FFat.setRoot(dir.c_str());
+  return FFat.begin(true) && FFat.format();
+}
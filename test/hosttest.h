@@ -0,0 +1,52 @@
+/*
+  hosttest.h
+  PCで動かすテストの簡易フレームワーク
+
+  CHECK()が失敗すると場所と式を表示して数える。main()の最後に testResult() を返す
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#pragma once
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+#include <string>
+
+static int testChecks = 0;
+static int testFailures = 0;
+
+#define CHECK(expr) do { \
+    testChecks++; \
+    if (!(expr)) { testFailures++; printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #expr); } \
+  } while (0)
+
+#define CHECK_STR(actual, expected) do { \
+    testChecks++; \
+    std::string a_ = (actual), e_ = (expected); \
+    if (a_ != e_) { testFailures++; printf("  FAIL %s:%d: %s = \"%s\" (expected \"%s\")\n", __FILE__, __LINE__, #actual, a_.c_str(), e_.c_str()); } \
+  } while (0)
+
+#define CHECK_MEM(actual, expected, size) do { \
+    testChecks++; \
+    if (memcmp((actual), (expected), (size)) != 0) { testFailures++; printf("  FAIL %s:%d: %s != %s\n", __FILE__, __LINE__, #actual, #expected); } \
+  } while (0)
+
+// テストケースを実行する
+#define RUN_TEST(fn) do { \
+    int before_ = testFailures; \
+    fn(); \
+    printf("%s %s\n", testFailures == before_ ? "PASS" : "FAIL", #fn); \
+  } while (0)
+
+// 結果を表示してmain()の戻り値を返す
+inline int testResult() {
+  printf("%d checks, %d failures\n", testChecks, testFailures);
+  return testFailures == 0 ? 0 : 1;
+}
+
+// ベンチマーク用の経過時間(秒)
+inline double benchSeconds(std::chrono::steady_clock::time_point t0) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
@@ -0,0 +1,80 @@
+/*
+  migration_data.h
+  エクスポート(otpauth-migration://)のテストデータと、protobufを組み立てる補助関数
+  テスト、ファズ、ベンチマークで共用する
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#pragma once
+#include <string>
+#include <vector>
+#include "mbedtls/base64.h"
+
+// 記録済みのエクスポートデータ（実機のbenchmarkMigration()と同じもの。3件中1件はHOTPなので除外される）
+const char MIGRATION_RECORDED_URI[] = "otpauth-migration://offline?data=Cj8KFDEyMzQ1Njc4OTAxMjM0NTY3ODkwEhhFeGFtcGxlOmFsaWNlQGdvb2dsZS5jb20aB0V4YW1wbGUgASgBMAIKNgog"
+  "AAECAwQFBgcICQoLDA0ODxAREhMUFRYXGBkaGxwdHh8SA2JvYhoHQUNNRSBDbyACKAIwAgolCgpob3Rwc2VjcmV0Eglob3RwLXVzZXIaBEhPVFAgASgBMAE4BRABGAEgACiVmu86";
+struct MigrationExpect {
+  const char* issuer;
+  const char* account;
+  const char* secret;
+  uint8_t algorithm, digit, period;
+};
+const MigrationExpect MIGRATION_RECORDED_EXPECT[2] = {
+  { "Example", "alice@google.com", "GEZDGNBVGY3TQOJQGEZDGNBVGY3TQOJQ", 1, 6, 30 },
+  { "ACME Co", "bob", "AAAQEAYEAUDAOCAJBIFQYDIOB4IBCEQTCQKRMFYYDENBWHA5DYPQ", 2, 8, 30 },
+};
+
+// varintを追加する
+inline void pbVarint(std::vector<uint8_t>* buf, uint64_t v) {
+  while (v >= 0x80) {
+    buf->push_back((v & 0x7F) | 0x80);
+    v >>= 7;
+  }
+  buf->push_back((uint8_t)v);
+}
+inline void pbVarintField(std::vector<uint8_t>* buf, uint32_t field, uint64_t v) {
+  pbVarint(buf, (field << 3) | 0);
+  pbVarint(buf, v);
+}
+inline void pbBytesField(std::vector<uint8_t>* buf, uint32_t field, const void* data, size_t len) {
+  pbVarint(buf, (field << 3) | 2);
+  pbVarint(buf, len);
+  buf->insert(buf->end(), (const uint8_t*)data, (const uint8_t*)data + len);
+}
+inline void pbBytesField(std::vector<uint8_t>* buf, uint32_t field, const std::string& s) {
+  pbBytesField(buf, field, s.data(), s.size());
+}
+inline void pbBytesField(std::vector<uint8_t>* buf, uint32_t field, const std::vector<uint8_t>& v) {
+  pbBytesField(buf, field, v.data(), v.size());
+}
+
+// 1アカウント分(OtpParameters)　空の文字列と0のフィールドは出力しない
+inline std::vector<uint8_t> pbOtp(const std::string& secret, const std::string& name, const std::string& issuer,
+                                  uint64_t algorithm, uint64_t digits, uint64_t type) {
+  std::vector<uint8_t> buf;
+  if (!secret.empty()) pbBytesField(&buf, 1, secret);
+  if (!name.empty()) pbBytesField(&buf, 2, name);
+  if (!issuer.empty()) pbBytesField(&buf, 3, issuer);
+  if (algorithm) pbVarintField(&buf, 4, algorithm);
+  if (digits) pbVarintField(&buf, 5, digits);
+  if (type) pbVarintField(&buf, 6, type);
+  return buf;
+}
+
+// MigrationPayloadをURIにする（percentEncode=trueなら+/=をエンコードする）
+inline std::string migrationUri(const std::vector<uint8_t>& payload, bool percentEncode) {
+  std::vector<uint8_t> b64(payload.size() * 4 / 3 + 8);
+  size_t olen = 0;
+  mbedtls_base64_encode(b64.data(), b64.size(), &olen, payload.data(), payload.size());
+  std::string uri = "otpauth-migration://offline?data=";
+  for (size_t i=0; i<olen; i++) {
+    char c = (char)b64[i];
+    if (percentEncode && c == '+') uri += "%2B";
+    else if (percentEncode && c == '/') uri += "%2F";
+    else if (percentEncode && c == '=') uri += "%3D";
+    else uri += c;
+  }
+  return uri;
+}
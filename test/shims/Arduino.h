@@ -0,0 +1,185 @@
+/*
+  Arduino.h (PC用のシム)
+  ファームウェアのうちハードウェアに依存しない部分をPCでビルドするための最小限の代用品
+
+  String, Serial, millis()等、テスト対象が使う範囲だけを実装している
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdarg>
+#include <cmath>
+#include <ctime>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define DRAM_ATTR
+#define IRAM_ATTR
+#define HEX 16
+#define DEC 10
+#define BIN 2
+
+using std::min;
+using std::max;
+
+// Arduino互換の文字列クラス（std::stringで実装）
+class String {
+public:
+  String() {}
+  String(const char* c) : _s(c ? c : "") {}
+  String(const std::string& s) : _s(s) {}
+  String(char c) : _s(1, c) {}
+  String(int v, uint8_t base=DEC) : _s(fromInt((long long)v, base)) {}
+  String(unsigned int v, uint8_t base=DEC) : _s(fromInt((long long)v, base)) {}
+  String(long v, uint8_t base=DEC) : _s(fromInt((long long)v, base)) {}
+  String(unsigned long v, uint8_t base=DEC) : _s(fromInt((long long)v, base)) {}
+  String(long long v, uint8_t base=DEC) : _s(fromInt(v, base)) {}
+  String(unsigned long long v, uint8_t base=DEC) : _s(fromInt((long long)v, base)) {}
+  String(unsigned char v, uint8_t base=DEC) : _s(fromInt((long long)v, base)) {}
+  String(double v, unsigned int decimals=2) { char b[64]; snprintf(b, sizeof(b), "%.*f", decimals, v); _s = b; }
+
+  const char* c_str() const { return _s.c_str(); }
+  unsigned int length() const { return _s.size(); }
+  bool isEmpty() const { return _s.empty(); }
+  void reserve(unsigned int n) { _s.reserve(n); }
+  char charAt(unsigned int i) const { return i < _s.size() ? _s[i] : 0; }
+  char operator[](unsigned int i) const { return charAt(i); }
+  char& operator[](unsigned int i) { return _s[i]; }
+  void setCharAt(unsigned int i, char c) { if (i < _s.size()) _s[i] = c; }
+
+  bool equals(const String& o) const { return _s == o._s; }
+  bool equalsIgnoreCase(const String& o) const { return strcasecmp(c_str(), o.c_str()) == 0; }
+  bool operator==(const String& o) const { return _s == o._s; }
+  bool operator==(const char* o) const { return _s == (o ? o : ""); }
+  bool operator!=(const String& o) const { return _s != o._s; }
+  bool operator!=(const char* o) const { return !(*this == o); }
+  bool operator<(const String& o) const { return _s < o._s; }
+  bool startsWith(const String& p) const { return _s.compare(0, p._s.size(), p._s) == 0; }
+  bool endsWith(const String& p) const { return _s.size() >= p._s.size() && _s.compare(_s.size() - p._s.size(), p._s.size(), p._s) == 0; }
+  int indexOf(char c, unsigned int from=0) const { return pos(_s.find(c, from)); }
+  int indexOf(const String& s, unsigned int from=0) const { return pos(_s.find(s._s, from)); }
+  int lastIndexOf(char c) const { return pos(_s.rfind(c)); }
+  int lastIndexOf(const String& s) const { return pos(_s.rfind(s._s)); }
+  String substring(unsigned int from) const { return from < _s.size() ? String(_s.substr(from)) : String(); }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) std::swap(from, to);
+    if (from >= _s.size()) return String();
+    return String(_s.substr(from, std::min<size_t>(to, _s.size()) - from));
+  }
+  long toInt() const { return strtol(c_str(), nullptr, 10); }
+  float toFloat() const { return strtof(c_str(), nullptr); }
+  void toUpperCase() { for (auto& c : _s) c = toupper((unsigned char)c); }
+  void toLowerCase() { for (auto& c : _s) c = tolower((unsigned char)c); }
+  void trim() {
+    size_t b = _s.find_first_not_of(" \t\r\n");
+    size_t e = _s.find_last_not_of(" \t\r\n");
+    _s = (b == std::string::npos) ? "" : _s.substr(b, e - b + 1);
+  }
+  void replace(const String& from, const String& to) {
+    if (from._s.empty()) return;
+    for (size_t p = 0; (p = _s.find(from._s, p)) != std::string::npos; p += to._s.size()) _s.replace(p, from._s.size(), to._s);
+  }
+  void remove(unsigned int index) { if (index < _s.size()) _s.erase(index); }
+  void remove(unsigned int index, unsigned int count) { if (index < _s.size()) _s.erase(index, count); }
+  void getBytes(unsigned char* buf, unsigned int size) const { toCharArray((char*)buf, size); }
+  void toCharArray(char* buf, unsigned int size) const {
+    if (size == 0) return;
+    size_t n = std::min<size_t>(size - 1, _s.size());
+    memcpy(buf, _s.data(), n);
+    buf[n] = 0;
+  }
+
+  String& operator+=(const String& o) { _s += o._s; return *this; }
+  String& operator+=(const char* o) { _s += (o ? o : ""); return *this; }
+  String& operator+=(char c) { _s += c; return *this; }
+  String& operator+=(int v) { _s += fromInt(v, DEC); return *this; }
+  String& operator+=(unsigned int v) { _s += fromInt(v, DEC); return *this; }
+  String& operator+=(long v) { _s += fromInt(v, DEC); return *this; }
+  String& operator+=(unsigned long v) { _s += fromInt(v, DEC); return *this; }
+  bool concat(const String& o) { _s += o._s; return true; }
+  bool concat(char c) { _s += c; return true; }
+  friend String operator+(const String& a, const String& b) { return String(a._s + b._s); }
+  friend String operator+(const String& a, const char* b) { return String(a._s + (b ? b : "")); }
+  friend String operator+(const char* a, const String& b) { return String(std::string(a ? a : "") + b._s); }
+  friend String operator+(const String& a, char c) { return String(a._s + c); }
+  friend String operator+(const String& a, int v) { return a + String(v); }
+  friend String operator+(const String& a, unsigned int v) { return a + String(v); }
+  friend String operator+(const String& a, long v) { return a + String(v); }
+  friend String operator+(const String& a, unsigned long v) { return a + String(v); }
+
+private:
+  std::string _s;
+  static int pos(size_t p) { return p == std::string::npos ? -1 : (int)p; }
+  static std::string fromInt(long long v, uint8_t base) {
+    if (base == DEC) return std::to_string(v);
+    std::string r;
+    unsigned long long u = (unsigned long long)v;
+    do { r.insert(r.begin(), "0123456789abcdef"[u % base]); u /= base; } while (u);
+    return r;
+  }
+};
+
+// シリアルポート（標準出力に出す）
+class HardwareSerial {
+public:
+  void begin(unsigned long) {}
+  size_t print(const String& s) { return fputs(s.c_str(), stdout) >= 0 ? s.length() : 0; }
+  size_t print(const char* s) { return print(String(s)); }
+  size_t print(char c) { return print(String(c)); }
+  size_t print(int v, int base=DEC) { return print(String(v, base)); }
+  size_t print(unsigned int v, int base=DEC) { return print(String(v, base)); }
+  size_t print(long v, int base=DEC) { return print(String(v, base)); }
+  size_t print(unsigned long v, int base=DEC) { return print(String(v, base)); }
+  size_t print(double v, int digits=2) { return print(String(v, digits)); }
+  template<class T> size_t println(T v) { size_t n = print(v); return n + print("\n"); }
+  template<class T> size_t println(T v, int base) { size_t n = print(v, base); return n + print("\n"); }
+  size_t println() { return print("\n"); }
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vprintf(fmt, ap);
+    va_end(ap);
+    return n < 0 ? 0 : n;
+  }
+  void flush() { fflush(stdout); }
+};
+extern HardwareSerial Serial;
+
+// I2Cバス（NfcEasyWriterのコンパイル用。何もしない）
+class TwoWire {
+public:
+  bool begin(int=-1, int=-1, uint32_t=0) { return true; }
+  void setClock(uint32_t) {}
+  void beginTransmission(uint8_t) {}
+  size_t write(uint8_t) { return 1; }
+  size_t write(const uint8_t*, size_t n) { return n; }
+  uint8_t endTransmission(bool=true) { return 0; }
+  uint8_t requestFrom(uint8_t, uint8_t n) { return n; }
+  int available() { return 0; }
+  int read() { return 0; }
+};
+extern TwoWire Wire;
+
+// 時間
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+
+// 乱数（ESP32のハードウェア乱数の代わり）
+uint32_t esp_random();
+void esp_fill_random(void* buf, size_t len);
+long random(long howbig);
+long random(long howsmall, long howbig);
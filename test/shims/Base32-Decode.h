@@ -0,0 +1,12 @@
+/*
+  Base32-Decode.h (PC用のシム)
+  Base32-Decodeライブラリと同じ関数を提供する（RFC 4648、パディングと空白は読み飛ばす）
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#pragma once
+
+// Base32をデコードする（戻り値はデコードしたバイト数、不正な文字があれば-1）
+int base32decode(const char* encoded, unsigned char* decoded, int maxLength);
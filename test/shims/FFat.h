@@ -0,0 +1,75 @@
+/*
+  FFat.h (PC用のシム)
+  FatFSの代わりに、PCの一時ディレクトリの中にファイルを読み書きする
+
+  ファイル名は "/otp_vault.bin" のようにESP32と同じ書き方で指定する
+  ルートディレクトリは FFat.setRoot() で変更できる（既定は FFAT_SHIM_ROOT 環境変数か /tmp/m5auth_ffat）
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#pragma once
+#include <Arduino.h>
+#include <memory>
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+#define FILE_APPEND "a"
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+class File {
+public:
+  File() {}
+  size_t write(uint8_t c) { return write(&c, 1); }
+  size_t write(const uint8_t* buf, size_t size);
+  size_t print(const String& s) { return write((const uint8_t*)s.c_str(), s.length()); }
+  size_t println(const String& s) { return print(s) + print("\n"); }
+  size_t println() { return print("\n"); }
+  int read();
+  size_t read(uint8_t* buf, size_t size);
+  size_t readBytes(char* buf, size_t size) { return read((uint8_t*)buf, size); }
+  int available();
+  bool seek(uint32_t pos, SeekMode mode=SeekSet);
+  size_t position();
+  size_t size();
+  void flush();
+  void close();
+  bool isDirectory() const;
+  const char* name() const;
+  const char* path() const;
+  File openNextFile(const char* mode=FILE_READ);
+  operator bool() const { return (bool)_impl; }
+
+private:
+  struct Impl;
+  std::shared_ptr<Impl> _impl;
+  friend class FS;
+};
+
+class FS {
+public:
+  bool begin(bool formatOnFail=false, const char* basePath="/ffat", uint8_t maxOpenFiles=10, const char* partitionLabel=nullptr);
+  void end() {}
+  bool format();
+  File open(const char* path, const char* mode=FILE_READ, bool create=false);
+  File open(const String& path, const char* mode=FILE_READ, bool create=false) { return open(path.c_str(), mode, create); }
+  bool exists(const char* path);
+  bool exists(const String& path) { return exists(path.c_str()); }
+  bool remove(const char* path);
+  bool remove(const String& path) { return remove(path.c_str()); }
+  bool rename(const char* from, const char* to);
+  bool rename(const String& from, const String& to) { return rename(from.c_str(), to.c_str()); }
+  bool mkdir(const char* path);
+  size_t totalBytes() { return 0x1000000; }
+  size_t usedBytes();
+
+  // シム専用
+  void setRoot(const char* dir);   // 読み書きするPC上のディレクトリ
+  std::string hostPath(const char* path) const;   // ESP32のパスをPC上のパスに変換する
+
+private:
+  std::string _root;
+};
+extern FS FFat;
@@ -0,0 +1,36 @@
+/*
+  M5DinMeter.h (PC用のシム)
+  RTCだけを持つM5DinMeterの代用品
+
+  RTCはsetDateTime()で設定した時刻から、PCの時計の経過分だけ進む
+  setSystemTimeFromRtc()はPCのシステム時刻を変更しない（RtcShim::now()で参照する）
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#pragma once
+#include <Arduino.h>
+
+class RtcShim {
+public:
+  void setDateTime(const struct tm* t) { setEpoch(timegm(const_cast<struct tm*>(t))); }
+  void setEpoch(time_t epoch) { _base = epoch; _setAt = millis(); _valid = true; }
+  time_t now() const { return _valid ? _base + (time_t)((millis() - _setAt) / 1000) : time(nullptr); }
+  bool getDateTime(struct tm* t) const { time_t e = now(); return gmtime_r(&e, t) != nullptr; }
+  void setSystemTimeFromRtc() {}
+  void clearIRQ() {}
+  void disableIRQ() {}
+  bool isEnabled() const { return true; }
+
+private:
+  time_t _base = 0;
+  unsigned long _setAt = 0;
+  bool _valid = false;
+};
+
+class DinMeterShim {
+public:
+  RtcShim Rtc;
+};
+extern DinMeterShim DinMeter;
@@ -0,0 +1,45 @@
+/*
+  MFRC522_I2C.h (PC用のシム)
+  NfcEasyWriterをコンパイルするためのMFRC522_I2Cの代用品
+
+  リーダーは常にカード無しとして応答する。カードの動作はNfcCardSimulatorで再現する
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#pragma once
+#include <Arduino.h>
+class MFRC522_I2C {
+public:
+  enum PCD_Register { CommandReg = 0x01, ComIrqReg = 0x04, ErrorReg = 0x06, FIFODataReg = 0x09, FIFOLevelReg = 0x0A, ControlReg = 0x0C, BitFramingReg = 0x0D, VersionReg = 0x37, TModeReg, TPrescalerReg, TReloadRegH, TReloadRegL, TxASKReg, ModeReg };
+  enum PCD_Command { PCD_Idle = 0x00, PCD_Transceive = 0x0C };
+  enum PICC_Command { PICC_CMD_MF_AUTH_KEY_A = 0x60, PICC_CMD_MF_AUTH_KEY_B = 0x61 };
+  enum PICC_Type { PICC_TYPE_UNKNOWN = 0, PICC_TYPE_MIFARE_1K = 4, PICC_TYPE_MIFARE_4K = 5, PICC_TYPE_MIFARE_UL = 6 };
+  enum StatusCode { STATUS_OK = 1, STATUS_ERROR = 2, STATUS_COLLISION = 3, STATUS_TIMEOUT = 4, STATUS_NO_ROOM = 5,
+    STATUS_INTERNAL_ERROR = 6, STATUS_INVALID = 7, STATUS_CRC_WRONG = 8, STATUS_MIFARE_NACK = 9 };
+  typedef struct { byte size; byte uidByte[10]; byte sak; } Uid;
+  typedef struct { byte keyByte[6]; } MIFARE_Key;
+  Uid uid;
+  MFRC522_I2C(byte, byte, TwoWire*) {}
+  void PCD_Reset() {}
+  void PCD_WriteRegister(byte, byte) {}
+  void PCD_AntennaOn() {}
+  byte PCD_CalculateCRC(byte*, byte, byte*) { return STATUS_OK; }
+  byte PCD_TransceiveData(byte*, byte, byte*, byte*, byte*, byte, bool) { return STATUS_TIMEOUT; }
+  byte PCD_ReadRegister(byte) { return 0; }
+  bool PICC_IsNewCardPresent() { return false; }
+  bool PICC_ReadCardSerial() { return false; }
+  byte PICC_WakeupA(byte*, byte*) { return STATUS_TIMEOUT; }
+  byte PICC_HaltA() { return STATUS_OK; }
+  byte PICC_GetType(byte) { return 0; }
+  const char* PICC_GetTypeName(byte) { return ""; }
+  byte PCD_Authenticate(byte, byte, MIFARE_Key*, Uid*) { return STATUS_TIMEOUT; }
+  void PCD_StopCrypto1() {}
+  byte MIFARE_Read(byte, byte*, byte*) { return STATUS_TIMEOUT; }
+  byte MIFARE_Write(byte, byte*, byte) { return STATUS_TIMEOUT; }
+  void MIFARE_SetAccessBits(byte*, byte, byte, byte, byte) {}
+  byte MIFARE_Ultralight_Write(byte, byte*, byte) { return STATUS_TIMEOUT; }
+  void PICC_DumpToSerial(Uid*) {}
+  void PICC_DumpMifareUltralightToSerial() {}
+};
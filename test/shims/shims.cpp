@@ -0,0 +1,236 @@
+/*
+  shims.cpp
+  PC用のシムの実体
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#include <Arduino.h>
+#include <FFat.h>
+#include <M5DinMeter.h>
+#include <Base32-Decode.h>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+HardwareSerial Serial;
+TwoWire Wire;
+FS FFat;
+DinMeterShim DinMeter;
+
+//--------------------------------------------------------------
+// 時間、乱数
+//--------------------------------------------------------------
+static const auto bootTime = std::chrono::steady_clock::now();
+
+unsigned long millis() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - bootTime).count();
+}
+unsigned long micros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - bootTime).count();
+}
+void delay(unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+void yield() {}
+
+static std::mt19937& rng() {
+  static std::mt19937 gen(std::random_device{}());
+  return gen;
+}
+uint32_t esp_random() { return rng()(); }
+void esp_fill_random(void* buf, size_t len) {
+  uint8_t* p = (uint8_t*)buf;
+  for (size_t i=0; i<len; i++) p[i] = rng()() & 0xFF;
+}
+long random(long howbig) { return howbig <= 0 ? 0 : esp_random() % howbig; }
+long random(long howsmall, long howbig) { return howsmall >= howbig ? howsmall : howsmall + random(howbig - howsmall); }
+
+//--------------------------------------------------------------
+// Base32-Decode
+//--------------------------------------------------------------
+int base32decode(const char* encoded, unsigned char* decoded, int maxLength) {
+  uint32_t buffer = 0;
+  int bits = 0, count = 0;
+  for (const char* p = encoded; *p; p++) {
+    char c = *p;
+    int v;
+    if (c >= 'A' && c <= 'Z') v = c - 'A';
+    else if (c >= 'a' && c <= 'z') v = c - 'a';
+    else if (c >= '2' && c <= '7') v = c - '2' + 26;
+    else if (c == '=' || c == ' ' || c == '-') continue;
+    else return -1;
+    buffer = (buffer << 5) | v;
+    bits += 5;
+    if (bits >= 8) {
+      if (count >= maxLength) break;
+      decoded[count++] = (buffer >> (bits - 8)) & 0xFF;
+      bits -= 8;
+    }
+  }
+  return count;
+}
+
+//--------------------------------------------------------------
+// FatFS（PCの一時ディレクトリに読み書きする）
+//--------------------------------------------------------------
+struct File::Impl {
+  FILE* fp = nullptr;
+  DIR* dir = nullptr;
+  std::string path;     // ESP32のパス
+  std::string host;     // PC上のパス
+  std::string name;     // ファイル名部分
+  FS* fs = nullptr;
+  ~Impl() {
+    if (fp) fclose(fp);
+    if (dir) closedir(dir);
+  }
+};
+
+size_t File::write(const uint8_t* buf, size_t size) {
+  if (!_impl || !_impl->fp) return 0;
+  return fwrite(buf, 1, size, _impl->fp);
+}
+int File::read() {
+  if (!_impl || !_impl->fp) return -1;
+  int c = fgetc(_impl->fp);
+  return c == EOF ? -1 : c;
+}
+size_t File::read(uint8_t* buf, size_t size) {
+  if (!_impl || !_impl->fp) return 0;
+  return fread(buf, 1, size, _impl->fp);
+}
+int File::available() {
+  if (!_impl || !_impl->fp) return 0;
+  return size() - position();
+}
+bool File::seek(uint32_t pos, SeekMode mode) {
+  if (!_impl || !_impl->fp) return false;
+  int whence = (mode == SeekSet) ? SEEK_SET : (mode == SeekCur) ? SEEK_CUR : SEEK_END;
+  return fseek(_impl->fp, pos, whence) == 0;
+}
+size_t File::position() {
+  if (!_impl || !_impl->fp) return 0;
+  long p = ftell(_impl->fp);
+  return p < 0 ? 0 : p;
+}
+size_t File::size() {
+  if (!_impl || !_impl->fp) return 0;
+  fflush(_impl->fp);
+  struct stat st;
+  if (fstat(fileno(_impl->fp), &st) != 0) return 0;
+  return st.st_size;
+}
+void File::flush() {
+  if (_impl && _impl->fp) fflush(_impl->fp);
+}
+void File::close() {
+  _impl.reset();
+}
+bool File::isDirectory() const {
+  return _impl && _impl->dir;
+}
+const char* File::name() const {
+  return _impl ? _impl->name.c_str() : "";
+}
+const char* File::path() const {
+  return _impl ? _impl->path.c_str() : "";
+}
+File File::openNextFile(const char* mode) {
+  if (!_impl || !_impl->dir) return File();
+  while (struct dirent* ent = readdir(_impl->dir)) {
+    if (strcmp(ent->d_name, ".") == 0 || strcmp(ent->d_name, "..") == 0) continue;
+    std::string child = _impl->path;
+    if (child.empty() || child.back() != '/') child += "/";
+    return _impl->fs->open((child + ent->d_name).c_str(), mode);
+  }
+  return File();
+}
+
+void FS::setRoot(const char* dir) {
+  _root = dir;
+  while (!_root.empty() && _root.back() == '/') _root.pop_back();
+}
+
+std::string FS::hostPath(const char* path) const {
+  std::string p = path ? path : "";
+  if (p.empty() || p[0] != '/') p = "/" + p;
+  return _root + p;
+}
+
+bool FS::begin(bool formatOnFail, const char*, uint8_t, const char*) {
+  if (_root.empty()) {
+    const char* env = getenv("FFAT_SHIM_ROOT");
+    setRoot(env ? env : "/tmp/m5auth_ffat");
+  }
+  struct stat st;
+  if (stat(_root.c_str(), &st) == 0) return S_ISDIR(st.st_mode);
+  return formatOnFail && ::mkdir(_root.c_str(), 0700) == 0;
+}
+
+bool FS::format() {
+  if (_root.empty()) return false;
+  DIR* d = opendir(_root.c_str());
+  if (!d) return ::mkdir(_root.c_str(), 0700) == 0;
+  while (struct dirent* ent = readdir(d)) {
+    if (ent->d_name[0] == '.') continue;
+    unlink((_root + "/" + ent->d_name).c_str());
+  }
+  closedir(d);
+  return true;
+}
+
+File FS::open(const char* path, const char* mode, bool) {
+  File f;
+  auto impl = std::make_shared<File::Impl>();
+  impl->path = path ? path : "/";
+  impl->host = hostPath(path);
+  impl->fs = this;
+  size_t slash = impl->path.find_last_of('/');
+  impl->name = (slash == std::string::npos) ? impl->path : impl->path.substr(slash + 1);
+
+  struct stat st;
+  if (stat(impl->host.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) {
+    impl->dir = opendir(impl->host.c_str());
+    if (!impl->dir) return f;
+  } else {
+    // ESP32のFILE_READ/WRITE/APPENDはバイナリで開く
+    std::string m = mode;
+    if (m.find('b') == std::string::npos) m += "b";
+    impl->fp = fopen(impl->host.c_str(), m.c_str());
+    if (!impl->fp) return f;
+  }
+  f._impl = impl;
+  return f;
+}
+
+bool FS::exists(const char* path) {
+  struct stat st;
+  return stat(hostPath(path).c_str(), &st) == 0;
+}
+
+bool FS::remove(const char* path) {
+  return unlink(hostPath(path).c_str()) == 0;
+}
+
+bool FS::rename(const char* from, const char* to) {
+  return ::rename(hostPath(from).c_str(), hostPath(to).c_str()) == 0;
+}
+
+bool FS::mkdir(const char* path) {
+  return ::mkdir(hostPath(path).c_str(), 0700) == 0;
+}
+
+size_t FS::usedBytes() {
+  size_t used = 0;
+  DIR* d = opendir(_root.c_str());
+  if (!d) return 0;
+  while (struct dirent* ent = readdir(d)) {
+    struct stat st;
+    if (stat((_root + "/" + ent->d_name).c_str(), &st) == 0 && S_ISREG(st.st_mode)) used += st.st_size;
+  }
+  closedir(d);
+  return used;
+}
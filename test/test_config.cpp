@@ -0,0 +1,76 @@
+/*
+  test_config.cpp
+  設定ファイル(Configure)の保存と読み込みをFatFSのシムで確認する
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#include "hosttest.h"
+#include "hostenv.h"
+#include "Configure.h"
+
+// 初期設定を書き込むとconfにロードされる
+void testInitConfig() {
+  Configure cf;
+  cf._debug = false;
+  conf = ConfigInfo{};
+  CHECK(cf.initConfig());
+  CHECK(conf.loaded);
+  CHECK(conf.version == cf.CONFIG_VERSION);
+  CHECK(conf.autoEnter);
+  CHECK(conf.unlockTimeout == 300);
+  CHECK(FFat.exists(cf.CONFIG_FILENAME));
+}
+
+// 保存した内容がそのまま読める
+void testRoundTrip() {
+  Configure cf;
+  cf._debug = false;
+  ConfigInfo saved = {};
+  saved.saveSecret = CONF_SECRET_NFC;
+  saved.autoSleep = 120;
+  saved.quiet = true;
+  saved.unlockTimeout = 0;
+  CHECK(cf.saveConfig(saved));
+  ConfigInfo loaded = {};
+  CHECK(cf.loadConfig(loaded));
+  CHECK(loaded.loaded);
+  CHECK(loaded.saveSecret == CONF_SECRET_NFC);
+  CHECK(loaded.autoSleep == 120);
+  CHECK(loaded.quiet);
+  CHECK(loaded.unlockTimeout == 0);
+  CHECK(!saved.loaded);   // 保存元は書き換えない
+}
+
+// バージョン違いや大きさの違うファイルは読まない
+void testRejectBrokenFile() {
+  Configure cf;
+  cf._debug = false;
+  ConfigInfo loaded = {};
+  File file = FFat.open(cf.CONFIG_FILENAME, FILE_WRITE);
+  file.write((uint8_t)2);
+  file.close();
+  CHECK(!cf.loadConfig(loaded));
+
+  file = FFat.open(cf.CONFIG_FILENAME, FILE_WRITE);
+  file.write((uint8_t)1);
+  file.write((const uint8_t*)&loaded, sizeof(loaded) - 1);
+  file.close();
+  CHECK(!cf.loadConfig(loaded));
+  CHECK(!loaded.loaded);
+
+  FFat.remove(cf.CONFIG_FILENAME);
+  CHECK(!cf.loadConfig(loaded));
+}
+
+int main() {
+  if (!hostFatfsBegin("config")) {
+    printf("FatFS shim init failed\n");
+    return 1;
+  }
+  RUN_TEST(testInitConfig);
+  RUN_TEST(testRoundTrip);
+  RUN_TEST(testRejectBrokenFile);
+  return testResult();
+}
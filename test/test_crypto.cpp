@@ -0,0 +1,104 @@
+/*
+  test_crypto.cpp
+  AES 256bit CBCの暗号化/復号化(encrypt/decrypt)と暗号化セッションを確認する
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#include "hosttest.h"
+#include "hostenv.h"
+#include "coreutil.h"
+
+// NIST SP 800-38A F.2.5 CBC-AES256.Encrypt
+static const byte nistKey[32] = {
+  0x60, 0x3d, 0xeb, 0x10, 0x15, 0xca, 0x71, 0xbe, 0x2b, 0x73, 0xae, 0xf0, 0x85, 0x7d, 0x77, 0x81,
+  0x1f, 0x35, 0x2c, 0x07, 0x3b, 0x61, 0x08, 0xd7, 0x2d, 0x98, 0x10, 0xa3, 0x09, 0x14, 0xdf, 0xf4,
+};
+static const byte nistIv[16] = {
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+};
+static const byte nistPlain[64] = {
+  0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+  0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c, 0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+  0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11, 0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+  0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17, 0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10,
+};
+static const byte nistCipher[64] = {
+  0xf5, 0x8c, 0x4c, 0x04, 0xd6, 0xe5, 0xf1, 0xba, 0x77, 0x9e, 0xab, 0xfb, 0x5f, 0x7b, 0xfb, 0xd6,
+  0x9c, 0xfc, 0x4e, 0x96, 0x7e, 0xdb, 0x80, 0x8d, 0x67, 0x9f, 0x77, 0x7b, 0xc6, 0x70, 0x2c, 0x7d,
+  0x39, 0xf2, 0x33, 0x69, 0xa9, 0xd9, 0xba, 0xcf, 0xa5, 0x30, 0xe2, 0x63, 0x04, 0x23, 0x14, 0x61,
+  0xb2, 0xeb, 0x05, 0xe2, 0xc3, 0x9b, 0xe9, 0xfc, 0xda, 0x6c, 0x19, 0x07, 0x8c, 0x6a, 0x9d, 0x1b,
+};
+
+// encrypt()/decrypt()をNISTのテストベクタで確認する
+void testEncryptDecrypt() {
+  byte plain[64], out[64];
+  memcpy(plain, nistPlain, sizeof(plain));
+  CHECK(encrypt(plain, sizeof(plain), nistIv, nistKey, out) == 64);
+  CHECK_MEM(out, nistCipher, 64);
+  CHECK_MEM(plain, nistPlain, 64);   // 入力とIVは書き換えない
+  CHECK(decrypt(out, nistCipher, sizeof(nistCipher), nistIv, nistKey) == 64);
+  CHECK_MEM(out, nistPlain, 64);
+
+  // 16byteに満たない端数は0埋めして1ブロックにする
+  byte part[20], enc[32], dec[32];
+  memcpy(part, nistPlain, sizeof(part));
+  CHECK(encrypt(part, sizeof(part), nistIv, nistKey, enc) == 32);
+  CHECK_MEM(enc, nistCipher, 16);
+  CHECK(decrypt(dec, enc, sizeof(enc), nistIv, nistKey) == 32);
+  CHECK_MEM(dec, part, 20);
+  static const byte zeros[12] = {0};
+  CHECK_MEM(dec + 20, zeros, 12);
+
+  // 復号化は16byteの倍数だけ
+  CHECK(decrypt(dec, enc, 20, nistIv, nistKey) == 0);
+  CHECK(decrypt(dec, enc, 32, nistIv, nullptr) == 0);
+}
+
+// 暗号化セッションは鍵を展開したまま、encrypt()/decrypt()と同じ結果になる
+void testCryptoSession() {
+  byte out[64], dec[64];
+  CHECK(sessionEncrypt(nistPlain, 64, nistIv, out) == 0);   // 開始前は使えない
+  CHECK(cryptoSessionBegin(nistKey));
+  CHECK(cryptoSession.ready);
+  for (int n=0; n<3; n++) {   // 同じ鍵スケジュールを繰り返し使う
+    CHECK(sessionEncrypt(nistPlain, 64, nistIv, out) == 64);
+    CHECK_MEM(out, nistCipher, 64);
+    CHECK(sessionDecrypt(dec, nistCipher, 64, nistIv) == 64);
+    CHECK_MEM(dec, nistPlain, 64);
+  }
+  CHECK(sessionDecrypt(dec, nistCipher, 63, nistIv) == 0);
+
+  // 別の鍵で開始し直すと前の鍵は残らない
+  byte key2[32];
+  memcpy(key2, nistKey, sizeof(key2));
+  key2[0] ^= 1;
+  CHECK(cryptoSessionBegin(key2));
+  CHECK(sessionDecrypt(dec, nistCipher, 64, nistIv) == 64);
+  CHECK(memcmp(dec, nistPlain, 64) != 0);
+
+  cryptoSessionEnd();
+  CHECK(!cryptoSession.ready);
+  CHECK(sessionDecrypt(dec, nistCipher, 64, nistIv) == 0);
+  cryptoSessionEnd();   // 2回呼んでもよい
+}
+
+// SHA256
+void testSha256() {
+  static const byte abc[32] = {
+    0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+    0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad,
+  };
+  byte out[32];
+  CHECK(sha256("abc", out, sizeof(out)));
+  CHECK_MEM(out, abc, 32);
+  CHECK(!sha256("abc", out, 31));
+}
+
+int main() {
+  RUN_TEST(testEncryptDecrypt);
+  RUN_TEST(testCryptoSession);
+  RUN_TEST(testSha256);
+  return testResult();
+}
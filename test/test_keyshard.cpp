@@ -0,0 +1,107 @@
+/*
+  test_keyshard.cpp
+  秘密鍵の分割保存(keyshard.h)のGF(2^8)の計算と、分割・復元を確認する
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#include "hosttest.h"
+#include "NfcCardSimulator.h"
+#include "hostenv.h"
+#include "coreutil.h"
+
+NfcCardSimulator sim;
+NfcEasyWriter nfc(sim);
+AuthKey passwdNfc = { { 0x3C, 0x5A, 0x96, 0x0F, 0xE1, 0x7B } };
+#include "nfcstore.h"
+
+// keyshard.hのカードから解錠する関数が使う、utility.hの関数の代わり（このテストでは呼ばない）
+bool readSecretDef(SecretStore device, SecretDef* sdef) { return false; }
+size_t decryptSecretDef(const SecretDef* sdef, byte* output) { return 0; }
+bool loadSecretDef(const SecretDef* sdef) { return false; }
+void lockSecret() {}
+void unlockSessionTouch() {}
+#include "keyshard.h"
+
+// GF(2^8)の掛け算（FIPS-197 4.2の例）と、0以外の全ての値の逆数
+void testGf256() {
+  CHECK(gf256Mul(0x57, 0x83) == 0xC1);
+  CHECK(gf256Mul(0x57, 0x13) == 0xFE);
+  CHECK(gf256Mul(0x00, 0xAB) == 0x00);
+  CHECK(gf256Inv(0) == 0);
+  int wrong = 0;
+  for (int a=1; a<256; a++) {
+    if (gf256Mul(a, gf256Inv(a)) != 1) wrong ++;
+  }
+  CHECK(wrong == 0);
+}
+
+// k-of-nで分割し、k枚の全ての組み合わせから復元できる
+static void splitCombine(uint8_t k, uint8_t n) {
+  byte secret[32], shares[SHARD_MAX][32], back[32];
+  esp_fill_random(secret, sizeof(secret));
+  CHECK(shardSplit(secret, k, n, shares));
+  int subsets = 0;
+  for (uint32_t mask=0; mask<(1u << n); mask++) {
+    if (__builtin_popcount(mask) != k) continue;
+    uint8_t xs[SHARD_MAX];
+    byte ys[SHARD_MAX][32];
+    int m = 0;
+    for (int i=n-1; i>=0; i--) {   // 番号の順に並んでいなくてもよい
+      if (!(mask & (1u << i))) continue;
+      xs[m] = i + 1;
+      memcpy(ys[m], shares[i], 32);
+      m++;
+    }
+    memset(back, 0, sizeof(back));
+    CHECK(shardCombine(xs, ys, k, back));
+    CHECK_MEM(back, secret, sizeof(secret));
+    subsets ++;
+  }
+  int expect = 1;   // nCk
+  for (int i=0; i<k; i++) expect = expect * (n - i) / (i + 1);
+  CHECK(subsets == expect);
+}
+
+void testSplitCombine2of2() { splitCombine(2, 2); }
+void testSplitCombine2of3() { splitCombine(2, 3); }
+void testSplitCombine3of5() { splitCombine(3, 5); }
+
+// 枚数の指定が正しくなければ分割しない
+void testSplitRejected() {
+  byte secret[32] = {0}, shares[SHARD_MAX + 1][32];
+  CHECK(!shardSplit(secret, 1, 3, shares));   // k<2
+  CHECK(!shardSplit(secret, 4, 3, shares));   // k>n
+  CHECK(!shardSplit(secret, 2, SHARD_MAX + 1, shares));   // n>SHARD_MAX
+  CHECK(!shardSplit(nullptr, 2, 3, shares));
+  CHECK(shardSplit(secret, SHARD_MAX, SHARD_MAX, shares));
+  uint8_t xs[2] = { 1, 2 };
+  CHECK(!shardCombine(xs, shares, 1, secret));
+  CHECK(!shardCombine(xs, shares, SHARD_MAX + 1, secret));
+}
+
+// 係数は0も含めて一様なので、2-of-nの1枚目の値が秘密鍵と同じになることもある
+//   （0を除くと、k-1枚から秘密鍵ではない値が1つ分かってしまう）
+void testCoefficientUniform() {
+  byte secret[32], shares[2][32];
+  esp_fill_random(secret, sizeof(secret));
+  int same = 0;
+  for (int r=0; r<400; r++) {   // 32byte×400回で、1/256の事象が起きない確率は e^-50
+    CHECK(shardSplit(secret, 2, 2, shares));
+    for (int b=0; b<32; b++) {
+      if (shares[0][b] == secret[b]) same ++;
+    }
+  }
+  CHECK(same > 0);
+}
+
+int main() {
+  RUN_TEST(testGf256);
+  RUN_TEST(testSplitCombine2of2);
+  RUN_TEST(testSplitCombine2of3);
+  RUN_TEST(testSplitCombine3of5);
+  RUN_TEST(testSplitRejected);
+  RUN_TEST(testCoefficientUniform);
+  return testResult();
+}
@@ -0,0 +1,227 @@
+/*
+  test_migration.cpp
+  Google Authenticatorのエクスポート(otpauth-migration://)のデコードを確認する
+  protobufのリーダー(PbReader)、1アカウント分の変換(parseMigrationOtp)、URI全体(parseMigrationUri)
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#include "hosttest.h"
+#include "hostenv.h"
+#include "totputil.h"
+#include "migration_data.h"
+
+// PbReaderでバッファを読む
+static PbReader reader(const std::vector<uint8_t>& buf) {
+  return { buf.data(), buf.data() + buf.size() };
+}
+
+// varint
+void testPbVarint() {
+  uint64_t v;
+  std::vector<uint8_t> one = { 0x01 };
+  PbReader pb = reader(one);
+  CHECK(pb.readVarint(&v) && v == 1 && pb.eof());
+
+  std::vector<uint8_t> multi = { 0xAC, 0x02 };   // 300
+  pb = reader(multi);
+  CHECK(pb.readVarint(&v) && v == 300 && pb.eof());
+
+  std::vector<uint8_t> max = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01 };
+  pb = reader(max);
+  CHECK(pb.readVarint(&v) && v == UINT64_MAX);
+
+  std::vector<uint8_t> tooLong(11, 0x80);   // 続きのビットが10バイトを超える
+  tooLong.back() = 0x00;
+  pb = reader(tooLong);
+  CHECK(!pb.readVarint(&v));
+
+  std::vector<uint8_t> truncated = { 0x80, 0x80 };
+  pb = reader(truncated);
+  CHECK(!pb.readVarint(&v));
+
+  std::vector<uint8_t> empty;
+  pb = reader(empty);
+  CHECK(pb.eof());
+  CHECK(!pb.readVarint(&v));
+}
+
+// タグ、長さ付きデータ、読み飛ばし
+void testPbFields() {
+  uint32_t field;
+  uint8_t wire;
+  const uint8_t* d;
+  size_t n;
+
+  std::vector<uint8_t> tag = { 0x0A };   // field=1, wire=2
+  PbReader pb = reader(tag);
+  CHECK(pb.readTag(&field, &wire) && field == 1 && wire == 2);
+  std::vector<uint8_t> zero = { 0x02 };   // field=0は不正
+  pb = reader(zero);
+  CHECK(!pb.readTag(&field, &wire));
+
+  std::vector<uint8_t> bytes = { 0x03, 'a', 'b', 'c', 0x7F };
+  pb = reader(bytes);
+  CHECK(pb.readBytes(&d, &n) && n == 3 && memcmp(d, "abc", 3) == 0);
+  CHECK(!pb.eof());
+  std::vector<uint8_t> over = { 0x04, 'a', 'b', 'c' };   // 長さがバッファを超える
+  pb = reader(over);
+  CHECK(!pb.readBytes(&d, &n));
+  std::vector<uint8_t> huge = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01 };
+  pb = reader(huge);
+  CHECK(!pb.readBytes(&d, &n));
+
+  std::vector<uint8_t> fixed = { 1, 2, 3, 4, 5, 6, 7, 8, 1, 2, 3, 4 };
+  pb = reader(fixed);
+  CHECK(pb.skip(1) && pb.skip(5) && pb.eof());
+  CHECK(!pb.skip(1) && !pb.skip(5));
+  std::vector<uint8_t> any = { 0x00 };
+  pb = reader(any);
+  CHECK(!pb.skip(3) && !pb.skip(4) && !pb.skip(6) && !pb.skip(7));   // グループや未定義のワイヤタイプ
+}
+
+// Base32エンコード
+void testBase32Encode() {
+  char out[80];
+  CHECK(base32Encode((const uint8_t*)"12345678901234567890", 20, out, sizeof(out)) == 32);
+  CHECK_STR(out, "GEZDGNBVGY3TQOJQGEZDGNBVGY3TQOJQ");
+  CHECK(base32Encode((const uint8_t*)"f", 1, out, sizeof(out)) == 2);
+  CHECK_STR(out, "MY");
+  CHECK(base32Encode((const uint8_t*)"foobar", 6, out, sizeof(out)) == 10);
+  CHECK_STR(out, "MZXW6YTBOI");
+  CHECK(base32Encode((const uint8_t*)"12345678901234567890", 20, out, 32) == 0);   // 終端が入らない
+}
+
+// 1アカウント分(OtpParameters)
+void testParseMigrationOtp() {
+  TotpParams tp;
+  std::vector<uint8_t> otp = pbOtp("12345678901234567890", "Example:alice@google.com", "", 1, 1, 2);
+  CHECK(parseMigrationOtp(otp.data(), otp.size(), &tp));
+  CHECK_STR(tp.secret, "GEZDGNBVGY3TQOJQGEZDGNBVGY3TQOJQ");
+  CHECK_STR(tp.issuer, "Example");   // issuerが空なら名前から取る
+  CHECK_STR(tp.account, "alice@google.com");
+  CHECK(tp.algorithm == TOTP_ALGO_SHA1 && tp.digit == 6 && tp.period == 30);
+
+  otp = pbOtp("12345678901234567890", "Other: bob", "Corp", 3, 2, 0);
+  CHECK(parseMigrationOtp(otp.data(), otp.size(), &tp));
+  CHECK_STR(tp.issuer, "Corp");   // issuerフィールドが優先
+  CHECK_STR(tp.account, "bob");
+  CHECK(tp.algorithm == TOTP_ALGO_SHA512 && tp.digit == 8);
+
+  // 未指定は既定値
+  otp = pbOtp("12345678901234567890", "carol", "", 0, 0, 0);
+  CHECK(parseMigrationOtp(otp.data(), otp.size(), &tp));
+  CHECK(tp.algorithm == TOTP_ALGO_SHA1 && tp.digit == 6);
+  CHECK_STR(tp.account, "carol");
+
+  // 知らないフィールド(counter=7, 未定義の固定長)は読み飛ばす
+  otp = pbOtp("12345678901234567890", "dave", "", 1, 1, 2);
+  pbVarintField(&otp, 7, 42);
+  pbVarint(&otp, (20 << 3) | 5);
+  for (int i=0; i<4; i++) otp.push_back(0);
+  CHECK(parseMigrationOtp(otp.data(), otp.size(), &tp));
+
+  // 非対応
+  strcpy(tp.account, "unchanged");
+  otp = pbOtp("12345678901234567890", "hotp", "", 1, 1, 1);   // HOTP
+  CHECK(!parseMigrationOtp(otp.data(), otp.size(), &tp));
+  otp = pbOtp("12345678901234567890", "md5", "", 4, 1, 2);    // MD5
+  CHECK(!parseMigrationOtp(otp.data(), otp.size(), &tp));
+  otp = pbOtp("12345678901234567890", "digits", "", 1, 3, 2);
+  CHECK(!parseMigrationOtp(otp.data(), otp.size(), &tp));
+  otp = pbOtp("", "nosecret", "", 1, 1, 2);
+  CHECK(!parseMigrationOtp(otp.data(), otp.size(), &tp));
+  otp = pbOtp(std::string(40, 'x'), "long", "", 1, 1, 2);    // Base32で64文字になり入らない
+  CHECK(!parseMigrationOtp(otp.data(), otp.size(), &tp));
+  otp = pbOtp(std::string(39, 'x'), "fits", "", 1, 1, 2);    // 63文字
+  CHECK(parseMigrationOtp(otp.data(), otp.size(), &tp));
+  CHECK(strlen(tp.secret) == 63);
+
+  // 壊れたデータ
+  strcpy(tp.account, "unchanged");
+  otp = pbOtp("12345678901234567890", "eve", "", 1, 1, 2);
+  CHECK(!parseMigrationOtp(otp.data(), 22 + 3, &tp));   // 名前の途中で切れている（秘密鍵のフィールドは22バイト）
+  CHECK(!parseMigrationOtp(otp.data(), otp.size() - 1, &tp));   // 最後のvarintが切れている
+  CHECK_STR(tp.account, "unchanged");
+}
+
+// 記録済みのエクスポートデータ（3件中1件はHOTPなので除外される）
+void testRecordedPayload() {
+  char buff[512];
+  size_t len = strlen(MIGRATION_RECORDED_URI);
+  memcpy(buff, MIGRATION_RECORDED_URI, len);
+  std::vector<TotpParams> tps;
+  MigrationBatch batch;
+  CHECK(parseMigrationUri(buff, len, &tps, &batch));
+  CHECK(tps.size() == 2);
+  CHECK(batch.skipped == 1 && batch.batchSize == 1 && batch.batchIndex == 0 && batch.batchId == 123456789);
+  for (size_t i=0; i<tps.size() && i<2; i++) {
+    const MigrationExpect& e = MIGRATION_RECORDED_EXPECT[i];
+    CHECK_STR(tps[i].issuer, e.issuer);
+    CHECK_STR(tps[i].account, e.account);
+    CHECK_STR(tps[i].secret, e.secret);
+    CHECK(tps[i].algorithm == e.algorithm && tps[i].digit == e.digit && tps[i].period == e.period);
+  }
+}
+
+// パーセントエンコードされたbase64、複数枚のバッチ
+void testEncodedPayload() {
+  std::vector<uint8_t> payload;
+  pbBytesField(&payload, 1, pbOtp("\xfb\xff\xfe", "a", "", 1, 1, 2));   // base64に+と/が出る秘密鍵
+  pbVarintField(&payload, 2, 1);
+  pbVarintField(&payload, 3, 3);
+  pbVarintField(&payload, 4, 2);
+  pbVarintField(&payload, 5, 77);
+  std::string uri = migrationUri(payload, true);
+  std::vector<char> buff(uri.begin(), uri.end());
+  std::vector<TotpParams> tps;
+  MigrationBatch batch;
+  CHECK(uri.find("%2B") != std::string::npos || uri.find("%2F") != std::string::npos);
+  CHECK(parseMigrationUri(buff.data(), buff.size(), &tps, &batch));
+  CHECK(tps.size() == 1);
+  CHECK(batch.batchSize == 3 && batch.batchIndex == 2 && batch.batchId == 77);
+  CHECK_STR(tps[0].secret, "7P774");
+}
+
+// 壊れたエクスポートは追加した分を取り消す
+void testRejectedPayload() {
+  std::vector<TotpParams> tps(1);   // 既にあるアカウントは残す
+  MigrationBatch batch;
+  std::vector<uint8_t> payload;
+  pbBytesField(&payload, 1, pbOtp("12345678901234567890", "a", "", 1, 1, 2));
+  pbBytesField(&payload, 1, pbOtp("12345678901234567890", "b", "", 1, 1, 2));
+  std::vector<uint8_t> broken = payload;
+  broken.push_back(0x0A);   // 長さのない最後のフィールド
+  std::string uri = migrationUri(broken, false);
+  std::vector<char> buff(uri.begin(), uri.end());
+  CHECK(!parseMigrationUri(buff.data(), buff.size(), &tps, &batch));
+  CHECK(tps.size() == 1);
+
+  std::vector<uint8_t> badIndex = payload;   // batch_index >= batch_size
+  pbVarintField(&badIndex, 3, 2);
+  pbVarintField(&badIndex, 4, 2);
+  uri = migrationUri(badIndex, false);
+  buff.assign(uri.begin(), uri.end());
+  CHECK(!parseMigrationUri(buff.data(), buff.size(), &tps, &batch));
+  CHECK(tps.size() == 1);
+
+  char notB64[] = "otpauth-migration://offline?data=!!!!";
+  CHECK(!parseMigrationUri(notB64, strlen(notB64), &tps, &batch));
+  char noData[] = "otpauth-migration://offline?version=1";
+  CHECK(!parseMigrationUri(noData, strlen(noData), &tps, &batch));
+  char otherScheme[] = "otpauth://totp/a?secret=JBSWY3DPEHPK3PXP";
+  CHECK(!parseMigrationUri(otherScheme, strlen(otherScheme), &tps, &batch));
+  CHECK(tps.size() == 1);
+}
+
+int main() {
+  RUN_TEST(testPbVarint);
+  RUN_TEST(testPbFields);
+  RUN_TEST(testBase32Encode);
+  RUN_TEST(testParseMigrationOtp);
+  RUN_TEST(testRecordedPayload);
+  RUN_TEST(testEncodedPayload);
+  RUN_TEST(testRejectedPayload);
+  return testResult();
+}
@@ -0,0 +1,222 @@
+/*
+  test_nfc.cpp
+  NfcEasyWriterのアドレス変換、プロテクト、フォーマット、セクタートレーラーの修復をNfcCardSimulatorで確認する
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#include "hosttest.h"
+#include "NfcCardSimulator.h"
+
+static NfcCardSimulator sim;
+static NfcEasyWriter snfc(sim);
+static AuthKey testKey = { { 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC } };
+
+// カードを置いてマウントする
+static bool mountSim(SimCardType type) {
+  snfc.unmountCard();
+  sim.insertCard(type);
+  snfc.setAuthKey(&snfc._authKeyBDefault);
+  return snfc.mountCard(100, PRT_NOPASS_RW);
+}
+
+// [Classic] セクタートレーラーの先頭
+static byte* trailerCL(uint16_t sector) {
+  return sim.memory() + (sector * 4 + 3) * 16;
+}
+
+// 仮想アドレスから物理アドレスへの変換
+void testAddr2PhysicalAddr() {
+  // Classic: 1セクタ3ブロック(48バイト)、セクタ1から
+  PhyAddr pa = snfc.addr2PhysicalAddr(0, CardType::Classic);
+  CHECK(pa.sector == 1 && pa.block == 0 && pa.blockAddr == 4);
+  pa = snfc.addr2PhysicalAddr(16, CardType::Classic);
+  CHECK(pa.sector == 1 && pa.block == 1 && pa.blockAddr == 5);
+  pa = snfc.addr2PhysicalAddr(47, CardType::Classic);
+  CHECK(pa.sector == 1 && pa.block == 2 && pa.blockAddr == 6);
+  pa = snfc.addr2PhysicalAddr(48, CardType::Classic);   // トレーラー(ブロック7)を飛ばす
+  CHECK(pa.sector == 2 && pa.block == 0 && pa.blockAddr == 8);
+  pa = snfc.addr2PhysicalAddr(14 * 48 + 32, CardType::Classic);
+  CHECK(pa.sector == 15 && pa.block == 2 && pa.blockAddr == 62);
+
+  // Ultralight: 1ページ4バイト、ページ5から（255で止まる）
+  CHECK(snfc.addr2PhysicalAddr(0, CardType::Ultralight).blockAddr == 5);
+  CHECK(snfc.addr2PhysicalAddr(3, CardType::Ultralight).blockAddr == 5);
+  CHECK(snfc.addr2PhysicalAddr(4, CardType::Ultralight).blockAddr == 6);
+  CHECK(snfc.addr2PhysicalAddr(2000, CardType::Ultralight).blockAddr == 255);
+
+  // 使用する範囲の先頭を変えたとき
+  snfc._minSectorCL = 2;
+  snfc._minPageUL = 8;
+  CHECK(snfc.addr2PhysicalAddr(0, CardType::Classic).blockAddr == 8);
+  CHECK(snfc.addr2PhysicalAddr(0, CardType::Ultralight).blockAddr == 8);
+  snfc._minSectorCL = 1;
+  snfc._minPageUL = 5;
+
+  // 変換した物理アドレスに実際に書き込まれる
+  byte data[64];
+  for (size_t i=0; i<sizeof(data); i++) data[i] = 0x80 + i;
+  CHECK(mountSim(SIM_CLASSIC1K));
+  CHECK(snfc.writeData(32, data, sizeof(data)));
+  pa = snfc.addr2PhysicalAddr(48, CardType::Classic);
+  CHECK_MEM(sim.memory() + pa.blockAddr * 16, data + 16, 16);
+  CHECK_MEM(sim.memory() + 6 * 16, data, 16);
+  CHECK(mountSim(SIM_NTAG213));
+  CHECK(snfc.writeData(12, data, sizeof(data)));
+  pa = snfc.addr2PhysicalAddr(12, CardType::Ultralight);
+  CHECK_MEM(sim.memory() + pa.blockAddr * 4, data, sizeof(data));
+}
+
+// [Classic] 指定した範囲のセクタだけにパスワードがかかり、解除もできる
+void testWriteProtectCL() {
+  byte data[96], back[96];
+  for (size_t i=0; i<sizeof(data); i++) data[i] = i;
+  CHECK(mountSim(SIM_CLASSIC1K));
+  CHECK(snfc.writeData(0, data, sizeof(data)));
+  CHECK(!snfc.writeProtectCL(PRT_PASSWD_RW, &testKey, 16, 48));   // セクタの途中からは不可
+
+  // セクタ1,2にKeyBを設定する（セクタ3は出荷時のまま）
+  CHECK(snfc.writeProtectCL(PRT_PASSWD_RW, &testKey, 0, 96));
+  CHECK(snfc._lastProtectMode == PRT_PASSWD_RW);
+  for (int sector=1; sector<=2; sector++) {
+    CHECK_MEM(trailerCL(sector) + 10, testKey.keyByte, 6);
+    CHECK(trailerCL(sector)[9] == PRT_PASSWD_RW);
+  }
+  CHECK(trailerCL(3)[7] == 0x07 && trailerCL(3)[8] == 0x80);
+
+  // KeyAでは読めず、KeyBなら読み書きできる
+  CHECK(!snfc.readData(0, back, sizeof(back), PRT_NOPASS_RW));
+  CHECK(!snfc.readData(48, back, 48, PRT_PASSWD_RW));   // KeyBが違う
+  snfc.setAuthKey(&testKey);
+  CHECK(snfc.readData(0, back, sizeof(back), PRT_PASSWD_RW));
+  CHECK_MEM(back, data, sizeof(data));
+  data[50] ^= 0xFF;
+  CHECK(snfc.writeData(48, data + 48, 48, PRT_PASSWD_RW));
+  CHECK(snfc.readData(96, back, 48, PRT_NOPASS_RW));    // 範囲外はKeyAのまま
+
+  // 読み込み専用にすると書き込めない
+  CHECK(snfc.writeProtectCL(PRT_PASSWD_RO, &testKey, 0, 96, PRT_PASSWD_RW));
+  CHECK(!snfc.writeData(0, data, 16, PRT_PASSWD_RO));
+  CHECK(snfc.readData(0, back, sizeof(back), PRT_PASSWD_RO));
+  CHECK_MEM(back, data, sizeof(data));
+
+  // 解除するとKeyAで読み書きでき、KeyBは初期値に戻る
+  CHECK(snfc.writeProtectCL(PRT_NOPASS_RW, nullptr, 0, 96, PRT_PASSWD_RO));
+  CHECK(snfc.writeData(0, data, 16, PRT_NOPASS_RW));
+  CHECK(snfc.readData(0, back, sizeof(back), PRT_NOPASS_RW));
+  CHECK_MEM(back, data, sizeof(data));
+  CHECK_MEM(trailerCL(1) + 10, snfc._authKeyBDefault.keyByte, 6);
+}
+
+// [Ultralight] 指定したページ以降にパスワードがかかり、解除もできる
+void testWriteProtectUL() {
+  byte data[32], back[32];
+  for (size_t i=0; i<sizeof(data); i++) data[i] = 0x40 + i;
+  CHECK(mountSim(SIM_NTAG213));
+  CHECK(snfc.writeData(0, data, sizeof(data)));
+  CHECK(!snfc.writeProtectUL(PRT_PASSWD_RW, &testKey, 2));      // ページの途中からは不可
+  CHECK(!snfc.writeProtectUL(PRT_NOPASS_RO, &testKey, 16));     // Ultralightにはない
+
+  // vaddr 16(page 9)以降にパスワードを設定する
+  CHECK(snfc.writeProtectUL(PRT_PASSWD_RO, &testKey, 16));
+  const byte* cfg = sim.memory() + snfc._configPageUL * 4;
+  CHECK(cfg[3] == 9);                   // AUTH0
+  CHECK((cfg[4] & 0x80) == 0);          // PROT=0 書き込みだけ保護
+  CHECK_MEM(cfg + 8, testKey.keyByte, 4);
+  CHECK_MEM(cfg + 12, testKey.keyByte + 4, 2);
+
+  // 選択し直すとAUTH0が有効になる　認証しなければ保護した範囲には書き込めない
+  snfc.setAuthKey(&testKey);
+  CHECK(snfc.mountCard(100, PRT_NOPASS_RW));
+  CHECK(snfc.readData(0, back, sizeof(back), PRT_NOPASS_RW));
+  CHECK_MEM(back, data, sizeof(data));
+  CHECK(snfc.writeData(0, data, 16, PRT_NOPASS_RW));    // AUTH0より前は書ける
+  CHECK(!snfc.writeData(16, data, 16, PRT_NOPASS_RW));
+  CHECK(snfc.mountCard(100, PRT_PASSWD_RO));
+  CHECK(snfc.writeData(16, data, 16, PRT_PASSWD_RW));
+
+  // 読み書きとも保護すると、認証しなければ読めない
+  CHECK(snfc.writeProtectUL(PRT_PASSWD_RW, &testKey, 16, false, PRT_PASSWD_RO));
+  CHECK((sim.memory()[snfc._configPageUL * 4 + 4] & 0x80) != 0);
+  CHECK(snfc.mountCard(100, PRT_NOPASS_RW));
+  CHECK(!snfc.readData(16, back, 16, PRT_NOPASS_RW));
+  CHECK(snfc.mountCard(100, PRT_PASSWD_RW));
+  CHECK(snfc.readData(16, back, 16, PRT_PASSWD_RW));
+  CHECK_MEM(back, data, 16);
+
+  // 解除するとAUTH0=FFに戻る
+  CHECK(snfc.writeProtectUL(PRT_NOPASS_RW, nullptr, 16, false, PRT_PASSWD_RW));
+  CHECK(sim.memory()[snfc._configPageUL * 4 + 3] == 0xFF);
+  CHECK(snfc.mountCard(100, PRT_NOPASS_RW));
+  CHECK(snfc.writeData(16, data, 16, PRT_NOPASS_RW));
+}
+
+// フォーマット　NDEFメッセージを消し、formatAllならデータ領域を0にする
+void testFormat() {
+  byte data[64], back[64], zero[64] = {};
+  for (size_t i=0; i<sizeof(data); i++) data[i] = 0xA0 + i;
+
+  CHECK(mountSim(SIM_NTAG215));
+  CHECK(snfc.writeData(0, data, sizeof(data)));
+  CHECK(snfc.format(false));
+  CHECK(sim.memory()[4 * 4] == 0xFE);   // page.4がTerminator TLV
+  CHECK(snfc.readData(0, back, sizeof(back)));
+  CHECK_MEM(back, data, sizeof(data));  // データは残る
+  CHECK(snfc.format(true));
+  CHECK(snfc.readData(0, back, sizeof(back)));
+  CHECK_MEM(back, zero, sizeof(back));
+  uint16_t last = snfc.getVCapacities() - sizeof(back);
+  CHECK(snfc.readData(last, back, sizeof(back)));
+  CHECK_MEM(back, zero, sizeof(back));
+  CHECK(sim.memory()[snfc._configPageUL * 4 + 3] == 0xFF);   // 設定ページは書き換えない
+
+  CHECK(mountSim(SIM_CLASSIC1K));
+  CHECK(snfc.writeData(48 * 14, data, 48));
+  CHECK(snfc.format(true));
+  CHECK(snfc.readData(48 * 14, back, 48));
+  CHECK_MEM(back, zero, 48);
+  CHECK(trailerCL(15)[7] == 0x07 && trailerCL(15)[8] == 0x80);   // トレーラーは書き換えない
+
+  snfc.unmountCard();
+  CHECK(!snfc.format(false));   // マウントしていなければ何もしない
+}
+
+// [Classic] KeyBを設定したセクタートレーラーを出荷時の状態に戻す
+void testRecoverySectorTruckCL() {
+  byte data[48], back[48];
+  memset(data, 0x5A, sizeof(data));
+  CHECK(mountSim(SIM_CLASSIC1K));
+  CHECK(snfc.writeData(48, data, sizeof(data)));
+  CHECK(snfc.writeProtectCL(PRT_PASSWD_RO, &testKey, 48, 48));
+  CHECK(!snfc.readData(48, back, sizeof(back), PRT_NOPASS_RW));
+
+  // 対象外のブロック
+  CHECK(!snfc.recoverySectorTruckCL(3, &testKey));    // セクタ0
+  CHECK(!snfc.recoverySectorTruckCL(10, &testKey));   // トレーラーではない
+  // 違うキーでは修復できない
+  AuthKey wrong = testKey;
+  wrong.keyByte[0] ^= 0xFF;
+  CHECK(!snfc.recoverySectorTruckCL(11, &wrong));
+
+  // 正しいKeyBで修復するとKeyAで読み書きできる
+  CHECK(snfc.recoverySectorTruckCL(11, &testKey));
+  const byte factory[16] = { 0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, 0xFF,0x07,0x80,0x69, 0xFF,0xFF,0xFF,0xFF,0xFF,0xFF };
+  CHECK_MEM(trailerCL(2), factory, sizeof(factory));
+  CHECK(snfc.readData(48, back, sizeof(back), PRT_NOPASS_RW));
+  CHECK_MEM(back, data, sizeof(data));
+  CHECK(snfc.writeData(48, data, sizeof(data), PRT_NOPASS_RW));
+
+  // Ultralightでは使えない
+  CHECK(mountSim(SIM_NTAG213));
+  CHECK(!snfc.recoverySectorTruckCL(11, &testKey));
+}
+
+int main() {
+  RUN_TEST(testAddr2PhysicalAddr);
+  RUN_TEST(testWriteProtectCL);
+  RUN_TEST(testWriteProtectUL);
+  RUN_TEST(testFormat);
+  RUN_TEST(testRecoverySectorTruckCL);
+  return testResult();
+}
@@ -0,0 +1,187 @@
+/*
+  test_nfcstore.cpp
+  NFCカードへの秘密鍵ファイルの保存と読み込み(nfcstore.h)をNfcCardSimulatorで確認する
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#include "hosttest.h"
+#include "NfcCardSimulator.h"
+#include "hostenv.h"
+
+NfcCardSimulator sim;
+NfcEasyWriter nfc(sim);
+AuthKey passwdNfc = { { 0x3C, 0x5A, 0x96, 0x0F, 0xE1, 0x7B } };
+#include "nfcstore.h"
+
+// 秘密鍵ファイルの中身（暗号化済みの部分は番号で埋める）
+static SecretDef makeDef(byte fill) {
+  SecretDef sdef;
+  memcpy(sdef.magic, SecretMagic, sizeof(sdef.magic));
+  memset(sdef.secretEnc, fill, sizeof(sdef.secretEnc));
+  return sdef;
+}
+
+// カードを置いてマウントする（KeyBはpasswdNfc）
+static bool mountSim(SimCardType type, ProtectMode mode=PRT_NOPASS_RW) {
+  nfc.unmountCard();
+  sim.insertCard(type);
+  nfc.setAuthKey(&passwdNfc);
+  return nfc.mountCard(100, mode);
+}
+
+// 読み込んだ秘密鍵ファイルが一致するか
+static bool loadedEquals(const SecretDef& expect) {
+  SecretDef back;
+  if (loadSecretNfc(&back) != SECRET_SAVE_SIZE) return false;
+  return memcmp(&back, &expect, sizeof(back)) == 0;
+}
+
+// [Classic] 両スロットともプロテクト済みのカードに保存する
+void testSaveClassic() {
+  CHECK(mountSim(SIM_CLASSIC1K));
+  CHECK(nfc.writeProtectCL(PRT_PASSWD_RW, &passwdNfc, prtVaddrCL, prtSizeCL, PRT_NOPASS_RW));
+  SecretDef d1 = makeDef(0x11), d2 = makeDef(0x22);
+  CHECK(saveSecretNfc(&d1));
+  CHECK(loadedEquals(d1));
+  CHECK(memcmp(sim.memory() + 8 * 16, "SL", 2) == 0);   // 最初はスロットB
+  CHECK(saveSecretNfc(&d2));
+  CHECK(loadedEquals(d2));
+  CHECK(memcmp(sim.memory() + 4 * 16, "SL", 2) == 0);   // 次はスロットA
+}
+
+// [Classic] スロット化する前のカード（先頭のセクタだけプロテクト）はスロットBのセクタもプロテクトしてから書く
+void testSaveClassicLegacy() {
+  CHECK(mountSim(SIM_CLASSIC1K));
+  CHECK(nfc.writeProtectCL(PRT_PASSWD_RW, &passwdNfc, 0, 48, PRT_NOPASS_RW));
+  SecretDef legacy = makeDef(0x33);
+  CHECK(nfc.writeData(0, &legacy, sizeof(legacy), PRT_PASSWD_RW));
+  CHECK(loadedEquals(legacy));
+  CHECK(nfc.readProtectModeCL(0) == PRT_PASSWD_RW);
+  CHECK(nfc.readProtectModeCL(48) == PRT_NOPASS_RW);
+
+  SecretDef d1 = makeDef(0x44), d2 = makeDef(0x55);
+  CHECK(saveSecretNfc(&d1));
+  CHECK(loadedEquals(d1));
+  CHECK(nfc.readProtectModeCL(48) == PRT_PASSWD_RW);
+  CHECK(nfc.readProtectModeCL(96) == PRT_NOPASS_RW);   // 範囲外は変えない
+  CHECK(saveSecretNfc(&d2));   // スロットBはKeyAでは読めない
+  CHECK(loadedEquals(d2));
+  byte back[48];
+  CHECK(!nfc.readData(48, back, sizeof(back), PRT_NOPASS_RW));
+}
+
+// [Classic] プロテクトしていないカードや読み込み専用のカードには書かない
+void testSaveClassicRefused() {
+  SecretDef d1 = makeDef(0x66);
+  CHECK(mountSim(SIM_CLASSIC1K));
+  std::vector<byte> before(sim.memory(), sim.memory() + sim.memorySize());
+  CHECK(!saveSecretNfc(&d1));
+  CHECK(memcmp(before.data(), sim.memory(), before.size()) == 0);
+
+  CHECK(mountSim(SIM_CLASSIC1K));
+  CHECK(nfc.writeProtectCL(PRT_PASSWD_RW, &passwdNfc, 0, 48, PRT_NOPASS_RW));
+  CHECK(nfc.writeProtectCL(PRT_NOPASS_RO, nullptr, 48, 48, PRT_NOPASS_RW));
+  CHECK(!saveSecretNfc(&d1));
+  CHECK(nfc.readProtectModeCL(48) == PRT_NOPASS_RO);
+}
+
+// [Ultralight] NDEFコンテナのデータ領域に保存する
+void testSaveUltralight() {
+  CHECK(mountSim(SIM_NTAG213));
+  CHECK(nfc.writeProtectUL(PRT_PASSWD_RW, &passwdNfc, prtVaddrUL, false, PRT_NOPASS_RW));
+  CHECK(nfc.mountCard(100, PRT_PASSWD_RW));
+  SecretDef d1 = makeDef(0x77), d2 = makeDef(0x88);
+  CHECK(saveSecretNfc(&d1));
+  CHECK(loadedEquals(d1));
+  uint16_t vaddr, size;
+  CHECK(nfc.findNdefContainerUL(NdefSecretType, &vaddr, &size));
+  CHECK(vaddr == SECRET_NFC_NDEF_ADDR && size == SECRET_NFC_AREA_SIZE);
+  CHECK(saveSecretNfc(&d2));
+  CHECK(loadedEquals(d2));
+}
+
+// 古い形式のカードに保存するとき、何回目の書き込みで途切れても前回か今回の内容が読める
+//   UltralightはNDEFコンテナに移し、Classicはスロット化する前のカードならスロットBのセクタもプロテクトする
+static void migrateInterrupted(SimCardType type, int oldFormat) {
+  SecretDef d1 = makeDef(0x91), d2 = makeDef(0x92), d3 = makeDef(0x93), dnew = makeDef(0xA0);
+  CHECK(mountSim(type));
+  if (type == SIM_CLASSIC1K) {   // スロット化する前のカードは先頭のセクタだけプロテクト
+    CHECK(nfc.writeProtectCL(PRT_PASSWD_RW, &passwdNfc, 0, (oldFormat == 0 ? 48 : prtSizeCL), PRT_NOPASS_RW));
+  } else {   // 古いカードは先頭からプロテクト
+    CHECK(nfc.writeProtectUL(PRT_PASSWD_RW, &passwdNfc, 0, false, PRT_NOPASS_RW));
+  }
+  CHECK(nfc.mountCard(100, PRT_PASSWD_RW));
+  SecretDef expectOld;
+  if (oldFormat == 0) {   // スロット化する前の形式
+    CHECK(nfc.writeData(0, &d1, sizeof(d1), PRT_PASSWD_RW));
+    expectOld = d1;
+  } else if (oldFormat == 1) {   // A/BスロットでBが最新
+    CHECK(nfc.writeSlot(0, SECRET_NFC_SLOT_SIZE, &d1, sizeof(d1), PRT_PASSWD_RW, 0));
+    CHECK(nfc.writeSlot(0, SECRET_NFC_SLOT_SIZE, &d2, sizeof(d2), PRT_PASSWD_RW, 1));
+    expectOld = d2;
+  } else {   // A/BスロットでAが最新
+    CHECK(nfc.writeSlot(0, SECRET_NFC_SLOT_SIZE, &d1, sizeof(d1), PRT_PASSWD_RW, 0));
+    CHECK(nfc.writeSlot(0, SECRET_NFC_SLOT_SIZE, &d2, sizeof(d2), PRT_PASSWD_RW, 1));
+    CHECK(nfc.writeSlot(0, SECRET_NFC_SLOT_SIZE, &d3, sizeof(d3), PRT_PASSWD_RW, 0));
+    expectOld = d3;
+  }
+  CHECK(loadedEquals(expectOld));
+  std::vector<byte> before(sim.memory(), sim.memory() + sim.memorySize());
+
+  // n回書き込んだところで途切れさせる（一度今回の内容が読めたら、それより後で途切れても今回の内容が読める）
+  bool done = false, switched = false;
+  for (uint32_t n=0; n<200 && !done; n++) {
+    memcpy(sim.memory(), before.data(), before.size());
+    nfc.unmountCard();
+    CHECK(nfc.mountCard(100, PRT_PASSWD_RW));
+    sim._writeLimit = n;
+    done = saveSecretNfc(&dnew);
+    sim._writeLimit = UINT32_MAX;
+    nfc.unmountCard();
+    CHECK(nfc.mountCard(100, PRT_PASSWD_RW));
+    bool isNew = loadedEquals(dnew);
+    if (!isNew) CHECK(loadedEquals(expectOld));
+    CHECK(!switched || isNew);
+    switched |= isNew;
+    if (done) CHECK(isNew);
+    if (!done) {   // 途切れたカードに保存し直せば移し終える
+      CHECK(saveSecretNfc(&dnew));
+      CHECK(loadedEquals(dnew));
+    }
+  }
+  CHECK(done);
+  uint16_t vaddr, size;
+  if (type == SIM_CLASSIC1K) {
+    CHECK(nfc.readProtectModeCL(48) == PRT_PASSWD_RW);
+  } else {
+    CHECK(nfc.findNdefContainerUL(NdefSecretType, &vaddr, &size));
+  }
+
+  // 移し終えたカードには続けて保存できる
+  SecretDef dnext = makeDef(0xA1);
+  CHECK(saveSecretNfc(&dnext));
+  CHECK(loadedEquals(dnext));
+}
+
+void testMigrateClassicLegacy() { migrateInterrupted(SIM_CLASSIC1K, 0); }
+void testMigrateClassicSlotB() { migrateInterrupted(SIM_CLASSIC1K, 1); }
+void testMigrateClassicSlotA() { migrateInterrupted(SIM_CLASSIC1K, 2); }
+void testMigrateUltralightLegacy() { migrateInterrupted(SIM_NTAG213, 0); }
+void testMigrateUltralightSlotB() { migrateInterrupted(SIM_NTAG213, 1); }
+void testMigrateUltralightSlotA() { migrateInterrupted(SIM_NTAG213, 2); }
+
+int main() {
+  RUN_TEST(testSaveClassic);
+  RUN_TEST(testSaveClassicLegacy);
+  RUN_TEST(testSaveClassicRefused);
+  RUN_TEST(testSaveUltralight);
+  RUN_TEST(testMigrateClassicLegacy);
+  RUN_TEST(testMigrateClassicSlotB);
+  RUN_TEST(testMigrateClassicSlotA);
+  RUN_TEST(testMigrateUltralightLegacy);
+  RUN_TEST(testMigrateUltralightSlotB);
+  RUN_TEST(testMigrateUltralightSlotA);
+  return testResult();
+}
@@ -0,0 +1,148 @@
+/*
+  test_totp.cpp
+  TOTPの生成をRFC 6238 Appendix Bのテストベクタで確認する
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#include "hosttest.h"
+#include "hostenv.h"
+#include "totputil.h"
+
+// RFC 6238 Appendix B の時刻と8桁のコード
+struct RfcVector {
+  time_t epoch;
+  const char* sha1;
+  const char* sha256;
+  const char* sha512;
+};
+static const RfcVector rfcVectors[] = {
+  {          59LL, "94287082", "46119246", "90693936" },
+  {  1111111109LL, "07081804", "68084774", "25091201" },
+  {  1111111111LL, "14050471", "67062674", "99943326" },
+  {  1234567890LL, "89005924", "91819424", "93441116" },
+  {  2000000000LL, "69279037", "90698825", "38618901" },
+  { 20000000000LL, "65353130", "77737706", "47863826" },
+};
+
+// RFC 6238の秘密鍵（アルゴリズムごとにハッシュの出力長に合わせた長さ）
+static const char rfcSeed[] = "1234567890123456789012345678901234567890123456789012345678901234";
+static const char SEED_SHA1_B32[] = "GEZDGNBVGY3TQOJQGEZDGNBVGY3TQOJQ";
+static const char SEED_SHA256_B32[] = "GEZDGNBVGY3TQOJQGEZDGNBVGY3TQOJQGEZDGNBVGY3TQOJQGEZA";
+
+// デコード済みの秘密鍵で、3つのアルゴリズムすべてのベクタを確認する
+void testRfc6238Vectors() {
+  const struct { uint8_t algo; size_t keyLen; } algos[] = {
+    { TOTP_ALGO_SHA1, 20 }, { TOTP_ALGO_SHA256, 32 }, { TOTP_ALGO_SHA512, 64 },
+  };
+  for (auto& a : algos) {
+    TotpGenerator totp;
+    CHECK(totp.begin((const uint8_t*)rfcSeed, a.keyLen, 30, 8, a.algo));
+    for (auto& v : rfcVectors) {
+      char code[TOTP_CODE_BUFSIZE];
+      CHECK(totp.getCode(v.epoch, code, sizeof(code)));
+      const char* expected = (a.algo == TOTP_ALGO_SHA1) ? v.sha1 : (a.algo == TOTP_ALGO_SHA256) ? v.sha256 : v.sha512;
+      CHECK_STR(code, expected);
+    }
+  }
+  CHECK(TotpGenerator::selfTest());
+}
+
+// Base32の秘密鍵からTotpParams経由で生成する（アプリが実際に使う経路）
+void testGetTotp() {
+  TotpParams tp;
+  strcpy(tp.secret, SEED_SHA1_B32);
+  tp.digit = 8;
+  char code[TOTP_CODE_BUFSIZE];
+  for (auto& v : rfcVectors) {
+    CHECK(getTotp(&tp, v.epoch, code, sizeof(code)));
+    CHECK_STR(code, v.sha1);
+  }
+  strcpy(tp.secret, SEED_SHA256_B32);
+  tp.algorithm = TOTP_ALGO_SHA256;
+  CHECK(getTotp(&tp, 1111111109, code, sizeof(code)));
+  CHECK_STR(code, "68084774");
+
+  // 6桁は8桁の下位6桁になる
+  strcpy(tp.secret, SEED_SHA1_B32);
+  tp.algorithm = TOTP_ALGO_SHA1;
+  tp.digit = 6;
+  CHECK(getTotp(&tp, 59, code, sizeof(code)));
+  CHECK_STR(code, "287082");
+}
+
+// 前後のコードをまとめて取得する
+void testGetCodes() {
+  TotpGenerator totp;
+  CHECK(totp.begin(SEED_SHA1_B32, 30, 8, TOTP_ALGO_SHA1));
+  char codes[3][TOTP_CODE_BUFSIZE];
+  CHECK(totp.getCodes(1111111111, -1, 3, codes) == 3);
+  CHECK_STR(codes[0], "07081804");   // 1111111109と同じ時間枠
+  CHECK_STR(codes[1], "14050471");
+}
+
+// RFC 4226 Appendix D のHOTPの値（桁数で丸める前の31bit値）
+void testRfc4226Hotp() {
+  static const uint32_t expected[10] = {
+    1284755224, 1094287082, 137359152, 1726969429, 1640338314,
+    868254676, 1918287922, 82162583, 673399871, 645520489,
+  };
+  TotpGenerator totp;
+  CHECK(totp.begin((const uint8_t*)rfcSeed, 20, 30, 6, TOTP_ALGO_SHA1));
+  for (int i=0; i<10; i++) CHECK(totp.hotp(i) == expected[i]);
+}
+
+// 同じインスタンスでアルゴリズムを切り替えても前の状態が残らない
+void testAlgorithmSwitch() {
+  TotpGenerator totp;
+  char code[TOTP_CODE_BUFSIZE];
+  CHECK(totp.begin((const uint8_t*)rfcSeed, 64, 30, 8, TOTP_ALGO_SHA512));
+  CHECK(totp.getCode(1234567890, code, sizeof(code)));
+  CHECK_STR(code, "93441116");
+  CHECK(totp.begin((const uint8_t*)rfcSeed, 20, 30, 8, TOTP_ALGO_SHA1));
+  CHECK(totp.getCode(1234567890, code, sizeof(code)));
+  CHECK_STR(code, "89005924");
+  CHECK(totp.begin((const uint8_t*)rfcSeed, 32, 30, 8, TOTP_ALGO_SHA256));
+  CHECK(totp.getCode(1234567890, code, sizeof(code)));
+  CHECK_STR(code, "91819424");
+}
+
+// アルゴリズム名とTotpAlgorithmの相互変換（URIのalgorithm=の値）
+void testAlgorithmNames() {
+  const uint8_t algos[] = { TOTP_ALGO_SHA1, TOTP_ALGO_SHA256, TOTP_ALGO_SHA512 };
+  for (uint8_t a : algos) {
+    const char* name = TotpGenerator::algorithmName(a);
+    CHECK(TotpGenerator::algorithmFromName(name, strlen(name)) == a);
+  }
+  CHECK(TotpGenerator::algorithmFromName("sha256", 6) == TOTP_ALGO_SHA256);
+  CHECK(TotpGenerator::algorithmFromName("SHA2567", 6) == TOTP_ALGO_SHA256);   // 長さで区切る
+  CHECK(TotpGenerator::algorithmFromName("SHA", 3) == 0);
+  CHECK(TotpGenerator::algorithmFromName("MD5", 3) == 0);
+  CHECK(TotpGenerator::algorithmFromName(nullptr, 0) == 0);
+}
+
+// 不正な秘密鍵や桁数は受け付けない
+void testInvalidParams() {
+  TotpGenerator totp;
+  CHECK(!totp.begin("", 30, 6, TOTP_ALGO_SHA1));
+  CHECK(!totp.begin("!!!!", 30, 6, TOTP_ALGO_SHA1));
+  CHECK(!totp.begin(SEED_SHA1_B32, 30, 6, 9));
+  CHECK(!totp.isReady());
+  TotpParams tp;
+  strcpy(tp.secret, SEED_SHA1_B32);
+  tp.digit = 4;
+  char code[TOTP_CODE_BUFSIZE];
+  CHECK(!getTotp(&tp, 59, code, sizeof(code)));
+}
+
+int main() {
+  RUN_TEST(testRfc6238Vectors);
+  RUN_TEST(testGetTotp);
+  RUN_TEST(testGetCodes);
+  RUN_TEST(testRfc4226Hotp);
+  RUN_TEST(testAlgorithmSwitch);
+  RUN_TEST(testAlgorithmNames);
+  RUN_TEST(testInvalidParams);
+  return testResult();
+}
@@ -0,0 +1,126 @@
+/*
+  test_uri.cpp
+  otpauth:// URIのパーサー(parseUriOTP)とURLデコードを確認する
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#include "hosttest.h"
+#include "hostenv.h"
+#include "totputil.h"
+
+// URIを書き換え可能なバッファにコピーしてパースする
+static bool parse(const char* uri, TotpParams* tp) {
+  char buf[512];
+  strncpy(buf, uri, sizeof(buf) - 1);
+  buf[sizeof(buf) - 1] = '\0';
+  return parseUriOTP(tp, buf, strlen(buf));
+}
+
+// 一般的なURI
+void testBasicUri() {
+  TotpParams tp;
+  CHECK(parse("otpauth://totp/Example:alice@google.com?secret=JBSWY3DPEHPK3PXP&issuer=Example", &tp));
+  CHECK_STR(tp.issuer, "Example");
+  CHECK_STR(tp.account, "alice@google.com");
+  CHECK_STR(tp.secret, "JBSWY3DPEHPK3PXP");
+  CHECK(tp.algorithm == TOTP_ALGO_SHA1);
+  CHECK(tp.digit == 6);
+  CHECK(tp.period == 30);
+}
+
+// パーセントエンコードとオプションのパラメータ
+void testEncodedUri() {
+  TotpParams tp;
+  CHECK(parse("otpauth://totp/ACME%20Co:john.doe%40email.com?secret=HXDMVJECJJWSRB3HWIZR4IFUGFTMXBOZ"
+              "&issuer=ACME%20Co&algorithm=SHA256&digits=8&period=60", &tp));
+  CHECK_STR(tp.issuer, "ACME Co");
+  CHECK_STR(tp.account, "john.doe@email.com");
+  CHECK(tp.algorithm == TOTP_ALGO_SHA256);
+  CHECK(tp.digit == 8);
+  CHECK(tp.period == 60);
+
+  // スキームは大文字小文字を区別しない。アルゴリズム名も同様
+  CHECK(parse("OTPAUTH://TOTP/a?secret=JBSWY3DPEHPK3PXP&algorithm=sha512", &tp));
+  CHECK(tp.algorithm == TOTP_ALGO_SHA512);
+
+  // +は空白、コロンの後ろの空白は除く
+  CHECK(parse("otpauth://totp/My+Bank:%20bob?secret=JBSWY3DPEHPK3PXP", &tp));
+  CHECK_STR(tp.issuer, "My Bank");
+  CHECK_STR(tp.account, "bob");
+}
+
+// ラベルにissuerがない場合はクエリのissuerを使う。=のないパラメータは無視する
+void testLabelVariants() {
+  TotpParams tp;
+  CHECK(parse("otpauth://totp/carol?issuer=Corp&flag&secret=JBSWY3DPEHPK3PXP&counter=5", &tp));
+  CHECK_STR(tp.issuer, "Corp");
+  CHECK_STR(tp.account, "carol");
+
+  CHECK(parse("otpauth://totp/dave?secret=JBSWY3DPEHPK3PXP", &tp));
+  CHECK_STR(tp.issuer, "");
+  CHECK_STR(tp.account, "dave");
+
+  // 長すぎるラベルはUTF-8の文字の途中で切らない
+  CHECK(parse("otpauth://totp/%E3%81%82%E3%81%82%E3%81%82%E3%81%82%E3%81%82%E3%81%82%E3%81%82%E3%81%82"
+              "%E3%81%82%E3%81%82%E3%81%82?secret=JBSWY3DPEHPK3PXP", &tp));
+  CHECK(strlen(tp.account) == 30);   // 31バイトに入る「あ」は10文字まで
+}
+
+// 不正なURIは拒否し、結果を書き換えない
+void testRejectedUri() {
+  TotpParams tp;
+  strcpy(tp.issuer, "unchanged");
+  CHECK(!parse("otpauth://hotp/a?secret=JBSWY3DPEHPK3PXP", &tp));
+  CHECK(!parse("https://example.com/?secret=JBSWY3DPEHPK3PXP", &tp));
+  CHECK(!parse("otpauth://totp/a?issuer=x", &tp));                              // secretがない
+  CHECK(!parse("otpauth://totp/a?secret=", &tp));
+  CHECK(!parse("otpauth://totp/a?secret=JBSWY3DPEHPK3PXP&digits=5", &tp));
+  CHECK(!parse("otpauth://totp/a?secret=JBSWY3DPEHPK3PXP&digits=11", &tp));
+  CHECK(!parse("otpauth://totp/a?secret=JBSWY3DPEHPK3PXP&digits=8x", &tp));
+  CHECK(!parse("otpauth://totp/a?secret=JBSWY3DPEHPK3PXP&period=0", &tp));
+  CHECK(!parse("otpauth://totp/a?secret=JBSWY3DPEHPK3PXP&period=256", &tp));
+  CHECK(!parse("otpauth://totp/a?secret=JBSWY3DPEHPK3PXP&algorithm=MD5", &tp));
+  CHECK(!parse("otpauth://totp/a?secret=JBSWY3DPEHPK3PXP&counter=99999999999", &tp));
+  CHECK_STR(tp.issuer, "unchanged");
+
+  // secretは63文字まで
+  char uri[160];
+  snprintf(uri, sizeof(uri), "otpauth://totp/a?secret=%s", std::string(63, 'A').c_str());
+  CHECK(parse(uri, &tp));
+  snprintf(uri, sizeof(uri), "otpauth://totp/a?secret=%s", std::string(64, 'A').c_str());
+  CHECK(!parse(uri, &tp));
+}
+
+// lenより後ろは読まない（QRコードのバッファの残りを無視する）
+void testLengthLimit() {
+  TotpParams tp;
+  char buf[] = "otpauth://totp/a?secret=JBSWY3DPEHPK3PXP&digits=8";
+  CHECK(parseUriOTP(&tp, buf, strlen("otpauth://totp/a?secret=JBSWY3DPEHPK3PXP")));
+  CHECK(tp.digit == 6);
+  char shortBuf[] = "otpauth://to";
+  CHECK(!parseUriOTP(&tp, shortBuf, strlen(shortBuf)));
+}
+
+// URLデコード
+void testUrlDecode() {
+  char buf[64];
+  strcpy(buf, "a%20b+c%2Bd%zz%4");
+  size_t n = urlDecodeInPlace(buf, strlen(buf), true);
+  CHECK(n == 12);
+  CHECK(memcmp(buf, "a b c+d%zz%4", n) == 0);
+  strcpy(buf, "a+b");
+  n = urlDecodeInPlace(buf, strlen(buf), false);
+  CHECK(memcmp(buf, "a+b", n) == 0);
+}
+
+int main() {
+  RUN_TEST(testBasicUri);
+  RUN_TEST(testEncodedUri);
+  RUN_TEST(testLabelVariants);
+  RUN_TEST(testRejectedUri);
+  RUN_TEST(testLengthLimit);
+  RUN_TEST(testUrlDecode);
+  return testResult();
+}
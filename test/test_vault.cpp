@@ -0,0 +1,243 @@
+/*
+  test_vault.cpp
+  OTPの保存ファイル(otpvault.h)をFatFSのシムで確認する
+  旧形式(otp-*.bin、AES-CBC)からの移行、version 2(AES-GCM)への変換、改ざんの検出、追加と削除
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+*/
+#include "hosttest.h"
+#include "hostenv.h"
+#include "coreutil.h"
+#include "totputil.h"
+#include "otpvault.h"
+
+// テスト用のOTP
+static TotpParams makeOtp(int i) {
+  TotpParams tp;
+  snprintf(tp.issuer, sizeof(tp.issuer), "issuer%d", i);
+  snprintf(tp.account, sizeof(tp.account), "user%d@example.com", i);
+  snprintf(tp.secret, sizeof(tp.secret), "JBSWY3DPEHPK3PXP%c%c", 'A' + (i / 26) % 26, 'A' + i % 26);   // Base32の文字だけ
+  tp.digit = (i % 2) ? 8 : 6;
+  return tp;
+}
+
+// 旧形式のファイル（version 1、共通のIVでAES-CBC）を作る
+static void saveLegacyOtp(int i) {
+  TotpParams tp = makeOtp(i);
+  TotpParams enc = tp;
+  enc.version = OTP_RECORD_CBC;
+  sessionEncrypt(reinterpret_cast<const byte*>(tp.secret), sizeof(tp.secret), status.iv, reinterpret_cast<byte*>(enc.secret));
+  saveFile(&enc, sizeof(enc), "/otp-" + String(i) + ".bin");
+}
+
+// 旧形式から移行した順番はディレクトリの順なので、アカウント名からslotを探す
+static int slotOf(int i) {
+  for (const OtpIndex& idx : getOtpIndex()) {
+    if (strcmp(idx.account, makeOtp(i).account) == 0) return idx.slot;
+  }
+  return -1;
+}
+
+// 保存ファイルを空にして開き直す
+static void resetVault() {
+  FFat.format();
+  vaultInvalidate();
+  vaultReady = false;
+  CHECK(vaultBegin());
+}
+
+// 旧形式から移行し、アンロック後にversion 2へ変換する
+void testUpgradeFromCbc() {
+  resetVault();
+  const int count = 12;   // VAULT_READ_BATCHをまたぐ件数
+  for (int i=0; i<count; i++) saveLegacyOtp(i);
+  saveFile((void*)"broken", 6, "/otp-99.bin");   // 大きさが違うファイルは移行せずに残す
+
+  CHECK(getOtpIndex().size() == count);
+  CHECK(vaultCbcRecords == count);
+  CHECK(!FFat.exists("/otp-0.bin"));
+  CHECK(FFat.exists("/otp-99.bin"));
+
+  // 秘密鍵を使うと変換される
+  TotpParams tp;
+  CHECK(loadOtpRecord(slotOf(3), &tp, true));
+  CHECK_STR(tp.secret, makeOtp(3).secret);
+  CHECK(vaultCbcRecords == 0);
+  CHECK(!FFat.exists(FN_OTPVAULT_TMP));
+
+  // 全て version 2 になり、slotとnonce以外の項目は変わらない
+  TotpParams enc, prev;
+  for (int i=0; i<count; i++) {
+    int slot = slotOf(i);
+    CHECK(vaultReadRecord(FN_OTPVAULT, slot, &enc));
+    CHECK(enc.version == OTP_RECORD_GCM);
+    CHECK_STR(enc.issuer, makeOtp(i).issuer);
+    CHECK(enc.digit == makeOtp(i).digit);
+    if (i > 0) CHECK(memcmp(enc.nonce, prev.nonce, GCM_NONCE_SIZE) != 0);   // nonceはレコードごと
+    prev = enc;
+    CHECK(loadOtpRecord(slot, &tp, true));
+    CHECK_STR(tp.secret, makeOtp(i).secret);
+  }
+
+  // 開き直しても同じ内容が読める
+  vaultInvalidate();
+  vaultReady = false;
+  CHECK(getOtpIndex().size() == count);
+  CHECK(vaultCbcRecords == 0);
+  CHECK(loadOtpRecord(slotOf(count - 1), &tp, true));
+  CHECK_STR(tp.secret, makeOtp(count - 1).secret);
+}
+
+// ロック中は変換しない（秘密鍵がないので）
+void testLockedNoUpgrade() {
+  resetVault();
+  for (int i=0; i<3; i++) saveLegacyOtp(i);
+  status.unlock = false;
+  TotpParams tp;
+  CHECK(getOtpIndex().size() == 3);
+  CHECK(!loadOtpRecord(slotOf(0), &tp, true));
+  CHECK(loadOtpRecord(slotOf(0), &tp, false));   // 秘密鍵以外は読める
+  CHECK_STR(tp.account, makeOtp(0).account);
+  CHECK_STR(tp.secret, "");
+  CHECK(vaultUpgradeRecords());
+  CHECK(vaultCbcRecords == 3);
+  status.unlock = true;
+  CHECK(loadOtpRecord(0, &tp, true));
+  CHECK(vaultCbcRecords == 0);
+}
+
+// 違う秘密鍵でアンロックしたときは変換せず、保存ファイルをそのまま残す
+void testUpgradeWrongKey() {
+  resetVault();
+  for (int i=0; i<3; i++) saveLegacyOtp(i);
+  CHECK(getOtpIndex().size() == 3);
+  std::vector<byte> before(getFileSize(FN_OTPVAULT));
+  CHECK(loadFile(before.data(), before.size(), FN_OTPVAULT) == before.size());
+
+  byte other[sizeof(status.secret)];
+  esp_fill_random(other, sizeof(other));
+  CHECK(cryptoSessionBegin(other));
+  TotpParams tp;
+  CHECK(!loadOtpRecord(slotOf(0), &tp, true));   // Base32にならないので復号化に失敗する
+  CHECK_STR(tp.secret, "");
+  CHECK(!vaultUpgradeRecords());
+  CHECK(vaultCbcRecords == 3);
+  CHECK(!FFat.exists(FN_OTPVAULT_TMP));
+  std::vector<byte> after(before.size());
+  CHECK(getFileSize(FN_OTPVAULT) == (int)before.size());
+  CHECK(loadFile(after.data(), after.size(), FN_OTPVAULT) == after.size());
+  CHECK(before == after);
+
+  // 正しい秘密鍵に戻せば変換できる
+  CHECK(cryptoSessionBegin(status.secret));
+  CHECK(loadOtpRecord(slotOf(1), &tp, true));
+  CHECK_STR(tp.secret, makeOtp(1).secret);
+  CHECK(vaultCbcRecords == 0);
+}
+
+// 復号化したsecretがBase32の文字列と0埋めか
+void testSecretIsBase32() {
+  char s[64] = {0};
+  CHECK(!otpSecretIsBase32(s, sizeof(s)));   // 空
+  strcpy(s, "JBSWY3DPEHPK3PXP");
+  CHECK(otpSecretIsBase32(s, sizeof(s)));
+  strcpy(s, "jbsw y3dp-ehpk====");
+  CHECK(otpSecretIsBase32(s, sizeof(s)));
+  s[1] = '1';
+  CHECK(!otpSecretIsBase32(s, sizeof(s)));   // Base32にない文字
+  strcpy(s, "JBSWY3DP");
+  s[20] = 'A';
+  CHECK(!otpSecretIsBase32(s, sizeof(s)));   // 0埋めの後ろにゴミ
+  memset(s, 'A', sizeof(s));
+  CHECK(!otpSecretIsBase32(s, sizeof(s)));   // 終端がない
+}
+
+// 保存ファイルのレコードを書き換える
+static void patchRecord(uint16_t slot, size_t offset, byte x) {
+  File file = FFat.open(FN_OTPVAULT, "r+");
+  size_t pos = VAULT_HEADER_SIZE + (size_t)slot * VAULT_RECORD_SIZE + offset;
+  file.seek(pos);
+  int c = file.read();
+  file.seek(pos);
+  file.write((uint8_t)(c ^ x));
+  file.close();
+}
+
+// version 2は秘密鍵以外の項目の改ざんも検出する
+void testTamperDetected() {
+  resetVault();
+  std::vector<TotpParams> tps;
+  for (int i=0; i<4; i++) tps.push_back(makeOtp(i));
+  int added, duplicated;
+  CHECK(saveOtpRecords(&tps, &added, &duplicated));
+  CHECK(added == 4);
+  patchRecord(0, offsetof(TotpParams, account), 0x01);
+  patchRecord(1, offsetof(TotpParams, secret) + 5, 0x80);
+  patchRecord(2, offsetof(TotpParams, tag), 0x01);
+  patchRecord(3, offsetof(TotpParams, period), 0x00);   // 変更なし
+  vaultInvalidate();
+  TotpParams tp;
+  CHECK(!loadOtpRecord(0, &tp, true));
+  CHECK_STR(tp.secret, "");
+  CHECK(!loadOtpRecord(1, &tp, true));
+  CHECK(!loadOtpRecord(2, &tp, true));
+  CHECK(loadOtpRecord(3, &tp, true));
+
+  // 一括で読む場合は検証に失敗した件数を返す
+  int opened = 0;
+  int failed = vaultOpenRecords(FN_OTPVAULT, vaultSlots, [&](uint16_t slot, const TotpParams* raw, TotpParams* cur) {
+    if (cur != nullptr) opened ++;
+    return true;
+  });
+  CHECK(failed == 3);
+  CHECK(opened == 1);
+}
+
+// 追加、重複の除外、検索、削除
+void testSaveFindDelete() {
+  resetVault();
+  std::vector<TotpParams> tps = { makeOtp(0), makeOtp(1), makeOtp(0) };
+  int added, duplicated;
+  CHECK(saveOtpRecords(&tps, &added, &duplicated));
+  CHECK(added == 2 && duplicated == 1);
+  CHECK(saveOtpRecords(&tps, &added, &duplicated));
+  CHECK(added == 0 && duplicated == 3);
+
+  TotpParams tp = makeOtp(1);
+  CHECK(findOtpRecord(&tp) == 1);
+  tp.secret[0] = 'X';
+  CHECK(findOtpRecord(&tp) == -1);
+  tp = makeOtp(2);
+  CHECK(saveOtpRecord(&tp) == 2);
+  CHECK(saveOtpRecord(&tp) == 2);
+
+  CHECK(deleteOtpRecord(1));
+  CHECK(getOtpIndex().size() == 2);
+  CHECK(vaultTombstones == 1);
+  MenuDef* menu = getOtpMenu("test", 0);
+  CHECK(menu->lists.size() == 3);   // "戻る"＋2件
+  tp = makeOtp(1);
+  CHECK(findOtpRecord(&tp) == -1);
+}
+
+int main() {
+  if (!hostFatfsBegin("vault")) {
+    printf("FatFS shim init failed\n");
+    return 1;
+  }
+  esp_fill_random(status.iv, sizeof(status.iv));
+  esp_fill_random(status.secret, sizeof(status.secret));
+  if (!cryptoSessionBegin(status.secret)) return 1;
+  status.unlock = true;
+
+  RUN_TEST(testUpgradeFromCbc);
+  RUN_TEST(testLockedNoUpgrade);
+  RUN_TEST(testUpgradeWrongKey);
+  RUN_TEST(testSecretIsBase32);
+  RUN_TEST(testTamperDetected);
+  RUN_TEST(testSaveFindDelete);
+  cryptoSessionEnd();
+  return testResult();
+}
@@ -0,0 +1,187 @@
+#!/usr/bin/env python3
+"""
+  icon_rle.py
+  アイコン画像データ(RGB565)をパレット＋ランレングス圧縮に変換する
+
+  入力: lang-ship.com の画像変換サイトで作ったC言語の配列（const uint16_t imgBin_xxx[N] PROGMEM = {...};）
+        またはPNG画像（Pillowが必要。ファイル名から imgBin_ファイル名 という名前にする）
+  出力: 配列ごとに imgRle_xxx（圧縮データ）と imgPal_xxx（パレット）を書いたヘッダーファイル
+
+  圧縮データの形式（1行ごとに完結するので、1行ずつ展開して描ける）
+    ヘッダー1バイトの最上位ビットが1: 連続  下位7ビット+1 個の画素が、次の1バイトのパレット番号
+    ヘッダー1バイトの最上位ビットが0: 非連続  下位7ビット+1 個のパレット番号が続く
+    パレットは出現回数の多い順で最大256色
+
+  使い方:
+    python3 tools/icon_rle.py tools/icon_src.h -o src/icon_rle.h
+    python3 tools/icon_rle.py tools/icon_src.h --verify   # 変換して元に戻せるかの確認だけ
+
+  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)
+  Released under the MIT license.
+  see https://opensource.org/licenses/MIT
+"""
+import argparse
+import collections
+import os
+import re
+import sys
+
+RUN_MAX = 128   # 1つのヘッダーで表せる画素数
+MIN_RUN = 3     # これ以上続いたら連続として書く（2画素なら非連続の方が短いか同じ）
+
+ARRAY_RE = re.compile(r'const\s+(?:uint16_t|unsigned\s+short)\s+(\w+)\s*\[\s*(\d+)\s*\]\s*PROGMEM\s*=\s*\{(.*?)\};', re.S)
+ROW_RE = re.compile(r'//\s*row\s+\d+,\s*(\d+)\s*pixels')
+
+
+def load_c_arrays(path):
+    """Cの配列を読み込む。幅は行ごとのコメント(// row 0, 24 pixels)から求める"""
+    text = open(path, encoding='utf-8').read()
+    images = []
+    for m in ARRAY_RE.finditer(text):
+        name, count, body = m.group(1), int(m.group(2)), m.group(3)
+        rows = ROW_RE.findall(body)
+        pixels = [int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]+', re.sub(r'//[^\n]*', '', body))]
+        if len(pixels) != count:
+            sys.exit('%s: %s has %d pixels, expected %d' % (path, name, len(pixels), count))
+        if not rows:
+            sys.exit('%s: %s has no row comments, width unknown' % (path, name))
+        width = int(rows[0])
+        images.append((name, width, count // width, pixels))
+    return images
+
+
+def load_png(path):
+    """PNG画像を読み込んでRGB565にする"""
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit('Pillow is required to read PNG files (pip install pillow)')
+    img = Image.open(path).convert('RGB')
+    pixels = [((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3) for r, g, b in img.getdata()]
+    name = 'imgBin_' + re.sub(r'\W', '_', os.path.splitext(os.path.basename(path))[0])
+    return [(name, img.width, img.height, pixels)]
+
+
+def encode_row(row, index):
+    """1行をパレット番号のランレングスに圧縮する"""
+    out = bytearray()
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:RUN_MAX]
+            del literal[:RUN_MAX]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    i = 0
+    while i < len(row):
+        j = i
+        while j < len(row) and j - i < RUN_MAX and row[j] == row[i]:
+            j += 1
+        if j - i >= MIN_RUN:
+            flush()
+            out.append(0x80 | (j - i - 1))
+            out.append(index[row[i]])
+            i = j
+        else:
+            literal.append(index[row[i]])
+            i += 1
+    flush()
+    return out
+
+
+def decode(data, palette, width, height):
+    """圧縮データを展開する（確認用、DinMeterUI::decodeImageRow()と同じ処理）"""
+    pixels = []
+    p = 0
+    for _ in range(height):
+        n = 0
+        while n < width:
+            hdr = data[p]
+            p += 1
+            cnt = (hdr & 0x7F) + 1
+            if hdr & 0x80:
+                pixels.extend([palette[data[p]]] * cnt)
+                p += 1
+            else:
+                pixels.extend(palette[v] for v in data[p:p + cnt])
+                p += cnt
+            n += cnt
+    return pixels, p
+
+
+def encode(name, width, height, pixels):
+    counts = collections.Counter(pixels)
+    if len(counts) > 256:
+        sys.exit('%s: %d colors, palette is limited to 256' % (name, len(counts)))
+    palette = [c for c, _ in counts.most_common()]
+    index = {c: i for i, c in enumerate(palette)}
+    data = bytearray()
+    for y in range(height):
+        data += encode_row(pixels[y * width:(y + 1) * width], index)
+    back, used = decode(data, palette, width, height)
+    if back != pixels or used != len(data):
+        sys.exit('%s: round trip failed' % name)
+    return palette, data
+
+
+def c_array(ctype, name, values, fmt, per_line):
+    lines = ['const %s %s[%d] PROGMEM = {' % (ctype, name, len(values))]
+    for i in range(0, len(values), per_line):
+        lines.append('  ' + ','.join(fmt % v for v in values[i:i + per_line]) + ',')
+    lines.append('};')
+    return lines
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Convert RGB565 icon arrays to palette + RLE')
+    ap.add_argument('inputs', nargs='+', help='C header with imgBin_xxx arrays, or PNG files')
+    ap.add_argument('-o', '--output', help='output header (default: stdout)')
+    ap.add_argument('--verify', action='store_true', help='only check the round trip and print sizes')
+    args = ap.parse_args()
+
+    images = []
+    for path in args.inputs:
+        images += load_png(path) if path.lower().endswith('.png') else load_c_arrays(path)
+
+    lines = [
+        '/*',
+        '  icon_rle.h',
+        '  アイコン画像データ（パレット＋ランレングス圧縮）',
+        '  tools/icon_rle.py で生成したファイルなので、直接編集しないこと',
+        '',
+        '  Copyright (c) 2025 Kaz  (https://akibabara.com/blog/)',
+        '  Released under the MIT license.',
+        '  see https://opensource.org/licenses/MIT',
+        '*/',
+        '#pragma once',
+    ]
+    total_raw = total_rle = 0
+    for name, width, height, pixels in images:
+        palette, data = encode(name, width, height, pixels)
+        base = name[len('imgBin_'):] if name.startswith('imgBin_') else name
+        raw = width * height * 2
+        rle = len(data) + len(palette) * 2
+        total_raw += raw
+        total_rle += rle
+        print('%-20s %3dx%-3d %2d colors  %6d -> %5d bytes (%4.1f%%)' % (
+            name, width, height, len(palette), raw, rle, rle * 100.0 / raw), file=sys.stderr)
+        lines.append('')
+        lines.append('// %s  %dx%d, %d colors, %d -> %d bytes' % (base, width, height, len(palette), raw, rle))
+        lines += c_array('uint16_t', 'imgPal_' + base, palette, '0x%04X', 16)
+        lines += c_array('uint8_t', 'imgRle_' + base, list(data), '0x%02X', 24)
+    print('total %d -> %d bytes (%.1f%%)' % (total_raw, total_rle, total_rle * 100.0 / total_raw), file=sys.stderr)
+
+    if args.verify:
+        return
+    text = '\r\n'.join(lines) + '\r\n'   # src/ のファイルはCRLF
+    if args.output:
+        with open(args.output, 'w', encoding='utf-8', newline='') as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == '__main__':
+    main()